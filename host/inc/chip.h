@@ -0,0 +1,985 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef CHIP_H_
+#define CHIP_H_
+
+/** @file chip.h
+ ** @brief Reemplazo simulado del chip.h de LPCOpen para compilar y ejecutar el proyecto en Linux.
+ **
+ ** Expone el mismo subconjunto de la API de LPCOpen que usan los módulos del proyecto, pero los registros de los
+ ** periféricos son variables en memoria. Cada acceso a un registro se contabiliza y suma ciclos a un contador virtual, lo que
+ ** permite medir el costo de cada llamada fuera de la placa.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/** @brief Indica que el proyecto se compila contra el backend simulado */
+#define CHIP_SIMULATED 1
+
+#define __I  volatile const
+#define __O  volatile
+#define __IO volatile
+
+/** @brief Cantidad de puertos GPIO simulados */
+#define SIM_GPIO_PORTS 8
+
+/** @brief Ciclos virtuales que se contabilizan por cada acceso a un registro de un periférico */
+#define SIM_CYCLES_PER_ACCESS 2
+
+#define SCU_MODE_PULLUP           (0x0 << 3)
+#define SCU_MODE_REPEATER         (0x1 << 3)
+#define SCU_MODE_INACT            (0x2 << 3)
+#define SCU_MODE_PULLDOWN         (0x3 << 3)
+#define SCU_MODE_HIGHSPEEDSLEW_EN (0x1 << 5)
+#define SCU_MODE_INBUFF_EN        (0x1 << 6)
+#define SCU_MODE_ZIF_DIS          (0x1 << 7)
+#define SCU_MODE_FUNC0            0x0
+#define SCU_MODE_FUNC1            0x1
+#define SCU_MODE_FUNC2            0x2
+#define SCU_MODE_FUNC3            0x3
+#define SCU_MODE_FUNC4            0x4
+#define SCU_MODE_FUNC5            0x5
+#define SCU_MODE_FUNC6            0x6
+#define SCU_MODE_FUNC7            0x7
+
+#define SysTick_CTRL_ENABLE_Msk    (1UL << 0)
+#define SysTick_CTRL_TICKINT_Msk   (1UL << 1)
+#define SysTick_CTRL_CLKSOURCE_Msk (1UL << 2)
+#define SysTick_CTRL_COUNTFLAG_Msk (1UL << 16)
+#define SysTick_LOAD_RELOAD_Msk    (0xFFFFFFUL)
+
+#define CoreDebug_DEMCR_TRCENA_Msk (1UL << 24)
+#define DWT_CTRL_CYCCNTENA_Msk     (1UL << 0)
+
+/** @brief Cantidad de temporizadores de 32 bits simulados */
+#define SIM_TIMERS 4
+
+/** @brief Bit de TCR que habilita la cuenta del temporizador */
+#define TIMER_ENABLE ((uint32_t)(1 << 0))
+/** @brief Bit de TCR que mantiene el temporizador en reset */
+#define TIMER_RESET ((uint32_t)(1 << 1))
+/** @brief Bit de IR que indica y borra la coincidencia de un registro de comparación */
+#define TIMER_IR_CLR(n) (1u << (n))
+/** @brief Bit de MCR que genera una interrupción en la coincidencia */
+#define TIMER_INT_ON_MATCH(n) (1u << ((n) * 3))
+/** @brief Bit de MCR que reinicia la cuenta en la coincidencia */
+#define TIMER_RESET_ON_MATCH(n) (1u << (((n) * 3) + 1))
+/** @brief Bit de MCR que detiene la cuenta en la coincidencia */
+#define TIMER_STOP_ON_MATCH(n) (1u << (((n) * 3) + 2))
+
+/** @brief Bloques de registros de los temporizadores simulados */
+#define LPC_TIMER0 (&sim_timer[0])
+#define LPC_TIMER1 (&sim_timer[1])
+#define LPC_TIMER2 (&sim_timer[2])
+#define LPC_TIMER3 (&sim_timer[3])
+
+/** @brief Cantidad de UART simulados */
+#define SIM_UARTS 4
+
+/** @brief Profundidad de las FIFO de transmisión y de recepción de cada UART */
+#define SIM_UART_FIFO 16
+
+/** @brief Bytes recibidos con SimUartReceive() que pueden esperar su turno en la línea de cada UART */
+#define SIM_UART_RX_BUFFER 4096
+
+/** @brief Intervalo en microsegundos de tiempo virtual entre dos lecturas de una pseudoterminal */
+#define SIM_PTY_POLL_US 10000
+
+/** @brief Bits de LCR que seleccionan datos de 8 bits */
+#define UART_LCR_WLEN8 (3 << 0)
+/** @brief Bit de LCR que selecciona un bit de parada */
+#define UART_LCR_SBS_1BIT (0 << 2)
+/** @brief Bit de LCR que deshabilita la paridad */
+#define UART_LCR_PARITY_DIS (0 << 3)
+/** @brief Bit de LCR que da acceso a los registros del divisor */
+#define UART_LCR_DLAB_EN (1 << 7)
+/** @brief Bit de FCR que habilita las FIFO */
+#define UART_FCR_FIFO_EN (1 << 0)
+/** @brief Bit de FCR que vacía la FIFO de recepción */
+#define UART_FCR_RX_RS (1 << 1)
+/** @brief Bit de FCR que vacía la FIFO de transmisión */
+#define UART_FCR_TX_RS (1 << 2)
+/** @brief Bit de FCR que habilita los pedidos de DMA de transmisión y de recepción */
+#define UART_FCR_DMAMODE_SEL (1 << 3)
+/** @brief Bits de FCR que fijan el disparo de recepción en un carácter */
+#define UART_FCR_TRG_LEV0 (0 << 6)
+/** @brief Bit de IER que habilita la interrupción por dato recibido */
+#define UART_IER_RBRINT (1 << 0)
+/** @brief Bit de IER que habilita la interrupción por FIFO de transmisión vacía */
+#define UART_IER_THREINT (1 << 1)
+/** @brief Bit de LSR que indica un dato recibido */
+#define UART_LSR_RDR (1 << 0)
+/** @brief Bit de LSR que indica la FIFO de transmisión vacía */
+#define UART_LSR_THRE (1 << 5)
+/** @brief Bit de LSR que indica que terminó de transmitirse el último bit */
+#define UART_LSR_TEMT (1 << 6)
+/** @brief Bit de TER1 que habilita el transmisor */
+#define UART_TER1_TXEN (1 << 7)
+
+/** @brief Bloques de registros de los UART simulados */
+#define LPC_USART0 (&sim_uart[0])
+#define LPC_UART1  (&sim_uart[1])
+#define LPC_USART2 (&sim_uart[2])
+#define LPC_USART3 (&sim_uart[3])
+
+/** @brief Cantidad de controladores SSP simulados */
+#define SIM_SSPS 2
+
+/** @brief Profundidad de la FIFO de transmisión de cada SSP */
+#define SIM_SSP_FIFO 8
+
+/** @brief Cantidad de bytes desplazados por cada SSP que se guardan hasta que los retira SimSspRead() */
+#define SIM_SSP_LOG 256
+
+/** @brief Bits de CR0 que seleccionan datos de 8 bits */
+#define SSP_BITS_8 (7u << 0)
+/** @brief Bits de CR0 que seleccionan el formato de trama SPI */
+#define SSP_FRAMEFORMAT_SPI (0u << 4)
+/** @brief Bits de CR0 que seleccionan el modo 0 de SPI: reloj inactivo en bajo y captura en el primer flanco */
+#define SSP_CLOCK_CPHA0_CPOL0 (0u << 6)
+/** @brief Alias de LPCOpen para el modo 0 de SPI */
+#define SSP_CLOCK_MODE0 SSP_CLOCK_CPHA0_CPOL0
+/** @brief Bit de CR1 que habilita el controlador */
+#define SSP_CR1_SSP_EN (1u << 1)
+/** @brief Bit de CR1 que selecciona el modo esclavo */
+#define SSP_CR1_SLAVE_EN (1u << 2)
+/** @brief Bit de DMACR que habilita los pedidos de DMA de recepción */
+#define SSP_DMA_RX (1u << 0)
+/** @brief Bit de DMACR que habilita los pedidos de DMA de transmisión */
+#define SSP_DMA_TX (1u << 1)
+/** @brief Bits de DMACR que habilitan los pedidos de DMA de ambos sentidos */
+#define SSP_DMA_BITMASK (SSP_DMA_RX | SSP_DMA_TX)
+
+/** @brief Bloques de registros de los SSP simulados */
+#define LPC_SSP0 (&sim_ssp[0])
+#define LPC_SSP1 (&sim_ssp[1])
+
+/** @brief Cantidad de canales del controlador de DMA */
+#define GPDMA_NUMBER_CHANNELS 8
+
+/** @brief Bit de CONFIG de un canal que lo habilita */
+#define GPDMA_DMACCxConfig_E (1u << 0)
+/** @brief Campo de CONFIG de un canal con el periférico de origen */
+#define GPDMA_DMACCxConfig_SrcPeripheral(n) (((n) & 0x1F) << 1)
+/** @brief Campo de CONFIG de un canal con el periférico de destino */
+#define GPDMA_DMACCxConfig_DestPeripheral(n) (((n) & 0x1F) << 6)
+/** @brief Campo de CONFIG de un canal con el tipo de transferencia */
+#define GPDMA_DMACCxConfig_TransferType(n) (((n) & 0x7) << 11)
+/** @brief Bit de CONFIG de un canal que habilita la interrupción por fin de transferencia */
+#define GPDMA_DMACCxConfig_ITC (1u << 15)
+/** @brief Campo de CONTROL de un canal con la cantidad de transferencias */
+#define GPDMA_DMACCxControl_TransferSize(n) ((n) & 0xFFF)
+/** @brief Bit de CONTROL de un canal que pide la interrupción al terminar */
+#define GPDMA_DMACCxControl_I (1u << 31)
+
+/** @brief Conexiones de los periféricos con el controlador de DMA, con los nombres de LPCOpen */
+#define GPDMA_CONN_MEMORY   0
+#define GPDMA_CONN_SSP0_Tx  9
+#define GPDMA_CONN_SSP0_Rx  10
+#define GPDMA_CONN_SSP1_Tx  11
+#define GPDMA_CONN_SSP1_Rx  12
+#define GPDMA_CONN_UART0_Tx 13
+#define GPDMA_CONN_UART0_Rx 14
+#define GPDMA_CONN_UART1_Tx 15
+#define GPDMA_CONN_UART1_Rx 16
+#define GPDMA_CONN_UART2_Tx 17
+#define GPDMA_CONN_UART2_Rx 18
+#define GPDMA_CONN_UART3_Tx 19
+#define GPDMA_CONN_UART3_Rx 20
+
+/** @brief Bloque de registros del controlador de DMA simulado */
+#define LPC_GPDMA (&sim_gpdma)
+
+/** @brief Tamaño en bytes de una página de la EEPROM */
+#define EEPROM_PAGE_SIZE 128
+/** @brief Cantidad de páginas de la EEPROM */
+#define EEPROM_PAGE_NUM 128
+/** @brief Dirección de la EEPROM en el mapa de memoria, que en el backend simulado es un arreglo en RAM */
+#define EEPROM_START ((uintptr_t)sim_eeprom_memory)
+/** @brief Dirección de un byte de la EEPROM, con la misma definición que en LPCOpen */
+#define EEPROM_ADDRESS(page, offset) (EEPROM_START + (EEPROM_PAGE_SIZE * (page)) + (offset))
+/** @brief Comando que borra y programa las palabras escritas en el registro de página */
+#define EEPROM_CMD_ERASE_PRG_PAGE 6
+/** @brief Valor de AUTOPROG que deja la programación a cargo de la aplicación */
+#define EEPROM_AUTOPROG_OFF 0
+/** @brief Bit de INTSTAT que indica el fin de un borrado y programación */
+#define EEPROM_INT_ENDOFPROG (1u << 2)
+
+/** @brief Duración de un borrado y programación de una página de la EEPROM simulada, en microsegundos */
+#define SIM_EEPROM_PROGRAM_US 3000
+
+/** @brief Bloque de registros de la EEPROM simulada */
+#define LPC_EEPROM (&sim_eeprom)
+
+/** @brief Máscara de un canal de interrupción de pin */
+#define PININTCH(ch) (1 << (ch))
+
+/** @brief Bloque de registros de interrupciones de pin simulado */
+#define LPC_GPIO_PIN_INT (&sim_pin_int)
+
+/** @brief Registros del temporizador SysTick simulado */
+#define SysTick (&sim_systick)
+
+/** @brief Registros de depuración del núcleo simulados */
+#define CoreDebug (&sim_core_debug)
+
+/** @brief Registros DWT simulados. Cada acceso actualiza CYCCNT a partir del contador de ciclos virtual */
+#define DWT (SimDwt())
+
+/** @brief Bloque de registros GPIO simulado */
+#define LPC_GPIO_PORT (&sim_gpio_port)
+
+/** @brief Bloque de registros SCU simulado */
+#define LPC_SCU (&sim_scu)
+
+/** @brief Escribe un registro a través de un puntero precalculado, aplicando la semántica del periférico simulado */
+#define CHIP_REG_WRITE(reg, value) SimRegisterWrite((reg), (value))
+
+/** @brief Lee un registro a través de un puntero precalculado, aplicando la semántica del periférico simulado */
+#define CHIP_REG_READ(reg) SimRegisterRead(reg)
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Registros del puerto GPIO, con la misma disposición que en LPCOpen.
+ */
+typedef struct {
+    __IO uint8_t B[128][32]; /**< Registros de byte por pin */
+    __IO uint32_t W[32][32]; /**< Registros de palabra por pin */
+    __IO uint32_t DIR[32];   /**< Registros de dirección por puerto */
+    __IO uint32_t MASK[32];  /**< Registros de máscara por puerto */
+    __IO uint32_t PIN[32];   /**< Registros de valor por puerto */
+    __IO uint32_t MPIN[32];  /**< Registros de valor enmascarado por puerto */
+    __IO uint32_t SET[32];   /**< Escritura: pone en uno los bits. Lectura: bits de salida del puerto */
+    __IO uint32_t CLR[32];   /**< Escritura: pone en cero los bits del puerto */
+    __IO uint32_t NOT[32];   /**< Escritura: invierte los bits del puerto */
+} LPC_GPIO_T;
+
+/**
+ * @brief Registros de configuración de pines del SCU.
+ */
+typedef struct {
+    __IO uint32_t SFSP[16][32]; /**< Modo y función de cada pin */
+    __IO uint32_t PINTSEL[2];   /**< Selección del pin de cada canal de interrupción de pin */
+} LPC_SCU_T;
+
+/**
+ * @brief Configuración de un pin del SCU para Chip_SCU_SetPinMuxing(), con la misma disposición que en LPCOpen.
+ */
+typedef struct {
+    uint8_t pingrp;    /**< Puerto del pin en el SCU */
+    uint8_t pinnum;    /**< Número del pin dentro del puerto */
+    uint16_t modefunc; /**< Modo y función del pin */
+} PINMUX_GRP_T;
+
+/**
+ * @brief Registros del bloque de interrupciones de pin (PINT), con la misma disposición que en LPCOpen.
+ */
+typedef struct {
+    __IO uint32_t ISEL; /**< Modo por flanco o por nivel */
+    __IO uint32_t IENR; /**< Habilitación por flanco ascendente */
+    __O uint32_t SIENR; /**< Escritura: habilita el flanco ascendente */
+    __O uint32_t CIENR; /**< Escritura: deshabilita el flanco ascendente */
+    __IO uint32_t IENF; /**< Habilitación por flanco descendente */
+    __O uint32_t SIENF; /**< Escritura: habilita el flanco descendente */
+    __O uint32_t CIENF; /**< Escritura: deshabilita el flanco descendente */
+    __IO uint32_t RISE; /**< Flancos ascendentes detectados. Escritura: los borra */
+    __IO uint32_t FALL; /**< Flancos descendentes detectados. Escritura: los borra */
+    __IO uint32_t IST;  /**< Estado de las interrupciones. Escritura: las borra */
+} LPC_PIN_INT_T;
+
+/**
+ * @brief Registros de un temporizador de 32 bits, con la misma disposición que en LPCOpen.
+ */
+typedef struct {
+    __IO uint32_t IR;           /**< Coincidencias pendientes. Escritura: las borra */
+    __IO uint32_t TCR;          /**< Control de la cuenta */
+    __IO uint32_t TC;           /**< Cuenta actual */
+    __IO uint32_t PR;           /**< Valor del preescalador */
+    __IO uint32_t PC;           /**< Cuenta actual del preescalador */
+    __IO uint32_t MCR;          /**< Acciones en cada coincidencia */
+    __IO uint32_t MR[4];        /**< Registros de comparación */
+    __IO uint32_t CCR;          /**< Control de captura */
+    __IO uint32_t CR[4];        /**< Registros de captura */
+    __IO uint32_t EMR;          /**< Control de las salidas de coincidencia */
+    __I uint32_t RESERVED0[12]; /**< Reservado */
+    __IO uint32_t CTCR;         /**< Modo contador o temporizador */
+} LPC_TIMER_T;
+
+/**
+ * @brief Registros de un UART, con la misma disposición que en LPCOpen hasta TER1.
+ */
+typedef struct {
+    union {
+        __IO uint32_t DLL; /**< Byte bajo del divisor, con DLAB en uno */
+        __O uint32_t THR;  /**< Escritura: dato a transmitir */
+        __I uint32_t RBR;  /**< Lectura: dato recibido */
+    };
+    union {
+        __IO uint32_t IER; /**< Habilitación de interrupciones */
+        __IO uint32_t DLM; /**< Byte alto del divisor, con DLAB en uno */
+    };
+    union {
+        __O uint32_t FCR; /**< Escritura: control de las FIFO */
+        __I uint32_t IIR; /**< Lectura: identificación de la interrupción pendiente */
+    };
+    __IO uint32_t LCR;  /**< Formato de los caracteres y acceso al divisor */
+    __IO uint32_t MCR;  /**< Control del módem */
+    __I uint32_t LSR;   /**< Estado de la línea */
+    __IO uint32_t MSR;  /**< Estado del módem */
+    __IO uint32_t SCR;  /**< Registro libre */
+    __IO uint32_t ACR;  /**< Control de la detección automática de velocidad */
+    __IO uint32_t ICR;  /**< Control IrDA */
+    __IO uint32_t FDR;  /**< Divisor fraccional */
+    __IO uint32_t OSR;  /**< Sobremuestreo */
+    __IO uint32_t TER1; /**< Habilitación del transmisor */
+} LPC_USART_T;
+
+/**
+ * @brief Registros de un controlador SSP, con la misma disposición que en LPCOpen.
+ */
+typedef struct {
+    __IO uint32_t CR0;   /**< Formato de las tramas y divisor del reloj serie */
+    __IO uint32_t CR1;   /**< Habilitación y modo maestro o esclavo */
+    __IO uint32_t DR;    /**< Escritura: dato a transmitir. Lectura: dato recibido */
+    __I uint32_t SR;     /**< Estado de las FIFO y del controlador */
+    __IO uint32_t CPSR;  /**< Preescalador del reloj */
+    __IO uint32_t IMSC;  /**< Habilitación de interrupciones */
+    __I uint32_t RIS;    /**< Interrupciones sin enmascarar */
+    __I uint32_t MIS;    /**< Interrupciones enmascaradas */
+    __O uint32_t ICR;    /**< Escritura: borra interrupciones */
+    __IO uint32_t DMACR; /**< Habilitación de los pedidos de DMA */
+} LPC_SSP_T;
+
+/**
+ * @brief Bits de estado de un controlador SSP, con los nombres de LPCOpen.
+ */
+typedef enum {
+    SSP_STAT_TFE = (1 << 0), /**< FIFO de transmisión vacía */
+    SSP_STAT_TNF = (1 << 1), /**< FIFO de transmisión no llena */
+    SSP_STAT_RNE = (1 << 2), /**< FIFO de recepción no vacía */
+    SSP_STAT_RFF = (1 << 3), /**< FIFO de recepción llena */
+    SSP_STAT_BSY = (1 << 4), /**< El controlador está transmitiendo o recibiendo una trama */
+} SSP_STATUS_T;
+
+/**
+ * @brief Registros de un canal del controlador de DMA, con la misma disposición que en LPCOpen.
+ */
+typedef struct {
+    __IO uint32_t SRCADDR;     /**< Dirección de origen */
+    __IO uint32_t DESTADDR;    /**< Dirección de destino */
+    __IO uint32_t LLI;         /**< Siguiente elemento de la lista enlazada */
+    __IO uint32_t CONTROL;     /**< Cantidad, anchos y ráfagas de la transferencia */
+    __IO uint32_t CONFIG;      /**< Habilitación, tipo de transferencia y periféricos */
+    __I uint32_t RESERVED1[3]; /**< Reservado */
+} GPDMA_CH_T;
+
+/**
+ * @brief Registros del controlador de DMA, con la misma disposición que en LPCOpen.
+ */
+typedef struct {
+    __I uint32_t INTSTAT;                 /**< Canales con alguna interrupción pendiente */
+    __I uint32_t INTTCSTAT;               /**< Canales con la interrupción de fin de transferencia pendiente */
+    __O uint32_t INTTCCLEAR;              /**< Escritura: borra el fin de transferencia de los canales */
+    __I uint32_t INTERRSTAT;              /**< Canales con la interrupción de error pendiente */
+    __O uint32_t INTERRCLR;               /**< Escritura: borra el error de los canales */
+    __I uint32_t RAWINTTCSTAT;            /**< Fin de transferencia de cada canal, sin enmascarar */
+    __I uint32_t RAWINTERRSTAT;           /**< Error de cada canal, sin enmascarar */
+    __I uint32_t ENBLDCHNS;               /**< Canales habilitados */
+    __IO uint32_t SOFTBREQ;               /**< Pedidos de ráfaga por software */
+    __IO uint32_t SOFTSREQ;               /**< Pedidos simples por software */
+    __IO uint32_t SOFTLBREQ;              /**< Pedidos de última ráfaga por software */
+    __IO uint32_t SOFTLSREQ;              /**< Pedidos de último dato por software */
+    __IO uint32_t CONFIG;                 /**< Habilitación del controlador */
+    __IO uint32_t SYNC;                   /**< Sincronización de los pedidos */
+    __I uint32_t RESERVED0[50];           /**< Reservado */
+    GPDMA_CH_T CH[GPDMA_NUMBER_CHANNELS]; /**< Registros de cada canal */
+} LPC_GPDMA_T;
+
+/**
+ * @brief Registros del controlador de la EEPROM, con la misma disposición que en LPCOpen.
+ */
+typedef struct {
+    __IO uint32_t CMD;            /**< Comando a ejecutar */
+    __I uint32_t RESERVED0;       /**< Reservado */
+    __IO uint32_t RWSTATE;        /**< Estados de espera de lectura y escritura */
+    __IO uint32_t AUTOPROG;       /**< Programación automática del registro de página */
+    __IO uint32_t WSTATE;         /**< Estados de espera de la programación */
+    __IO uint32_t CLKDIV;         /**< Divisor del reloj de la EEPROM */
+    __IO uint32_t PWRDWN;         /**< Modo de bajo consumo */
+    __I uint32_t RESERVED2[1007]; /**< Reservado */
+    __O uint32_t INTENCLR;        /**< Escritura: deshabilita interrupciones */
+    __O uint32_t INTENSET;        /**< Escritura: habilita interrupciones */
+    __I uint32_t INTSTAT;         /**< Interrupciones pendientes */
+    __I uint32_t INTEN;           /**< Interrupciones habilitadas */
+    __O uint32_t INTSTATCLR;      /**< Escritura: borra interrupciones pendientes */
+    __O uint32_t INTSTATSET;      /**< Escritura: marca interrupciones pendientes */
+} LPC_EEPROM_T;
+
+/**
+ * @brief Tipos de transferencia del controlador de DMA, con los nombres de LPCOpen.
+ */
+typedef enum {
+    GPDMA_TRANSFERTYPE_M2M_CONTROLLER_DMA = 0, /**< De memoria a memoria */
+    GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA = 1, /**< De memoria a un periférico */
+    GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA = 2, /**< De un periférico a memoria */
+    GPDMA_TRANSFERTYPE_P2P_CONTROLLER_DMA = 3, /**< De un periférico a otro */
+} GPDMA_FLOW_CONTROL_T;
+
+/**
+ * @brief Elemento de una lista enlazada de transferencias de DMA, con los campos de LPCOpen.
+ *
+ * Las direcciones ocupan un `uintptr_t`, como en Chip_GPDMA_Transfer(), para que en el backend simulado entren los
+ * punteros de 64 bits. Un elemento que se apunta a sí mismo repite la misma transferencia indefinidamente.
+ */
+typedef struct {
+    uintptr_t src; /**< Dirección de origen */
+    uintptr_t dst; /**< Dirección de destino */
+    uintptr_t lli; /**< Siguiente elemento de la lista, o cero si es el último */
+    uint32_t ctrl; /**< Valor del registro CONTROL del canal */
+} DMA_TransferDescriptor_t;
+
+/**
+ * @brief Estado de un indicador, con los nombres de LPCOpen.
+ */
+typedef enum {
+    RESET = 0, /**< Indicador en cero */
+    SET = 1,   /**< Indicador en uno */
+} FlagStatus;
+
+/**
+ * @brief Resultado de una operación, con los nombres de LPCOpen.
+ */
+typedef enum {
+    ERROR = 0,   /**< La operación falló */
+    SUCCESS = 1, /**< La operación terminó correctamente */
+} Status;
+
+/**
+ * @brief Relojes de periféricos que consulta el proyecto.
+ */
+typedef enum {
+    CLK_MX_TIMER0, /**< Reloj del temporizador 0 */
+    CLK_MX_TIMER1, /**< Reloj del temporizador 1 */
+    CLK_MX_TIMER2, /**< Reloj del temporizador 2 */
+    CLK_MX_TIMER3, /**< Reloj del temporizador 3 */
+    CLK_MX_SSP0,   /**< Reloj del SSP 0 */
+    CLK_MX_SSP1,   /**< Reloj del SSP 1 */
+} CHIP_CCU_CLK_T;
+
+/**
+ * @brief Números de las interrupciones del microcontrolador modeladas por el backend simulado.
+ */
+typedef enum {
+    DMA_IRQn = 2,       /**< Interrupción del controlador de DMA */
+    TIMER0_IRQn = 12,   /**< Interrupción del temporizador 0 */
+    TIMER1_IRQn = 13,   /**< Interrupción del temporizador 1 */
+    TIMER2_IRQn = 14,   /**< Interrupción del temporizador 2 */
+    TIMER3_IRQn = 15,   /**< Interrupción del temporizador 3 */
+    USART0_IRQn = 24,   /**< Interrupción del USART 0 */
+    UART1_IRQn = 25,    /**< Interrupción del UART 1 */
+    USART2_IRQn = 26,   /**< Interrupción del USART 2 */
+    USART3_IRQn = 27,   /**< Interrupción del USART 3 */
+    PIN_INT0_IRQn = 32, /**< Interrupción del canal 0 de interrupción de pin */
+    PIN_INT1_IRQn = 33, /**< Interrupción del canal 1 de interrupción de pin */
+    PIN_INT2_IRQn = 34, /**< Interrupción del canal 2 de interrupción de pin */
+    PIN_INT3_IRQn = 35, /**< Interrupción del canal 3 de interrupción de pin */
+    PIN_INT4_IRQn = 36, /**< Interrupción del canal 4 de interrupción de pin */
+    PIN_INT5_IRQn = 37, /**< Interrupción del canal 5 de interrupción de pin */
+    PIN_INT6_IRQn = 38, /**< Interrupción del canal 6 de interrupción de pin */
+    PIN_INT7_IRQn = 39, /**< Interrupción del canal 7 de interrupción de pin */
+} IRQn_Type;
+
+/**
+ * @brief Registros del temporizador SysTick del núcleo Cortex-M.
+ */
+typedef struct {
+    __IO uint32_t CTRL; /**< Control y estado */
+    __IO uint32_t LOAD; /**< Valor de recarga */
+    __IO uint32_t VAL;  /**< Valor actual */
+    __I uint32_t CALIB; /**< Calibración */
+} SysTick_Type;
+
+/**
+ * @brief Registros de control de depuración del núcleo Cortex-M.
+ */
+typedef struct {
+    __IO uint32_t DEMCR; /**< Control de excepciones y monitor de depuración */
+} CoreDebug_Type;
+
+/**
+ * @brief Registros de la unidad DWT del núcleo Cortex-M.
+ */
+typedef struct {
+    __IO uint32_t CTRL;   /**< Control */
+    __IO uint32_t CYCCNT; /**< Contador de ciclos */
+} DWT_Type;
+
+/**
+ * @brief Contadores de accesos a registros del backend simulado.
+ */
+typedef struct sim_chip_stats_s {
+    uint32_t reads;  /**< Cantidad de lecturas de registros */
+    uint32_t writes; /**< Cantidad de escrituras de registros */
+} sim_chip_stats_t;
+
+/**
+ * @brief Contadores de uso de la EEPROM del backend simulado.
+ */
+typedef struct sim_eeprom_stats_s {
+    uint32_t programs; /**< Cantidad de borrados y programaciones de páginas */
+    uint32_t words;    /**< Cantidad de palabras programadas */
+} sim_eeprom_stats_t;
+
+/**
+ * @brief Función que el simulador ejecuta en un ciclo virtual programado.
+ *
+ * @param object  Objeto indicado al programar la acción.
+ */
+typedef void (*sim_callback_t)(void * object);
+
+/**
+ * @brief Función que el simulador avisa cada vez que cambia el nivel de algún pin de un puerto GPIO.
+ *
+ * @param object  Objeto indicado al instalar el observador.
+ * @param port    Número de puerto GPIO.
+ * @param level   Nuevo nivel de todos los pines del puerto.
+ */
+typedef void (*sim_port_observer_t)(void * object, uint8_t port, uint32_t level);
+
+/* === Public variable declarations ================================================================================ */
+
+/** @brief Memoria que respalda los registros GPIO simulados */
+extern LPC_GPIO_T sim_gpio_port;
+
+/** @brief Memoria que respalda los registros SCU simulados */
+extern LPC_SCU_T sim_scu;
+
+/** @brief Memoria que respalda los registros de interrupciones de pin simulados */
+extern LPC_PIN_INT_T sim_pin_int;
+
+/** @brief Memoria que respalda los registros de los temporizadores simulados */
+extern LPC_TIMER_T sim_timer[SIM_TIMERS];
+
+/** @brief Memoria que respalda los registros de los UART simulados */
+extern LPC_USART_T sim_uart[SIM_UARTS];
+
+/** @brief Memoria que respalda los registros de los SSP simulados */
+extern LPC_SSP_T sim_ssp[SIM_SSPS];
+
+/** @brief Memoria que respalda los registros del controlador de DMA simulado */
+extern LPC_GPDMA_T sim_gpdma;
+
+/** @brief Memoria que respalda los registros de la EEPROM simulada */
+extern LPC_EEPROM_T sim_eeprom;
+
+/** @brief Contenido de la EEPROM simulada, que se lee en forma directa y se escribe a través del registro de página */
+extern uint32_t sim_eeprom_memory[EEPROM_PAGE_NUM * EEPROM_PAGE_SIZE / sizeof(uint32_t)];
+
+/** @brief Memoria que respalda los registros del SysTick simulado */
+extern SysTick_Type sim_systick;
+
+/** @brief Memoria que respalda los registros de depuración simulados */
+extern CoreDebug_Type sim_core_debug;
+
+/** @brief Frecuencia del núcleo en Hz */
+extern uint32_t SystemCoreClock;
+
+/* === Public function declarations ================================================================================ */
+
+void Chip_GPIO_Init(LPC_GPIO_T * pGPIO);
+void Chip_GPIO_SetPinState(LPC_GPIO_T * pGPIO, uint8_t port, uint8_t pin, bool setting);
+bool Chip_GPIO_GetPinState(LPC_GPIO_T * pGPIO, uint8_t port, uint8_t pin);
+bool Chip_GPIO_ReadPortBit(LPC_GPIO_T * pGPIO, uint32_t port, uint8_t pin);
+void Chip_GPIO_SetPinDIR(LPC_GPIO_T * pGPIO, uint8_t port, uint8_t pin, bool output);
+void Chip_GPIO_SetPortDIR(LPC_GPIO_T * pGPIO, uint8_t port, uint32_t pinMask, bool outSet);
+uint32_t Chip_GPIO_GetPortDIR(LPC_GPIO_T * pGPIO, uint8_t port);
+void Chip_GPIO_SetPortValue(LPC_GPIO_T * pGPIO, uint8_t port, uint32_t value);
+uint32_t Chip_GPIO_GetPortValue(LPC_GPIO_T * pGPIO, uint8_t port);
+void Chip_GPIO_SetPortMask(LPC_GPIO_T * pGPIO, uint8_t port, uint32_t mask);
+void Chip_GPIO_SetMaskedPortValue(LPC_GPIO_T * pGPIO, uint8_t port, uint32_t value);
+uint32_t Chip_GPIO_GetMaskedPortValue(LPC_GPIO_T * pGPIO, uint8_t port);
+void Chip_GPIO_SetValue(LPC_GPIO_T * pGPIO, uint8_t port, uint32_t bitValue);
+void Chip_GPIO_ClearValue(LPC_GPIO_T * pGPIO, uint8_t port, uint32_t bitValue);
+void Chip_GPIO_SetPortToggle(LPC_GPIO_T * pGPIO, uint8_t port, uint32_t pins);
+void Chip_GPIO_SetPinToggle(LPC_GPIO_T * pGPIO, uint8_t port, uint8_t pin);
+void Chip_SCU_PinMuxSet(uint8_t port, uint8_t pin, uint16_t modefunc);
+void Chip_SCU_SetPinMuxing(const PINMUX_GRP_T * pinArray, uint32_t arrayLength);
+void Chip_SCU_GPIOIntPinSel(uint8_t PortSel, uint8_t PortNum, uint8_t PinNum);
+void Chip_PININT_Init(LPC_PIN_INT_T * pPININT);
+void Chip_PININT_SetPinModeEdge(LPC_PIN_INT_T * pPININT, uint32_t pins);
+void Chip_PININT_EnableIntHigh(LPC_PIN_INT_T * pPININT, uint32_t pins);
+void Chip_PININT_DisableIntHigh(LPC_PIN_INT_T * pPININT, uint32_t pins);
+void Chip_PININT_EnableIntLow(LPC_PIN_INT_T * pPININT, uint32_t pins);
+void Chip_PININT_DisableIntLow(LPC_PIN_INT_T * pPININT, uint32_t pins);
+uint32_t Chip_PININT_GetRiseStates(LPC_PIN_INT_T * pPININT);
+void Chip_PININT_ClearRiseStates(LPC_PIN_INT_T * pPININT, uint32_t pins);
+uint32_t Chip_PININT_GetFallStates(LPC_PIN_INT_T * pPININT);
+void Chip_PININT_ClearFallStates(LPC_PIN_INT_T * pPININT, uint32_t pins);
+uint32_t Chip_PININT_GetIntStatus(LPC_PIN_INT_T * pPININT);
+void Chip_PININT_ClearIntStatus(LPC_PIN_INT_T * pPININT, uint32_t pins);
+void Chip_TIMER_Init(LPC_TIMER_T * pTMR);
+void Chip_TIMER_Enable(LPC_TIMER_T * pTMR);
+void Chip_TIMER_Disable(LPC_TIMER_T * pTMR);
+void Chip_TIMER_Reset(LPC_TIMER_T * pTMR);
+uint32_t Chip_TIMER_ReadCount(LPC_TIMER_T * pTMR);
+void Chip_TIMER_PrescaleSet(LPC_TIMER_T * pTMR, uint32_t prescale);
+void Chip_TIMER_SetMatch(LPC_TIMER_T * pTMR, int8_t matchnum, uint32_t matchval);
+void Chip_TIMER_MatchEnableInt(LPC_TIMER_T * pTMR, int8_t matchnum);
+void Chip_TIMER_MatchDisableInt(LPC_TIMER_T * pTMR, int8_t matchnum);
+void Chip_TIMER_ResetOnMatchEnable(LPC_TIMER_T * pTMR, int8_t matchnum);
+void Chip_TIMER_ResetOnMatchDisable(LPC_TIMER_T * pTMR, int8_t matchnum);
+bool Chip_TIMER_MatchPending(LPC_TIMER_T * pTMR, int8_t matchnum);
+void Chip_TIMER_ClearMatch(LPC_TIMER_T * pTMR, int8_t matchnum);
+uint32_t Chip_Clock_GetRate(CHIP_CCU_CLK_T clk);
+void Chip_UART_Init(LPC_USART_T * pUART);
+uint32_t Chip_UART_SetBaud(LPC_USART_T * pUART, uint32_t baudrate);
+void Chip_UART_ConfigData(LPC_USART_T * pUART, uint32_t config);
+void Chip_UART_SetupFIFOS(LPC_USART_T * pUART, uint32_t fcr);
+void Chip_UART_TXEnable(LPC_USART_T * pUART);
+void Chip_UART_IntEnable(LPC_USART_T * pUART, uint32_t intMask);
+void Chip_UART_IntDisable(LPC_USART_T * pUART, uint32_t intMask);
+uint32_t Chip_UART_ReadIntIDReg(LPC_USART_T * pUART);
+uint32_t Chip_UART_ReadLineStatus(LPC_USART_T * pUART);
+void Chip_UART_SendByte(LPC_USART_T * pUART, uint8_t data);
+uint8_t Chip_UART_ReadByte(LPC_USART_T * pUART);
+void Chip_SSP_Init(LPC_SSP_T * pSSP);
+void Chip_SSP_SetFormat(LPC_SSP_T * pSSP, uint32_t bits, uint32_t frameFormat, uint32_t clockMode);
+void Chip_SSP_SetMaster(LPC_SSP_T * pSSP, bool master);
+void Chip_SSP_SetBitRate(LPC_SSP_T * pSSP, uint32_t bitRate);
+void Chip_SSP_Enable(LPC_SSP_T * pSSP);
+void Chip_SSP_Disable(LPC_SSP_T * pSSP);
+void Chip_SSP_DMA_Enable(LPC_SSP_T * pSSP);
+void Chip_SSP_DMA_Disable(LPC_SSP_T * pSSP);
+FlagStatus Chip_SSP_GetStatus(LPC_SSP_T * pSSP, SSP_STATUS_T Stat);
+void Chip_SSP_SendFrame(LPC_SSP_T * pSSP, uint16_t tx_data);
+void Chip_GPDMA_Init(LPC_GPDMA_T * pGPDMA);
+uint8_t Chip_GPDMA_GetFreeChannel(LPC_GPDMA_T * pGPDMA, uint32_t PeripheralConnection_ID);
+Status Chip_GPDMA_Transfer(LPC_GPDMA_T * pGPDMA, uint8_t ChannelNum, uintptr_t src, uintptr_t dst,
+                           GPDMA_FLOW_CONTROL_T TransferType, uint32_t Size);
+Status Chip_GPDMA_InitDescriptor(LPC_GPDMA_T * pGPDMA, DMA_TransferDescriptor_t * DMADescriptor, uintptr_t src,
+                                 uintptr_t dst, uint32_t Size, GPDMA_FLOW_CONTROL_T TransferType,
+                                 const DMA_TransferDescriptor_t * NextDescriptor);
+Status Chip_GPDMA_SGTransfer(LPC_GPDMA_T * pGPDMA, uint8_t ChannelNum, const DMA_TransferDescriptor_t * DMADescriptor,
+                             GPDMA_FLOW_CONTROL_T TransferType);
+Status Chip_GPDMA_Interrupt(LPC_GPDMA_T * pGPDMA, uint8_t ch);
+void Chip_GPDMA_Stop(LPC_GPDMA_T * pGPDMA, uint8_t ChannelNum);
+void Chip_EEPROM_Init(LPC_EEPROM_T * pEEPROM);
+void Chip_EEPROM_SetAutoProg(LPC_EEPROM_T * pEEPROM, uint32_t mode);
+void Chip_EEPROM_SetCmd(LPC_EEPROM_T * pEEPROM, uint32_t cmd);
+uint32_t Chip_EEPROM_GetIntStatus(LPC_EEPROM_T * pEEPROM);
+void Chip_EEPROM_ClearIntStatus(LPC_EEPROM_T * pEEPROM, uint32_t mask);
+void NVIC_EnableIRQ(IRQn_Type IRQn);
+void NVIC_DisableIRQ(IRQn_Type IRQn);
+void NVIC_SetPendingIRQ(IRQn_Type IRQn);
+void NVIC_ClearPendingIRQ(IRQn_Type IRQn);
+void SystemCoreClockUpdate(void);
+uint32_t SysTick_Config(uint32_t ticks);
+void __WFI(void);
+void __disable_irq(void);
+void __enable_irq(void);
+void __DMB(void);
+
+/**
+ * @brief Rutina de servicio de la interrupción del SysTick, provista por la aplicación.
+ *
+ * El backend simulado la invoca cuando el contador de ciclos virtual alcanza el vencimiento del SysTick y las
+ * interrupciones están habilitadas.
+ */
+void SysTick_Handler(void);
+
+/**
+ * @brief Rutinas de servicio de las interrupciones de pin, provistas por la aplicación.
+ *
+ * El backend simulado las invoca cuando un cambio en un pin seleccionado en un canal produce un flanco habilitado, la
+ * interrupción está habilitada en el NVIC y las interrupciones no están enmascaradas.
+ */
+void GPIO0_IRQHandler(void);
+void GPIO1_IRQHandler(void);
+void GPIO2_IRQHandler(void);
+void GPIO3_IRQHandler(void);
+void GPIO4_IRQHandler(void);
+void GPIO5_IRQHandler(void);
+void GPIO6_IRQHandler(void);
+void GPIO7_IRQHandler(void);
+
+/**
+ * @brief Rutinas de servicio de las interrupciones de los temporizadores, provistas por la aplicación.
+ *
+ * El backend simulado las invoca cuando la cuenta alcanza un registro de comparación con la interrupción habilitada
+ * en MCR, la interrupción está habilitada en el NVIC y las interrupciones no están enmascaradas.
+ */
+void TIMER0_IRQHandler(void);
+void TIMER1_IRQHandler(void);
+void TIMER2_IRQHandler(void);
+void TIMER3_IRQHandler(void);
+
+/**
+ * @brief Rutinas de servicio de las interrupciones de los UART, provistas por la aplicación.
+ *
+ * El backend simulado las invoca mientras la interrupción por FIFO de transmisión vacía está habilitada en IER, la
+ * FIFO está vacía, la interrupción está habilitada en el NVIC y las interrupciones no están enmascaradas.
+ */
+void UART0_IRQHandler(void);
+void UART1_IRQHandler(void);
+void UART2_IRQHandler(void);
+void UART3_IRQHandler(void);
+
+/**
+ * @brief Rutina de servicio de la interrupción del controlador de DMA, provista por la aplicación.
+ *
+ * El backend simulado la invoca mientras algún canal con la interrupción de fin de transferencia habilitada en su
+ * CONFIG terminó su transferencia, la interrupción está habilitada en el NVIC y las interrupciones no están
+ * enmascaradas.
+ */
+void DMA_IRQHandler(void);
+
+/**
+ * @brief Vuelve los registros, las entradas externas, los contadores, las interrupciones y el ciclo virtual a su
+ * estado de reset. El contenido de la EEPROM se conserva.
+ */
+void SimChipReset(void);
+
+/**
+ * @brief Escribe un registro de 32 bits de un periférico simulado aplicando su semántica de hardware.
+ *
+ * @param reg    Dirección del registro dentro de la memoria de un periférico simulado.
+ * @param value  Valor a escribir.
+ */
+void SimRegisterWrite(volatile uint32_t * reg, uint32_t value);
+
+/**
+ * @brief Lee un registro de 32 bits de un periférico simulado aplicando su semántica de hardware.
+ *
+ * @param reg  Dirección del registro dentro de la memoria de un periférico simulado.
+ * @return Valor que devolvería el hardware.
+ */
+uint32_t SimRegisterRead(const volatile uint32_t * reg);
+
+/**
+ * @brief Fija el nivel eléctrico que un dispositivo externo impone sobre un pin configurado como entrada.
+ *
+ * Si el cambio produce un flanco habilitado en un canal de interrupción de pin, la interrupción se atiende antes de
+ * retornar, como lo haría el hardware.
+ *
+ * @param port   Número de puerto GPIO.
+ * @param pin    Número de bit dentro del puerto.
+ * @param level  `true` para nivel alto, `false` para nivel bajo.
+ */
+void SimGpioSetInput(uint8_t port, uint8_t pin, bool level);
+
+/**
+ * @brief Programa una acción para un ciclo virtual, como lo haría un dispositivo externo.
+ *
+ * La acción se ejecuta cuando el contador virtual alcanza el ciclo indicado, aunque el núcleo esté dormido en __WFI().
+ * Puede cambiar entradas con SimGpioSetInput() y programar otras acciones.
+ *
+ * @param cycle     Ciclo virtual en el que se ejecuta. Si ya pasó se ejecuta en el próximo acceso a un registro.
+ * @param callback  Función a ejecutar.
+ * @param object    Objeto que recibe la función.
+ * @return `true` si se programó, `false` si no quedan lugares.
+ */
+bool SimScheduleCallback(uint64_t cycle, sim_callback_t callback, void * object);
+
+/**
+ * @brief Instala la función que se avisa cada vez que cambia el nivel de algún pin de un puerto GPIO.
+ *
+ * @param observer  Función a avisar, o `NULL` para no avisar.
+ * @param object    Objeto que recibe la función.
+ */
+void SimSetPortObserver(sim_port_observer_t observer, void * object);
+
+/**
+ * @brief Devuelve los niveles de salida de un puerto sin contabilizar el acceso.
+ *
+ * @param port  Número de puerto GPIO.
+ * @return Valor del latch de salida del puerto.
+ */
+uint32_t SimGpioGetOutputs(uint8_t port);
+
+/**
+ * @brief Fija el archivo en el que se escriben los bytes que transmite un UART.
+ *
+ * Cada byte se escribe en el archivo al entrar en la FIFO de transmisión. Los tiempos de transmisión se modelan según
+ * el divisor y el formato configurados, de modo que LSR informa la FIFO llena o vacía como lo haría el hardware.
+ *
+ * @param uart  Bloque de registros del UART.
+ * @param file  Archivo abierto para escritura, o `NULL` para descartar los bytes.
+ */
+void SimUartSetOutput(LPC_USART_T * uart, FILE * file);
+
+/**
+ * @brief Envía bytes a la línea de recepción de un UART.
+ *
+ * Los bytes esperan su turno y entran de a uno, separados por el tiempo de un carácter según el divisor y el formato
+ * configurados. Con los pedidos de DMA habilitados en FCR, cada byte lo copia en memoria el canal habilitado que lo
+ * recibe; si no hay ninguno, o sin pedidos de DMA, entra en la FIFO de recepción y se lee en RBR. Con la FIFO llena el
+ * byte se pierde, como en el hardware.
+ *
+ * @param uart  Bloque de registros del UART.
+ * @param data  Bytes a recibir.
+ * @param size  Cantidad de bytes.
+ * @return Cantidad de bytes aceptados, que es menor que `size` si no hay lugar para todos.
+ */
+size_t SimUartReceive(LPC_USART_T * uart, const uint8_t * data, size_t size);
+
+/**
+ * @brief Conecta un UART a una pseudoterminal nueva.
+ *
+ * Lo que el UART transmite se escribe en la pseudoterminal y lo que un programa escribe en ella llega a la línea de
+ * recepción del UART, que la lee cada `SIM_PTY_POLL_US` microsegundos de tiempo virtual. A partir de ese momento la
+ * simulación avanza al ritmo del tiempo real, para que el programa del otro lado vea los tiempos de la placa.
+ *
+ * @param uart  Bloque de registros del UART.
+ * @param link  Ruta de un enlace simbólico que se crea hacia la pseudoterminal, o `NULL` para no crearlo.
+ * @return Ruta de la pseudoterminal, o `NULL` si no se pudo crear.
+ */
+const char * SimUartOpenPty(LPC_USART_T * uart, const char * link);
+
+/**
+ * @brief Retira los bytes que un SSP terminó de desplazar por su salida serie.
+ *
+ * Los bytes se escriben en DR o los entrega un canal de DMA, y quedan disponibles recién cuando el último de sus bits
+ * salió por la línea de datos según el divisor configurado. Así un dispositivo externo modelado con
+ * SimSetPortObserver() puede verificar que una señal de carga no llegue antes que los datos.
+ *
+ * @param ssp   Bloque de registros del SSP.
+ * @param data  Arreglo donde se copian los bytes, en el orden en que salieron.
+ * @param size  Cantidad máxima de bytes a retirar.
+ * @return Cantidad de bytes copiados.
+ */
+size_t SimSspRead(LPC_SSP_T * ssp, uint8_t * data, size_t size);
+
+/**
+ * @brief Respalda el contenido de la EEPROM simulada en un archivo.
+ *
+ * Si el archivo existe, su contenido se carga en la EEPROM; si no, se crea. Desde ese momento cada borrado y
+ * programación escribe la página en el archivo, de modo que el contenido se conserva entre ejecuciones como en la
+ * placa. SimChipReset() no modifica el contenido de la EEPROM.
+ *
+ * @param path  Ruta del archivo.
+ * @return `true` si el archivo se pudo abrir o crear; `false` en caso contrario.
+ */
+bool SimEepromOpen(const char * path);
+
+/**
+ * @brief Obtiene los contadores de uso de la EEPROM acumulados desde el último reset.
+ *
+ * @param stats  Estructura donde se copian los contadores.
+ */
+void SimEepromGetStats(sim_eeprom_stats_t * stats);
+
+/**
+ * @brief Devuelve la cantidad de borrados y programaciones de una página de la EEPROM desde el último reset.
+ *
+ * @param page  Número de página.
+ * @return Cantidad de borrados y programaciones de la página.
+ */
+uint32_t SimEepromGetPageCycles(uint16_t page);
+
+/**
+ * @brief Conecta los periféricos simulados a los archivos y pseudoterminales que indican las variables de entorno.
+ *
+ * Con `RELOJ_TRACE` lo que transmite el UART de las trazas se guarda en el archivo indicado. Con `RELOJ_CONSOLE` el
+ * UART de la consola se conecta a una pseudoterminal, enlazada en la ruta indicada si no está vacía, y su nombre se
+ * informa en la salida de errores. Con `RELOJ_EEPROM` el contenido de la EEPROM se respalda en el archivo indicado.
+ *
+ * @param trace    Bloque de registros del UART de las trazas.
+ * @param console  Bloque de registros del UART de la consola.
+ */
+void SimConfigureFromEnvironment(LPC_USART_T * trace, LPC_USART_T * console);
+
+/**
+ * @brief Escribe texto con formato en el informe de la simulación, que sale por la salida estándar.
+ *
+ * @param format  Formato con la sintaxis de printf().
+ */
+void SimReportPrintf(const char * format, ...) __attribute__((format(printf, 1, 2)));
+
+/**
+ * @brief Devuelve la configuración SCU de un pin sin contabilizar el acceso.
+ *
+ * @param port  Grupo de pines del SCU.
+ * @param pin   Número de pin dentro del grupo.
+ * @return Valor del registro SFSP del pin.
+ */
+uint32_t SimScuGetMode(uint8_t port, uint8_t pin);
+
+/**
+ * @brief Devuelve el contador de ciclos virtual.
+ *
+ * @return Ciclos acumulados desde el último reset.
+ */
+uint64_t SimGetCycles(void);
+
+/**
+ * @brief Devuelve los ciclos virtuales que el núcleo pasó dormido esperando una interrupción en __WFI().
+ *
+ * Junto con SimGetCycles() permite calcular la fracción del tiempo en que el procesador estuvo inactivo.
+ *
+ * @return Ciclos en reposo acumulados desde el último reset.
+ */
+uint64_t SimGetSleepCycles(void);
+
+/**
+ * @brief Devuelve los registros DWT simulados con CYCCNT actualizado.
+ *
+ * @return Puntero a los registros DWT.
+ */
+DWT_Type * SimDwt(void);
+
+/**
+ * @brief Suma ciclos al contador virtual, para modelar trabajo que no accede a registros.
+ *
+ * Los vencimientos de los temporizadores que caen dentro del intervalo se atienden en el ciclo en que ocurren, y los
+ * ciclos que consumen sus rutinas de servicio se suman al intervalo.
+ *
+ * @param cycles  Cantidad de ciclos a sumar.
+ */
+void SimAddCycles(uint32_t cycles);
+
+/**
+ * @brief Obtiene los contadores de accesos a registros acumulados desde el último reset.
+ *
+ * @param stats  Estructura donde se copian los contadores.
+ */
+void SimGetStats(sim_chip_stats_t * stats);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHIP_H_ */
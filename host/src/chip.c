@@ -0,0 +1,2306 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file chip.c
+ ** @brief Implementación del backend simulado de los periféricos para compilar el proyecto en Linux
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+/* Las pseudoterminales y el modo crudo de las terminales no son parte de C11 */
+#define _GNU_SOURCE
+
+#include "chip.h"
+#include <fcntl.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+/* termios.h define los retardos de retorno de carro con los mismos nombres que los registros del SSP */
+#undef CR0
+#undef CR1
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief Desplazamiento de un registro dentro del bloque GPIO */
+#define GPIO_OFFSET(reg) ((size_t)((uintptr_t)(reg) - (uintptr_t)&sim_gpio_port))
+
+/** @brief Verifica si un desplazamiento cae dentro de un arreglo de registros por puerto */
+#define GPIO_IN(offset, field)                                                                                         \
+    ((offset) >= offsetof(LPC_GPIO_T, field) && (offset) < offsetof(LPC_GPIO_T, field) + sizeof(sim_gpio_port.field))
+
+/** @brief Número de puerto que corresponde a un desplazamiento dentro de un arreglo de registros por puerto */
+#define GPIO_PORT(offset, field) (((offset) - offsetof(LPC_GPIO_T, field)) / sizeof(uint32_t))
+
+/** @brief Cantidad máxima de acciones programadas con SimScheduleCallback() al mismo tiempo */
+#define SIM_CALLBACKS 16
+
+/** @brief Cantidad de palabras de 32 bits de una página de la EEPROM */
+#define EEPROM_PAGE_WORDS (EEPROM_PAGE_SIZE / sizeof(uint32_t))
+
+/** @brief Número de UART de una conexión del controlador de DMA, que alterna transmisión y recepción */
+#define DMA_CONN_UART(connection) (((connection) - GPDMA_CONN_UART0_Tx) / 2)
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Pseudoterminal conectada a un UART.
+ */
+typedef struct sim_pty_s {
+    int master;            /**< Descriptor del lado que usa el simulador */
+    int slave;             /**< Descriptor del lado del programa externo, que se mantiene abierto */
+    LPC_USART_T * uart;    /**< UART conectado */
+    uint64_t startCycle;   /**< Ciclo virtual en que se abrió */
+    struct timespec start; /**< Tiempo real en que se abrió */
+    char name[64];         /**< Ruta de la pseudoterminal */
+} sim_pty_t;
+
+/**
+ * @brief Acción programada para ejecutarse en un ciclo virtual.
+ */
+typedef struct sim_callback_entry_s {
+    uint64_t cycle;          /**< Ciclo virtual en el que vence */
+    sim_callback_t callback; /**< Función a ejecutar */
+    void * object;           /**< Objeto que recibe la función */
+} sim_callback_entry_t;
+
+/**
+ * @brief Byte desplazado por un SSP, con el ciclo en que salió su último bit.
+ */
+typedef struct sim_ssp_entry_s {
+    uint64_t cycle; /**< Ciclo virtual en el que terminó de salir */
+    uint8_t data;   /**< Valor del byte */
+} sim_ssp_entry_t;
+
+/**
+ * @brief Recepción de un UART: los bytes que esperan en la línea y los que ya llegaron a la FIFO.
+ */
+typedef struct sim_uart_rx_s {
+    uint8_t line[SIM_UART_RX_BUFFER]; /**< Bytes que esperan su turno en la línea, en orden de llegada */
+    uint16_t lineFirst;               /**< Posición en `line` del próximo byte */
+    uint16_t lineCount;               /**< Cantidad de bytes que esperan en la línea */
+    uint64_t lineDue;                 /**< Ciclo virtual en que termina de llegar el próximo byte */
+    uint8_t fifo[SIM_UART_FIFO];      /**< FIFO de recepción */
+    uint8_t fifoFirst;                /**< Posición en `fifo` del byte más antiguo */
+    uint8_t fifoCount;                /**< Cantidad de bytes en la FIFO */
+} sim_uart_rx_t;
+
+/**
+ * @brief Estado interno del hardware simulado que no es visible directamente en los registros.
+ */
+struct sim_state_s {
+    uint32_t latch[SIM_GPIO_PORTS];                /**< Valor de salida de cada puerto */
+    uint32_t input[SIM_GPIO_PORTS];                /**< Nivel impuesto externamente sobre cada puerto */
+    uint32_t level[SIM_GPIO_PORTS];                /**< Último nivel de cada puerto, para detectar flancos */
+    uint64_t nvicEnabled;                          /**< Interrupciones habilitadas en el NVIC */
+    uint64_t nvicPending;                          /**< Interrupciones pendientes en el NVIC */
+    sim_chip_stats_t stats;                        /**< Contadores de accesos */
+    uint64_t cycles;                               /**< Contador de ciclos virtual */
+    uint64_t sleepCycles;                          /**< Ciclos que el núcleo pasó dormido en __WFI() */
+    uint64_t tickDue;                              /**< Ciclo en el que vence el próximo período del SysTick */
+    bool tickPending;                              /**< Interrupción del SysTick pendiente de atención */
+    bool irqMasked;                                /**< Interrupciones deshabilitadas con __disable_irq() */
+    bool inIrq;                                    /**< Se está ejecutando una rutina de servicio de interrupción */
+    uint32_t dwtBase;                              /**< Ciclo virtual que corresponde a CYCCNT igual a cero */
+    uint32_t dwtLast;                              /**< Último valor de CYCCNT entregado, para detectar escrituras */
+    uint64_t timerSync[SIM_TIMERS];                /**< Ciclo hasta el que está al día la cuenta de cada temporizador */
+    bool timerWrap[SIM_TIMERS];                    /**< Una coincidencia pidió volver a cero en el próximo incremento */
+    uint32_t uartDivisor[SIM_UARTS];               /**< Divisor de cada UART, escrito con DLAB en uno */
+    uint64_t uartBusy[SIM_UARTS];                  /**< Ciclo en el que cada UART termina de transmitir lo que tiene */
+    FILE * uartOutput[SIM_UARTS];                  /**< Archivo que recibe los bytes transmitidos por cada UART */
+    uint64_t timerDue[SIM_TIMERS];                 /**< Próxima coincidencia de cada temporizador */
+    uint64_t uartDue[SIM_UARTS];                   /**< Próximo vaciado de la FIFO de cada UART */
+    bool uartDma[SIM_UARTS];                       /**< Pedidos de DMA habilitados en FCR de cada UART */
+    sim_uart_rx_t uartRx[SIM_UARTS];               /**< Recepción de cada UART */
+    uint64_t nextDue;                              /**< Menor vencimiento de periféricos y acciones programadas */
+    bool nextValid;                                /**< El menor vencimiento guardado sigue valiendo */
+    sim_callback_entry_t callbacks[SIM_CALLBACKS]; /**< Acciones programadas, ordenadas por ciclo de vencimiento */
+    uint8_t callbackCount;                         /**< Cantidad de acciones programadas */
+    sim_port_observer_t observer;                  /**< Función que se avisa cuando cambia el nivel de un puerto */
+    void * observerObject;                         /**< Objeto que se pasa al observador de los puertos */
+    uint64_t sspBusy[SIM_SSPS];                    /**< Ciclo en el que cada SSP termina de desplazar lo que tiene */
+    sim_ssp_entry_t sspLog[SIM_SSPS][SIM_SSP_LOG]; /**< Bytes desplazados por cada SSP que no se retiraron */
+    uint16_t sspFirst[SIM_SSPS];                   /**< Posición en `sspLog` del byte más antiguo de cada SSP */
+    uint16_t sspCount[SIM_SSPS];                   /**< Cantidad de bytes guardados de cada SSP */
+    uint8_t sspRxChannel[SIM_SSPS];                /**< Canal de DMA que recibe las tramas de cada SSP */
+    uint16_t sspRxPending[SIM_SSPS];               /**< Tramas que le faltan recibir a ese canal, o cero si no hay */
+    uintptr_t dmaSource[GPDMA_NUMBER_CHANNELS];    /**< Origen de la transferencia de cada canal de DMA */
+    uintptr_t dmaTarget[GPDMA_NUMBER_CHANNELS];    /**< Próxima dirección de destino de cada canal de DMA */
+    uintptr_t dmaNext[GPDMA_NUMBER_CHANNELS];      /**< Siguiente elemento de la lista de cada canal, o cero */
+    uint64_t dmaDue[GPDMA_NUMBER_CHANNELS];        /**< Ciclo en el que cada canal de DMA termina su transferencia */
+    uint32_t dmaTerminal;                          /**< Canales de DMA que terminaron, sin enmascarar */
+    uint32_t dmaClaimed;                           /**< Canales de DMA entregados por Chip_GPDMA_Transfer() */
+    uint32_t eepromLatch[EEPROM_PAGE_WORDS];       /**< Registro de página de la EEPROM */
+    uint32_t eepromWritten;                        /**< Palabras escritas en el registro de página */
+    uint16_t eepromPage;                           /**< Página de la última palabra escrita en el registro */
+    uint64_t eepromBusy;                           /**< Ciclo en el que termina la programación en curso, o cero */
+    uint32_t eepromStatus;                         /**< Interrupciones pendientes de la EEPROM */
+    uint32_t eepromEnabled;                        /**< Interrupciones habilitadas de la EEPROM */
+    uint32_t eepromCycles[EEPROM_PAGE_NUM];        /**< Borrados y programaciones de cada página */
+    sim_eeprom_stats_t eepromStats;                /**< Contadores de uso de la EEPROM */
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Contabiliza un acceso a un registro.
+ *
+ * @param write  `true` si el acceso es una escritura.
+ */
+static void CountAccess(bool write);
+
+/**
+ * @brief Calcula el valor que se lee en el registro PIN de un puerto.
+ *
+ * @param port  Número de puerto.
+ * @return Salidas para los bits configurados como salida y entradas externas para el resto.
+ */
+static uint32_t PortLevel(uint32_t port);
+
+/**
+ * @brief Refleja el estado interno de un puerto en los registros visibles de la memoria simulada.
+ *
+ * @param port  Número de puerto.
+ */
+static void PortRefresh(uint32_t port);
+
+/**
+ * @brief Escribe un registro de byte de un pin, como lo hace Chip_GPIO_SetPinState.
+ *
+ * @param port   Número de puerto.
+ * @param pin    Número de bit dentro del puerto.
+ * @param value  Nivel a escribir en el latch de salida.
+ */
+static void ByteWrite(uint32_t port, uint8_t pin, bool value);
+
+/**
+ * @brief Lee un registro de byte de un pin, como lo hace Chip_GPIO_ReadPortBit.
+ *
+ * @param port  Número de puerto.
+ * @param pin   Número de bit dentro del puerto.
+ * @return Nivel del pin.
+ */
+static bool ByteRead(uint32_t port, uint8_t pin);
+
+/**
+ * @brief Registra los flancos de un puerto en los canales de interrupción de pin que lo seleccionan.
+ *
+ * @param port  Número de puerto.
+ * @param rise  Bits del puerto que pasaron a nivel alto.
+ * @param fall  Bits del puerto que pasaron a nivel bajo.
+ */
+static void PinIntEdges(uint32_t port, uint32_t rise, uint32_t fall);
+
+/**
+ * @brief Actualiza el pedido en el NVIC de los canales de interrupción de pin según su estado.
+ */
+static void PinIntUpdate(void);
+
+/**
+ * @brief Busca el temporizador al que pertenece un registro.
+ *
+ * @param reg  Dirección del registro.
+ * @return Número de temporizador, o @ref SIM_TIMERS si el registro no pertenece a ninguno.
+ */
+static uint8_t TimerIndex(const volatile uint32_t * reg);
+
+/**
+ * @brief Calcula cuántas cuentas faltan para la próxima coincidencia que tiene alguna acción configurada en MCR.
+ *
+ * @param timer  Registros del temporizador.
+ * @param count  Cuenta desde la que se mide.
+ * @return Cuentas hasta la coincidencia, o cero si ninguna comparación tiene acciones.
+ */
+static uint64_t TimerDistance(const LPC_TIMER_T * timer, uint32_t count);
+
+/**
+ * @brief Devuelve la cuenta desde la que avanza un temporizador.
+ *
+ * @param index  Número de temporizador.
+ * @return Cuenta actual, o la anterior a cero si una coincidencia pidió reiniciarla en el próximo incremento.
+ */
+static uint32_t TimerBase(uint8_t index);
+
+/**
+ * @brief Avanza la cuenta de un temporizador hasta un ciclo virtual, aplicando las coincidencias intermedias.
+ *
+ * @param index  Número de temporizador.
+ * @param now    Ciclo virtual hasta el que se avanza.
+ */
+static void TimerSync(uint8_t index, uint64_t now);
+
+/**
+ * @brief Calcula el ciclo virtual de la próxima coincidencia de un temporizador.
+ *
+ * @param index  Número de temporizador.
+ * @return Ciclo de la coincidencia, o `UINT64_MAX` si el temporizador no tiene coincidencias pendientes.
+ */
+static uint64_t TimerNextDue(uint8_t index);
+
+/**
+ * @brief Actualiza el pedido en el NVIC de los temporizadores según sus coincidencias pendientes.
+ */
+static void TimerUpdate(void);
+
+/**
+ * @brief Busca el UART al que pertenece un registro.
+ *
+ * @param reg  Dirección del registro.
+ * @return Número de UART, o @ref SIM_UARTS si el registro no pertenece a ninguno.
+ */
+static uint8_t UartIndex(const volatile uint32_t * reg);
+
+/**
+ * @brief Calcula los ciclos que tarda un UART en transmitir un carácter con su divisor y formato.
+ *
+ * @param index  Número de UART.
+ * @return Ciclos por carácter, con dieciséis muestras por bit.
+ */
+static uint64_t UartCharCycles(uint8_t index);
+
+/**
+ * @brief Calcula cuántos caracteres le faltan transmitir a un UART, incluido el que está en el registro de
+ * desplazamiento.
+ *
+ * @param index  Número de UART.
+ * @return Caracteres pendientes.
+ */
+static uint64_t UartQueued(uint8_t index);
+
+/**
+ * @brief Indica si la FIFO de transmisión de un UART está vacía, con a lo sumo un carácter en el registro de
+ * desplazamiento.
+ *
+ * Equivale a que UartQueued() devuelva uno o menos, sin dividir.
+ *
+ * @param index  Número de UART.
+ * @return `true` si la FIFO está vacía.
+ */
+static bool UartFifoEmpty(uint8_t index);
+
+/**
+ * @brief Calcula el ciclo virtual en el que se vacía la FIFO de transmisión de un UART con la interrupción habilitada.
+ *
+ * @param index  Número de UART.
+ * @return Ciclo en que la FIFO queda vacía, o `UINT64_MAX` si la interrupción no está habilitada o ya está vacía.
+ */
+static uint64_t UartNextDue(uint8_t index);
+
+/**
+ * @brief Actualiza el pedido en el NVIC de los UART según el estado de sus FIFO de transmisión y de recepción.
+ */
+static void UartUpdate(void);
+
+/**
+ * @brief Agrega un carácter a la transmisión de un UART y lo escribe en su archivo de salida.
+ *
+ * @param index  Número de UART.
+ * @param data   Carácter a transmitir.
+ */
+static void UartPush(uint8_t index, uint8_t data);
+
+/**
+ * @brief Entrega los bytes de la línea de recepción de un UART que terminaron de llegar.
+ *
+ * Con los pedidos de DMA habilitados cada byte lo copia en memoria el canal que lo recibe; si no, entra en la FIFO de
+ * recepción, o se pierde si está llena.
+ *
+ * @param index  Número de UART.
+ */
+static void UartReceive(uint8_t index);
+
+/**
+ * @brief Busca el SSP al que pertenece un registro.
+ *
+ * @param reg  Dirección del registro.
+ * @return Número de SSP, o @ref SIM_SSPS si el registro no pertenece a ninguno.
+ */
+static uint8_t SspIndex(const volatile uint32_t * reg);
+
+/**
+ * @brief Calcula los ciclos que tarda un SSP en desplazar una trama con su divisor y formato.
+ *
+ * @param index  Número de SSP.
+ * @return Ciclos por trama.
+ */
+static uint64_t SspFrameCycles(uint8_t index);
+
+/**
+ * @brief Calcula cuántas tramas le faltan desplazar a un SSP, incluida la que está en el registro de desplazamiento.
+ *
+ * @param index  Número de SSP.
+ * @return Tramas pendientes.
+ */
+static uint64_t SspQueued(uint8_t index);
+
+/**
+ * @brief Agrega una trama a la transmisión de un SSP y la guarda con el ciclo en que termina de salir.
+ *
+ * Solo se modela la transmisión en modo maestro. Las tramas que se escriben con el controlador deshabilitado se
+ * descartan, y las que no entran en el registro de bytes desplazados también.
+ *
+ * @param index  Número de SSP.
+ * @param data   Trama a transmitir.
+ */
+static void SspPush(uint8_t index, uint8_t data);
+
+/**
+ * @brief Comienza la transferencia de un canal de DMA recién habilitado.
+ *
+ * Solo se modelan las transferencias entre memoria y un SSP o un UART con los pedidos de DMA habilitados. Hacia la
+ * FIFO de transmisión el controlador escribe cada byte apenas hay lugar, por lo que la transferencia termina cuando el
+ * último byte entra en ella. Desde la recepción de un SSP termina cuando sale el último bit de la trama que completa
+ * la cantidad pedida, porque cada trama transmitida recibe otra; los datos recibidos no se copian. Desde la recepción
+ * de un UART avanza con cada byte que llega, en UartReceive(). Cualquier otra transferencia queda habilitada sin
+ * avanzar.
+ *
+ * @param channel  Número de canal.
+ */
+static void DmaStart(uint8_t channel);
+
+/**
+ * @brief Calcula la dirección del registro de datos de una conexión del controlador de DMA.
+ *
+ * @param connection  Conexión con los nombres de LPCOpen, como `GPDMA_CONN_UART2_Rx`.
+ * @return Dirección del registro, o `NULL` si la conexión no se modela.
+ */
+static volatile uint32_t * DmaPeripheral(uint32_t connection);
+
+/**
+ * @brief Busca la conexión del controlador de DMA que corresponde al registro de datos de un periférico.
+ *
+ * Las conexiones de transmisión tienen números impares y las de recepción, pares.
+ *
+ * @param address   Dirección del registro de datos.
+ * @param transmit  `true` para buscar la conexión de transmisión; `false` para la de recepción.
+ * @return Conexión, o `GPDMA_CONN_MEMORY` si el registro no pertenece a ninguna.
+ */
+static uint32_t DmaConnection(uintptr_t address, bool transmit);
+
+/**
+ * @brief Busca el canal habilitado que copia en memoria lo que recibe un periférico.
+ *
+ * @param connection  Conexión del periférico.
+ * @return Número de canal, o `GPDMA_NUMBER_CHANNELS` si no hay ninguno.
+ */
+static uint8_t DmaReceiver(uint32_t connection);
+
+/**
+ * @brief Carga en los registros de un canal de DMA un elemento de una lista enlazada de transferencias.
+ *
+ * @param channel     Número de canal.
+ * @param descriptor  Dirección del elemento.
+ */
+static void DmaLoad(uint8_t channel, uintptr_t descriptor);
+
+/**
+ * @brief Escribe en memoria un byte recibido por un canal de DMA y termina la transferencia si era el último.
+ *
+ * @param channel  Número de canal.
+ * @param data     Byte recibido.
+ */
+static void DmaStore(uint8_t channel, uint8_t data);
+
+/**
+ * @brief Termina la transferencia en curso de un canal de DMA.
+ *
+ * Si la transferencia pedía interrupción marca el fin de transferencia del canal. Si hay otro elemento en la lista lo
+ * carga y continúa con él, y si no deshabilita el canal.
+ *
+ * @param channel  Número de canal.
+ */
+static void DmaComplete(uint8_t channel);
+
+/**
+ * @brief Actualiza el pedido en el NVIC del controlador de DMA según los canales que terminaron.
+ */
+static void DmaUpdate(void);
+
+/**
+ * @brief Calcula los canales de DMA que tienen habilitada la interrupción por fin de transferencia.
+ *
+ * @return Máscara con un bit por canal.
+ */
+static uint32_t DmaInterruptMask(void);
+
+/**
+ * @brief Borra y programa en la EEPROM las palabras escritas en el registro de página.
+ *
+ * El contenido cambia en el momento y el fin de la programación se informa recién después de `SIM_EEPROM_PROGRAM_US`
+ * microsegundos. Si hay un archivo de respaldo, la página completa se escribe en él.
+ */
+static void EepromProgram(void);
+
+/**
+ * @brief Informa el fin de la programación en curso de la EEPROM si ya transcurrió su duración.
+ */
+static void EepromUpdate(void);
+
+/**
+ * @brief Guarda el vencimiento de un periférico y, si cambió, obliga a recalcular el menor.
+ *
+ * @param slot  Vencimiento guardado del periférico.
+ * @param due   Vencimiento recién calculado.
+ */
+static void DueUpdate(uint64_t * slot, uint64_t due);
+
+/**
+ * @brief Recalcula el menor de los vencimientos guardados de los periféricos y de las acciones programadas.
+ */
+static void NextEventUpdate(void);
+
+/**
+ * @brief Calcula el ciclo virtual del próximo evento de hardware que puede pedir una interrupción.
+ *
+ * @return Ciclo del próximo vencimiento, o `UINT64_MAX` si no hay ninguno programado.
+ */
+static inline uint64_t NextEvent(void);
+
+/**
+ * @brief Marca como pendientes las interrupciones que vencieron hasta el ciclo virtual actual.
+ */
+static void RaiseEvents(void);
+
+/**
+ * @brief Atiende las interrupciones pendientes y habilitadas si no están enmascaradas.
+ */
+static void DispatchInterrupts(void);
+
+/**
+ * @brief Avanza el contador de ciclos virtual atendiendo cada vencimiento en el ciclo en que ocurre.
+ *
+ * @param target  Ciclo virtual que se quiere alcanzar. Se corre con los ciclos que consumen las interrupciones.
+ */
+static void Advance(uint64_t target);
+
+/**
+ * @brief Marca como pendientes las interrupciones vencidas y atiende las pendientes si están habilitadas.
+ */
+static void ServiceInterrupts(void);
+
+/**
+ * @brief Lee lo que un programa externo escribió en una pseudoterminal y lo envía a la recepción de su UART.
+ *
+ * Antes de leer espera lo necesario para que el tiempo virtual no se adelante al tiempo real, y al terminar se vuelve
+ * a programar `SIM_PTY_POLL_US` microsegundos más tarde.
+ *
+ * @param object  Pseudoterminal.
+ */
+static void PtyPoll(void * object);
+
+/* === Private variable definitions ================================================================================ */
+
+static struct sim_state_s state;
+
+/** @brief Archivo que respalda el contenido de la EEPROM, que no se pierde con SimChipReset() */
+static FILE * eepromFile;
+
+/** @brief Pseudoterminales conectadas a cada UART con SimUartOpenPty() */
+static sim_pty_t ptys[SIM_UARTS];
+
+/* === Public variable definitions ================================================================================= */
+
+LPC_GPIO_T sim_gpio_port;
+
+LPC_SCU_T sim_scu;
+
+SysTick_Type sim_systick;
+
+CoreDebug_Type sim_core_debug;
+
+uint32_t SystemCoreClock = 204000000;
+
+LPC_PIN_INT_T sim_pin_int;
+
+LPC_TIMER_T sim_timer[SIM_TIMERS];
+
+LPC_USART_T sim_uart[SIM_UARTS];
+
+LPC_SSP_T sim_ssp[SIM_SSPS];
+
+LPC_GPDMA_T sim_gpdma;
+
+LPC_EEPROM_T sim_eeprom;
+
+uint32_t sim_eeprom_memory[EEPROM_PAGE_NUM * EEPROM_PAGE_SIZE / sizeof(uint32_t)];
+
+/** @brief Registros DWT simulados */
+static DWT_Type sim_dwt;
+
+/** @brief Rutinas de servicio de las interrupciones del microcontrolador, indexadas por número de interrupción */
+static void (*const vectors[64])(void) = {
+    [DMA_IRQn] = DMA_IRQHandler,
+    [TIMER0_IRQn] = TIMER0_IRQHandler,     [TIMER1_IRQn] = TIMER1_IRQHandler,     [TIMER2_IRQn] = TIMER2_IRQHandler,
+    [TIMER3_IRQn] = TIMER3_IRQHandler,     [USART0_IRQn] = UART0_IRQHandler,      [UART1_IRQn] = UART1_IRQHandler,
+    [USART2_IRQn] = UART2_IRQHandler,      [USART3_IRQn] = UART3_IRQHandler,
+    [PIN_INT0_IRQn] = GPIO0_IRQHandler, [PIN_INT1_IRQn] = GPIO1_IRQHandler, [PIN_INT2_IRQn] = GPIO2_IRQHandler,
+    [PIN_INT3_IRQn] = GPIO3_IRQHandler, [PIN_INT4_IRQn] = GPIO4_IRQHandler, [PIN_INT5_IRQn] = GPIO5_IRQHandler,
+    [PIN_INT6_IRQn] = GPIO6_IRQHandler, [PIN_INT7_IRQn] = GPIO7_IRQHandler,
+};
+
+/* === Private function definitions ================================================================================ */
+
+static void CountAccess(bool write) {
+    if (write) {
+        state.stats.writes++;
+    } else {
+        state.stats.reads++;
+    }
+    Advance(state.cycles + SIM_CYCLES_PER_ACCESS);
+}
+
+static uint32_t PortLevel(uint32_t port) {
+    uint32_t dir = sim_gpio_port.DIR[port];
+    return (state.latch[port] & dir) | (state.input[port] & ~dir);
+}
+
+static void PortRefresh(uint32_t port) {
+    uint32_t level = PortLevel(port);
+    uint32_t changed = level ^ state.level[port];
+
+    state.level[port] = level;
+    sim_gpio_port.PIN[port] = level;
+    sim_gpio_port.MPIN[port] = level & ~sim_gpio_port.MASK[port];
+    sim_gpio_port.SET[port] = state.latch[port];
+    sim_gpio_port.CLR[port] = 0;
+    sim_gpio_port.NOT[port] = 0;
+    if (changed == 0) {
+        return;
+    }
+
+    /* Los registros de byte y de palabra solo se reescriben para los pines que cambiaron */
+    for (uint32_t pending = changed; pending != 0; pending &= pending - 1) {
+        int pin = __builtin_ctz(pending);
+        bool high = (level & (1u << pin)) != 0;
+        sim_gpio_port.B[port][pin] = high;
+        sim_gpio_port.W[port][pin] = high ? 0xFFFFFFFF : 0;
+    }
+    PinIntEdges(port, changed & level, changed & ~level);
+    if (state.observer != NULL) {
+        state.observer(state.observerObject, port, level);
+    }
+}
+
+static void ByteWrite(uint32_t port, uint8_t pin, bool value) {
+    CountAccess(true);
+    if (port < SIM_GPIO_PORTS) {
+        if (value) {
+            state.latch[port] |= (1u << pin);
+        } else {
+            state.latch[port] &= ~(1u << pin);
+        }
+        PortRefresh(port);
+    }
+    ServiceInterrupts();
+}
+
+static bool ByteRead(uint32_t port, uint8_t pin) {
+    CountAccess(false);
+    bool result = (port < SIM_GPIO_PORTS) && ((PortLevel(port) & (1u << pin)) != 0);
+    ServiceInterrupts();
+    return result;
+}
+
+static void PinIntEdges(uint32_t port, uint32_t rise, uint32_t fall) {
+    if ((sim_pin_int.IENR | sim_pin_int.IENF) == 0) {
+        return;
+    }
+    for (uint8_t channel = 0; channel < 8; channel++) {
+        uint32_t select = (sim_scu.PINTSEL[channel / 4] >> (8 * (channel % 4))) & 0xFF;
+        uint32_t bit = 1u << (select & 0x1F);
+
+        if ((select >> 5) == port) {
+            if ((rise & bit) && (sim_pin_int.IENR & PININTCH(channel))) {
+                sim_pin_int.RISE |= PININTCH(channel);
+            }
+            if ((fall & bit) && (sim_pin_int.IENF & PININTCH(channel))) {
+                sim_pin_int.FALL |= PININTCH(channel);
+            }
+        }
+    }
+    PinIntUpdate();
+}
+
+static void PinIntUpdate(void) {
+    /* Los ocho canales ocupan números de interrupción consecutivos */
+    sim_pin_int.IST = sim_pin_int.RISE | sim_pin_int.FALL;
+    state.nvicPending &= ~(0xFFull << PIN_INT0_IRQn);
+    state.nvicPending |= (uint64_t)(sim_pin_int.IST & 0xFF) << PIN_INT0_IRQn;
+}
+
+static uint8_t TimerIndex(const volatile uint32_t * reg) {
+    uintptr_t address = (uintptr_t)reg;
+
+    if ((address < (uintptr_t)&sim_timer[0]) || (address >= (uintptr_t)&sim_timer[SIM_TIMERS])) {
+        return SIM_TIMERS;
+    }
+    return (address - (uintptr_t)&sim_timer[0]) / sizeof(LPC_TIMER_T);
+}
+
+static uint64_t TimerDistance(const LPC_TIMER_T * timer, uint32_t count) {
+    const uint32_t actions = TIMER_INT_ON_MATCH(0) | TIMER_RESET_ON_MATCH(0) | TIMER_STOP_ON_MATCH(0);
+    uint64_t result = 0;
+
+    for (uint8_t match = 0; match < 4; match++) {
+        if (timer->MCR & (actions << (3 * match))) {
+            /* Una comparación igual a la cuenta actual ya se aplicó y vuelve a coincidir después de dar la vuelta */
+            uint64_t distance = (uint32_t)(timer->MR[match] - count);
+            if (distance == 0) {
+                distance = 1ull << 32;
+            }
+            if ((result == 0) || (distance < result)) {
+                result = distance;
+            }
+        }
+    }
+    return result;
+}
+
+static uint32_t TimerBase(uint8_t index) {
+    return state.timerWrap[index] ? UINT32_MAX : sim_timer[index].TC;
+}
+
+static void TimerSync(uint8_t index, uint64_t now) {
+    LPC_TIMER_T * timer = &sim_timer[index];
+    bool matched = false;
+
+    while ((timer->TCR & (TIMER_ENABLE | TIMER_RESET)) == TIMER_ENABLE && (now > state.timerSync[index])) {
+        uint64_t prescale = (uint64_t)timer->PR + 1;
+        uint64_t elapsed = now - state.timerSync[index] + timer->PC;
+        uint32_t base = TimerBase(index);
+        /* Antes del vencimiento guardado no hay coincidencias y no hace falta recorrer las comparaciones */
+        uint64_t distance = (now < state.timerDue[index]) ? 0 : TimerDistance(timer, base);
+
+        if ((distance == 0) || (elapsed < distance * prescale)) {
+            uint64_t counts = (prescale == 1) ? elapsed : elapsed / prescale;
+
+            if (counts > 0) {
+                timer->TC = base + counts;
+                state.timerWrap[index] = false;
+            }
+            timer->PC = elapsed - counts * prescale;
+            break;
+        }
+
+        state.timerSync[index] += distance * prescale - timer->PC;
+        timer->PC = 0;
+        timer->TC = base + distance;
+        state.timerWrap[index] = false;
+        matched = true;
+        for (uint8_t match = 0; match < 4; match++) {
+            if (timer->MR[match] == timer->TC) {
+                if (timer->MCR & TIMER_INT_ON_MATCH(match)) {
+                    timer->IR |= TIMER_IR_CLR(match);
+                }
+                if (timer->MCR & TIMER_STOP_ON_MATCH(match)) {
+                    timer->TCR &= ~TIMER_ENABLE;
+                }
+                if (timer->MCR & TIMER_RESET_ON_MATCH(match)) {
+                    state.timerWrap[index] = true;
+                }
+            }
+        }
+    }
+    state.timerSync[index] = now;
+
+    /* Sin coincidencias intermedias la próxima sigue en el mismo ciclo y las banderas no cambian */
+    if (matched) {
+        DueUpdate(&state.timerDue[index], TimerNextDue(index));
+        TimerUpdate();
+    }
+}
+
+static uint64_t TimerNextDue(uint8_t index) {
+    const LPC_TIMER_T * timer = &sim_timer[index];
+    uint64_t distance = TimerDistance(timer, TimerBase(index));
+
+    if (((timer->TCR & (TIMER_ENABLE | TIMER_RESET)) != TIMER_ENABLE) || (distance == 0)) {
+        return UINT64_MAX;
+    }
+    return state.timerSync[index] + distance * ((uint64_t)timer->PR + 1) - timer->PC;
+}
+
+static void TimerUpdate(void) {
+    for (uint8_t index = 0; index < SIM_TIMERS; index++) {
+        if (sim_timer[index].IR & 0x0F) {
+            state.nvicPending |= 1ull << (TIMER0_IRQn + index);
+        } else {
+            state.nvicPending &= ~(1ull << (TIMER0_IRQn + index));
+        }
+    }
+}
+
+static uint8_t UartIndex(const volatile uint32_t * reg) {
+    uintptr_t address = (uintptr_t)reg;
+
+    if ((address < (uintptr_t)&sim_uart[0]) || (address >= (uintptr_t)&sim_uart[SIM_UARTS])) {
+        return SIM_UARTS;
+    }
+    return (address - (uintptr_t)&sim_uart[0]) / sizeof(LPC_USART_T);
+}
+
+static uint64_t UartCharCycles(uint8_t index) {
+    uint32_t format = sim_uart[index].LCR;
+    uint32_t divisor = state.uartDivisor[index] ? state.uartDivisor[index] : 1;
+    /* Bit de arranque, de 5 a 8 bits de datos, paridad opcional y uno o dos bits de parada */
+    uint32_t bits = 1 + 5 + (format & 0x03) + ((format & 0x08) ? 1 : 0) + ((format & 0x04) ? 2 : 1);
+
+    return 16ull * divisor * bits;
+}
+
+static uint64_t UartQueued(uint8_t index) {
+    uint64_t chars = UartCharCycles(index);
+
+    if (state.uartBusy[index] <= state.cycles) {
+        return 0;
+    }
+    return (state.uartBusy[index] - state.cycles + chars - 1) / chars;
+}
+
+static bool UartFifoEmpty(uint8_t index) {
+    return state.uartBusy[index] <= state.cycles + UartCharCycles(index);
+}
+
+static uint64_t UartNextDue(uint8_t index) {
+    if (!(sim_uart[index].IER & UART_IER_THREINT) || UartFifoEmpty(index)) {
+        return UINT64_MAX;
+    }
+    /* La FIFO queda vacía cuando el último carácter pasa al registro de desplazamiento */
+    return state.uartBusy[index] - UartCharCycles(index);
+}
+
+static void UartUpdate(void) {
+    for (uint8_t index = 0; index < SIM_UARTS; index++) {
+        if (((sim_uart[index].IER & UART_IER_THREINT) && UartFifoEmpty(index)) ||
+            ((sim_uart[index].IER & UART_IER_RBRINT) && (state.uartRx[index].fifoCount > 0))) {
+            state.nvicPending |= 1ull << (USART0_IRQn + index);
+        } else {
+            state.nvicPending &= ~(1ull << (USART0_IRQn + index));
+        }
+    }
+}
+
+static void UartPush(uint8_t index, uint8_t data) {
+    uint64_t start = (state.uartBusy[index] > state.cycles) ? state.uartBusy[index] : state.cycles;
+
+    state.uartBusy[index] = start + UartCharCycles(index);
+    if (state.uartOutput[index] != NULL) {
+        fputc(data, state.uartOutput[index]);
+    }
+}
+
+static void UartReceive(uint8_t index) {
+    sim_uart_rx_t * rx = &state.uartRx[index];
+
+    while ((rx->lineCount > 0) && (rx->lineDue <= state.cycles)) {
+        uint8_t data = rx->line[rx->lineFirst];
+        uint8_t channel = state.uartDma[index] ? DmaReceiver(GPDMA_CONN_UART0_Rx + 2 * index) : GPDMA_NUMBER_CHANNELS;
+
+        rx->lineFirst = (rx->lineFirst + 1) % SIM_UART_RX_BUFFER;
+        rx->lineCount--;
+        if (channel < GPDMA_NUMBER_CHANNELS) {
+            DmaStore(channel, data);
+        } else if (rx->fifoCount < SIM_UART_FIFO) {
+            rx->fifo[(rx->fifoFirst + rx->fifoCount) % SIM_UART_FIFO] = data;
+            rx->fifoCount++;
+        }
+        DueUpdate(&rx->lineDue, rx->lineDue + UartCharCycles(index));
+    }
+    if (rx->lineCount == 0) {
+        DueUpdate(&rx->lineDue, UINT64_MAX);
+    }
+}
+
+static uint8_t SspIndex(const volatile uint32_t * reg) {
+    uintptr_t address = (uintptr_t)reg;
+
+    if ((address < (uintptr_t)&sim_ssp[0]) || (address >= (uintptr_t)&sim_ssp[SIM_SSPS])) {
+        return SIM_SSPS;
+    }
+    return (address - (uintptr_t)&sim_ssp[0]) / sizeof(LPC_SSP_T);
+}
+
+static uint64_t SspFrameCycles(uint8_t index) {
+    uint32_t prescale = (sim_ssp[index].CPSR < 2) ? 2 : (sim_ssp[index].CPSR & 0xFE);
+    uint32_t rate = ((sim_ssp[index].CR0 >> 8) & 0xFF) + 1;
+    uint32_t bits = (sim_ssp[index].CR0 & 0x0F) + 1;
+
+    return (uint64_t)prescale * rate * bits;
+}
+
+static uint64_t SspQueued(uint8_t index) {
+    uint64_t frame = SspFrameCycles(index);
+
+    if (state.sspBusy[index] <= state.cycles) {
+        return 0;
+    }
+    return (state.sspBusy[index] - state.cycles + frame - 1) / frame;
+}
+
+static void SspPush(uint8_t index, uint8_t data) {
+    uint64_t start = (state.sspBusy[index] > state.cycles) ? state.sspBusy[index] : state.cycles;
+
+    if (!(sim_ssp[index].CR1 & SSP_CR1_SSP_EN) || (sim_ssp[index].CR1 & SSP_CR1_SLAVE_EN)) {
+        return;
+    }
+    state.sspBusy[index] = start + SspFrameCycles(index);
+    if ((state.sspRxPending[index] > 0) && (--state.sspRxPending[index] == 0)) {
+        DueUpdate(&state.dmaDue[state.sspRxChannel[index]], state.sspBusy[index]);
+    }
+    if (state.sspCount[index] < SIM_SSP_LOG) {
+        sim_ssp_entry_t * entry = &state.sspLog[index][(state.sspFirst[index] + state.sspCount[index]) % SIM_SSP_LOG];
+
+        entry->cycle = state.sspBusy[index];
+        entry->data = data;
+        state.sspCount[index]++;
+    }
+}
+
+static void DmaStart(uint8_t channel) {
+    GPDMA_CH_T * registers = &sim_gpdma.CH[channel];
+    uint32_t type = (registers->CONFIG >> 11) & 0x07;
+    uint32_t source = (registers->CONFIG >> 1) & 0x1F;
+    uint32_t destination = (registers->CONFIG >> 6) & 0x1F;
+    uint32_t size = GPDMA_DMACCxControl_TransferSize(registers->CONTROL);
+    const uint8_t * data = (const uint8_t *)state.dmaSource[channel];
+    uint8_t ssp = SIM_SSPS;
+    uint8_t uart = SIM_UARTS;
+    uint64_t wait;
+    uint64_t busy;
+
+    DueUpdate(&state.dmaDue[channel], UINT64_MAX);
+    if (type == GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA) {
+        if ((source == GPDMA_CONN_SSP0_Rx) || (source == GPDMA_CONN_SSP1_Rx)) {
+            ssp = (source == GPDMA_CONN_SSP0_Rx) ? 0 : 1;
+        }
+        if ((ssp < SIM_SSPS) && (sim_ssp[ssp].DMACR & SSP_DMA_RX) && (sim_ssp[ssp].CR1 & SSP_CR1_SSP_EN)) {
+            state.sspRxChannel[ssp] = channel;
+            state.sspRxPending[ssp] = size;
+            if (size == 0) {
+                DueUpdate(&state.dmaDue[channel], state.cycles);
+            }
+        }
+        return;
+    }
+
+    if (destination == GPDMA_CONN_SSP0_Tx) {
+        ssp = 0;
+    } else if (destination == GPDMA_CONN_SSP1_Tx) {
+        ssp = 1;
+    } else if ((destination >= GPDMA_CONN_UART0_Tx) && (destination <= GPDMA_CONN_UART3_Tx) && (destination & 1)) {
+        uart = DMA_CONN_UART(destination);
+    }
+    if ((type != GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA) || (data == NULL)) {
+        return;
+    }
+
+    if ((ssp < SIM_SSPS) && (sim_ssp[ssp].DMACR & SSP_DMA_TX) && (sim_ssp[ssp].CR1 & SSP_CR1_SSP_EN)) {
+        for (uint32_t index = 0; index < size; index++) {
+            SspPush(ssp, data[index]);
+        }
+        wait = (SIM_SSP_FIFO + 1) * SspFrameCycles(ssp);
+        busy = state.sspBusy[ssp];
+    } else if ((uart < SIM_UARTS) && state.uartDma[uart]) {
+        for (uint32_t index = 0; index < size; index++) {
+            UartPush(uart, data[index]);
+        }
+        DueUpdate(&state.uartDue[uart], UartNextDue(uart));
+        wait = (SIM_UART_FIFO + 1) * UartCharCycles(uart);
+        busy = state.uartBusy[uart];
+    } else {
+        return;
+    }
+    /* El último byte entra en la FIFO cuando queda lugar para él detrás de los que todavía no salieron */
+    DueUpdate(&state.dmaDue[channel], (busy > state.cycles + wait) ? busy - wait : state.cycles);
+}
+
+static volatile uint32_t * DmaPeripheral(uint32_t connection) {
+    if ((connection >= GPDMA_CONN_SSP0_Tx) && (connection <= GPDMA_CONN_SSP1_Rx)) {
+        return &sim_ssp[(connection - GPDMA_CONN_SSP0_Tx) / 2].DR;
+    }
+    if ((connection >= GPDMA_CONN_UART0_Tx) && (connection <= GPDMA_CONN_UART3_Rx)) {
+        return &sim_uart[DMA_CONN_UART(connection)].THR;
+    }
+    return NULL;
+}
+
+static uint32_t DmaConnection(uintptr_t address, bool transmit) {
+    for (uint32_t connection = GPDMA_CONN_SSP0_Tx; connection <= GPDMA_CONN_UART3_Rx; connection++) {
+        if ((((connection & 1) != 0) == transmit) && ((uintptr_t)DmaPeripheral(connection) == address)) {
+            return connection;
+        }
+    }
+    return GPDMA_CONN_MEMORY;
+}
+
+static uint8_t DmaReceiver(uint32_t connection) {
+    for (uint8_t channel = 0; channel < GPDMA_NUMBER_CHANNELS; channel++) {
+        uint32_t config = sim_gpdma.CH[channel].CONFIG;
+
+        if ((config & GPDMA_DMACCxConfig_E) && (((config >> 11) & 0x07) == GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA) &&
+            (((config >> 1) & 0x1F) == connection)) {
+            return channel;
+        }
+    }
+    return GPDMA_NUMBER_CHANNELS;
+}
+
+static void DmaLoad(uint8_t channel, uintptr_t descriptor) {
+    const DMA_TransferDescriptor_t * item = (const DMA_TransferDescriptor_t *)descriptor;
+    GPDMA_CH_T * registers = &sim_gpdma.CH[channel];
+
+    registers->SRCADDR = (uint32_t)item->src;
+    registers->DESTADDR = (uint32_t)item->dst;
+    registers->LLI = (uint32_t)item->lli;
+    registers->CONTROL = item->ctrl;
+    state.dmaSource[channel] = item->src;
+    state.dmaTarget[channel] = item->dst;
+    state.dmaNext[channel] = item->lli;
+}
+
+static void DmaStore(uint8_t channel, uint8_t data) {
+    GPDMA_CH_T * registers = &sim_gpdma.CH[channel];
+    uint32_t size = GPDMA_DMACCxControl_TransferSize(registers->CONTROL);
+
+    if ((size == 0) || (state.dmaTarget[channel] == 0)) {
+        return;
+    }
+    /* DESTADDR y la cantidad de CONTROL avanzan con cada byte, como los lee el programa en el hardware */
+    *(uint8_t *)state.dmaTarget[channel] = data;
+    state.dmaTarget[channel]++;
+    registers->DESTADDR = registers->DESTADDR + 1;
+    registers->CONTROL = registers->CONTROL - 1;
+    if (size == 1) {
+        DmaComplete(channel);
+    }
+}
+
+static void DmaComplete(uint8_t channel) {
+    GPDMA_CH_T * registers = &sim_gpdma.CH[channel];
+
+    if (registers->CONTROL & GPDMA_DMACCxControl_I) {
+        state.dmaTerminal |= 1u << channel;
+    }
+    if (state.dmaNext[channel] != 0) {
+        DmaLoad(channel, state.dmaNext[channel]);
+        DmaStart(channel);
+    } else {
+        registers->CONFIG &= ~GPDMA_DMACCxConfig_E;
+    }
+    DmaUpdate();
+}
+
+static uint32_t DmaInterruptMask(void) {
+    uint32_t mask = 0;
+
+    for (uint8_t channel = 0; channel < GPDMA_NUMBER_CHANNELS; channel++) {
+        if (sim_gpdma.CH[channel].CONFIG & GPDMA_DMACCxConfig_ITC) {
+            mask |= 1u << channel;
+        }
+    }
+    return mask;
+}
+
+static void DmaUpdate(void) {
+    if (state.dmaTerminal & DmaInterruptMask()) {
+        state.nvicPending |= 1ull << DMA_IRQn;
+    } else {
+        state.nvicPending &= ~(1ull << DMA_IRQn);
+    }
+}
+
+static void EepromProgram(void) {
+    uint32_t * page = &sim_eeprom_memory[state.eepromPage * EEPROM_PAGE_WORDS];
+
+    for (uint8_t word = 0; word < EEPROM_PAGE_WORDS; word++) {
+        if (state.eepromWritten & (1u << word)) {
+            page[word] = state.eepromLatch[word];
+            state.eepromStats.words++;
+        }
+    }
+    state.eepromWritten = 0;
+    state.eepromCycles[state.eepromPage]++;
+    state.eepromStats.programs++;
+    state.eepromBusy = state.cycles + (uint64_t)SystemCoreClock / 1000000 * SIM_EEPROM_PROGRAM_US;
+    if (eepromFile != NULL) {
+        fseek(eepromFile, (long)state.eepromPage * EEPROM_PAGE_SIZE, SEEK_SET);
+        fwrite(page, EEPROM_PAGE_SIZE, 1, eepromFile);
+        fflush(eepromFile);
+    }
+}
+
+static void EepromUpdate(void) {
+    if ((state.eepromBusy != 0) && (state.cycles >= state.eepromBusy)) {
+        state.eepromStatus |= EEPROM_INT_ENDOFPROG;
+        state.eepromBusy = 0;
+    }
+}
+
+static void DueUpdate(uint64_t * slot, uint64_t due) {
+    if (*slot != due) {
+        *slot = due;
+        state.nextValid = false;
+    }
+}
+
+static void NextEventUpdate(void) {
+    state.nextDue = (state.callbackCount > 0) ? state.callbacks[0].cycle : UINT64_MAX;
+    for (uint8_t index = 0; index < SIM_TIMERS; index++) {
+        if (state.timerDue[index] < state.nextDue) {
+            state.nextDue = state.timerDue[index];
+        }
+    }
+    for (uint8_t index = 0; index < SIM_UARTS; index++) {
+        if (state.uartDue[index] < state.nextDue) {
+            state.nextDue = state.uartDue[index];
+        }
+        if (state.uartRx[index].lineDue < state.nextDue) {
+            state.nextDue = state.uartRx[index].lineDue;
+        }
+    }
+    for (uint8_t channel = 0; channel < GPDMA_NUMBER_CHANNELS; channel++) {
+        if (state.dmaDue[channel] < state.nextDue) {
+            state.nextDue = state.dmaDue[channel];
+        }
+    }
+    state.nextValid = true;
+}
+
+static inline uint64_t NextEvent(void) {
+    const uint32_t enabled = SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk;
+
+    /* Los vencimientos de los periféricos solo cambian cuando se escriben sus registros o se aplica una coincidencia */
+    if (!state.nextValid) {
+        NextEventUpdate();
+    }
+    if (((sim_systick.CTRL & enabled) == enabled) && (state.tickDue < state.nextDue)) {
+        return state.tickDue;
+    }
+    return state.nextDue;
+}
+
+static void RaiseEvents(void) {
+    const uint32_t enabled = SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk;
+
+    if (state.cycles < NextEvent()) {
+        return;
+    }
+
+    /* Las acciones programadas se retiran antes de ejecutarse, porque pueden programar otras */
+    while ((state.callbackCount > 0) && (state.callbacks[0].cycle <= state.cycles)) {
+        sim_callback_entry_t entry = state.callbacks[0];
+
+        state.callbackCount--;
+        state.nextValid = false;
+        memmove(&state.callbacks[0], &state.callbacks[1], state.callbackCount * sizeof(state.callbacks[0]));
+        entry.callback(entry.object);
+    }
+
+    /* Con las interrupciones enmascaradas varios vencimientos del SysTick se acumulan en un solo pedido */
+    while (((sim_systick.CTRL & enabled) == enabled) && (state.cycles >= state.tickDue)) {
+        state.tickDue += (uint64_t)sim_systick.LOAD + 1;
+        state.tickPending = true;
+    }
+    /* Solo se atienden los periféricos que vencieron; en el arranque los vencimientos guardados valen cero */
+    for (uint8_t index = 0; index < SIM_TIMERS; index++) {
+        if (state.timerDue[index] <= state.cycles) {
+            TimerSync(index, state.cycles);
+            DueUpdate(&state.timerDue[index], TimerNextDue(index));
+        }
+    }
+    for (uint8_t index = 0; index < SIM_UARTS; index++) {
+        if (state.uartDue[index] <= state.cycles) {
+            DueUpdate(&state.uartDue[index], UartNextDue(index));
+            UartUpdate();
+        }
+        if (state.uartRx[index].lineDue <= state.cycles) {
+            UartReceive(index);
+            UartUpdate();
+        }
+    }
+    for (uint8_t channel = 0; channel < GPDMA_NUMBER_CHANNELS; channel++) {
+        if (state.dmaDue[channel] <= state.cycles) {
+            DueUpdate(&state.dmaDue[channel], UINT64_MAX);
+            if (sim_gpdma.CH[channel].CONFIG & GPDMA_DMACCxConfig_E) {
+                DmaComplete(channel);
+            }
+        }
+    }
+}
+
+static void DispatchInterrupts(void) {
+    if (!state.tickPending && !(state.nvicPending & state.nvicEnabled)) {
+        return;
+    }
+    /* El SysTick primero y luego las interrupciones de periféricos, en orden de número de interrupción */
+    while (!state.irqMasked && !state.inIrq) {
+        if (state.tickPending) {
+            state.tickPending = false;
+            state.inIrq = true;
+            SysTick_Handler();
+            state.inIrq = false;
+        } else if (state.nvicPending & state.nvicEnabled) {
+            uint8_t irq = __builtin_ctzll(state.nvicPending & state.nvicEnabled);
+
+            state.nvicPending &= ~(1ull << irq);
+            state.inIrq = true;
+            if (vectors[irq] != NULL) {
+                vectors[irq]();
+            }
+            state.inIrq = false;
+            PinIntUpdate();
+            TimerUpdate();
+            UartUpdate();
+            DmaUpdate();
+        } else {
+            break;
+        }
+    }
+}
+
+static void Advance(uint64_t target) {
+    uint64_t due = NextEvent();
+
+    /* Camino rápido: la mayoría de los accesos no alcanza ningún vencimiento */
+    if (due > target) {
+        if (target > state.cycles) {
+            state.cycles = target;
+        }
+        return;
+    }
+
+    /* Cada vencimiento se atiende en su ciclo; el trabajo interrumpido termina tarde lo que duró la interrupción */
+    while ((due <= target) && !state.irqMasked && !state.inIrq) {
+        uint64_t start;
+
+        if (due > state.cycles) {
+            state.cycles = due;
+        }
+        start = state.cycles;
+        RaiseEvents();
+        DispatchInterrupts();
+        target += state.cycles - start;
+        due = NextEvent();
+    }
+    if (target > state.cycles) {
+        state.cycles = target;
+    }
+    RaiseEvents();
+}
+
+static void ServiceInterrupts(void) {
+    RaiseEvents();
+    DispatchInterrupts();
+}
+
+static void PtyPoll(void * object) {
+    sim_pty_t * pty = object;
+    sim_uart_rx_t * rx = &state.uartRx[UartIndex(&pty->uart->LCR)];
+    uint8_t data[SIM_UART_RX_BUFFER];
+    struct timespec now;
+    int64_t ahead;
+    ssize_t count;
+
+    /* El tiempo virtual no se adelanta al real, para que el programa externo vea los tiempos de la placa */
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    ahead = (int64_t)((state.cycles - pty->startCycle) * 1000 / (SystemCoreClock / 1000000)) -
+            ((int64_t)(now.tv_sec - pty->start.tv_sec) * 1000000000 + (now.tv_nsec - pty->start.tv_nsec));
+    if (ahead > 0) {
+        struct timespec pause = {.tv_sec = ahead / 1000000000, .tv_nsec = ahead % 1000000000};
+
+        nanosleep(&pause, NULL);
+    }
+
+    count = read(pty->master, data, SIM_UART_RX_BUFFER - rx->lineCount);
+    if (count > 0) {
+        SimUartReceive(pty->uart, data, count);
+    }
+    SimScheduleCallback(state.cycles + (uint64_t)SystemCoreClock / 1000000 * SIM_PTY_POLL_US, PtyPoll, pty);
+}
+
+/* === Public function implementation ============================================================================== */
+
+void SimRegisterWrite(volatile uint32_t * reg, uint32_t value) {
+    size_t offset = GPIO_OFFSET(reg);
+    uint32_t port = SIM_GPIO_PORTS;
+
+    uint8_t timer = TimerIndex(reg);
+    uint8_t uart = UartIndex(reg);
+    uint8_t ssp = SspIndex(reg);
+    size_t dma = (uintptr_t)reg - (uintptr_t)&sim_gpdma;
+    size_t eeprom = (uintptr_t)reg - EEPROM_START;
+
+    CountAccess(true);
+    if (eeprom < sizeof(sim_eeprom_memory)) {
+        /* Las escrituras en el mapa de la EEPROM solo cargan el registro de página */
+        state.eepromPage = eeprom / EEPROM_PAGE_SIZE;
+        state.eepromLatch[(eeprom % EEPROM_PAGE_SIZE) / sizeof(uint32_t)] = value;
+        state.eepromWritten |= 1u << ((eeprom % EEPROM_PAGE_SIZE) / sizeof(uint32_t));
+    } else if (reg == &sim_eeprom.CMD) {
+        *reg = value;
+        if (value == EEPROM_CMD_ERASE_PRG_PAGE) {
+            EepromProgram();
+        }
+    } else if (reg == &sim_eeprom.INTSTATCLR) {
+        EepromUpdate();
+        state.eepromStatus &= ~value;
+    } else if (reg == &sim_eeprom.INTSTATSET) {
+        state.eepromStatus |= value;
+    } else if (reg == &sim_eeprom.INTENSET) {
+        state.eepromEnabled |= value;
+    } else if (reg == &sim_eeprom.INTENCLR) {
+        state.eepromEnabled &= ~value;
+    } else if (ssp < SIM_SSPS) {
+        LPC_SSP_T * block = &sim_ssp[ssp];
+
+        if (reg == &block->DR) {
+            /* Con la FIFO llena la trama se pierde, como en el hardware */
+            if (SspQueued(ssp) <= SIM_SSP_FIFO) {
+                SspPush(ssp, value & 0xFF);
+            }
+        } else if ((reg != &block->SR) && (reg != &block->RIS) && (reg != &block->MIS) && (reg != &block->ICR)) {
+            *reg = value;
+        }
+    } else if (dma < sizeof(sim_gpdma)) {
+        size_t channel = (dma >= offsetof(LPC_GPDMA_T, CH)) ? (dma - offsetof(LPC_GPDMA_T, CH)) / sizeof(GPDMA_CH_T)
+                                                              : GPDMA_NUMBER_CHANNELS;
+
+        if (reg == &sim_gpdma.INTTCCLEAR) {
+            state.dmaTerminal &= ~value;
+        } else if ((channel < GPDMA_NUMBER_CHANNELS) && (reg == &sim_gpdma.CH[channel].CONFIG)) {
+            uint32_t previous = sim_gpdma.CH[channel].CONFIG;
+
+            *reg = value;
+            if (!(previous & GPDMA_DMACCxConfig_E) && (value & GPDMA_DMACCxConfig_E)) {
+                DmaStart(channel);
+            } else if (!(value & GPDMA_DMACCxConfig_E)) {
+                DueUpdate(&state.dmaDue[channel], UINT64_MAX);
+                for (uint8_t index = 0; index < SIM_SSPS; index++) {
+                    if (state.sspRxChannel[index] == channel) {
+                        state.sspRxPending[index] = 0;
+                    }
+                }
+            }
+        } else if (dma >= offsetof(LPC_GPDMA_T, SOFTBREQ)) {
+            *reg = value;
+        }
+        DmaUpdate();
+    } else if (uart < SIM_UARTS) {
+        LPC_USART_T * block = &sim_uart[uart];
+        bool latch = (block->LCR & UART_LCR_DLAB_EN) != 0;
+
+        if ((reg == &block->THR) && latch) {
+            state.uartDivisor[uart] = (state.uartDivisor[uart] & 0xFF00) | (value & 0xFF);
+        } else if ((reg == &block->DLM) && latch) {
+            state.uartDivisor[uart] = (state.uartDivisor[uart] & 0x00FF) | ((value & 0xFF) << 8);
+        } else if (reg == &block->THR) {
+            /* Con la FIFO llena el carácter se pierde, como en el hardware */
+            if (UartQueued(uart) <= SIM_UART_FIFO) {
+                UartPush(uart, value & 0xFF);
+            }
+        } else if (reg == &block->FCR) {
+            state.uartDma[uart] = (value & UART_FCR_DMAMODE_SEL) != 0;
+            if (value & UART_FCR_TX_RS) {
+                state.uartBusy[uart] = state.cycles;
+            }
+            if (value & UART_FCR_RX_RS) {
+                state.uartRx[uart].fifoCount = 0;
+            }
+        } else if (reg != &block->LSR) {
+            *reg = value;
+        }
+        DueUpdate(&state.uartDue[uart], UartNextDue(uart));
+        UartUpdate();
+    } else if (timer < SIM_TIMERS) {
+        TimerSync(timer, state.cycles);
+        if (reg == &sim_timer[timer].IR) {
+            sim_timer[timer].IR &= ~value;
+        } else if (reg == &sim_timer[timer].TCR) {
+            if (value & TIMER_RESET) {
+                sim_timer[timer].TC = 0;
+                sim_timer[timer].PC = 0;
+                state.timerWrap[timer] = false;
+            }
+            sim_timer[timer].TCR = value;
+        } else {
+            if (reg == &sim_timer[timer].TC) {
+                state.timerWrap[timer] = false;
+            }
+            *reg = value;
+        }
+        DueUpdate(&state.timerDue[timer], TimerNextDue(timer));
+        TimerUpdate();
+    } else if (GPIO_IN(offset, DIR)) {
+        port = GPIO_PORT(offset, DIR);
+        *reg = value;
+    } else if (GPIO_IN(offset, MASK)) {
+        port = GPIO_PORT(offset, MASK);
+        *reg = value;
+    } else if (GPIO_IN(offset, PIN)) {
+        port = GPIO_PORT(offset, PIN);
+        if (port < SIM_GPIO_PORTS) {
+            state.latch[port] = value;
+        }
+    } else if (GPIO_IN(offset, MPIN)) {
+        port = GPIO_PORT(offset, MPIN);
+        if (port < SIM_GPIO_PORTS) {
+            uint32_t mask = sim_gpio_port.MASK[port];
+            state.latch[port] = (state.latch[port] & mask) | (value & ~mask);
+        }
+    } else if (GPIO_IN(offset, SET)) {
+        port = GPIO_PORT(offset, SET);
+        if (port < SIM_GPIO_PORTS) {
+            state.latch[port] |= value;
+        }
+    } else if (GPIO_IN(offset, CLR)) {
+        port = GPIO_PORT(offset, CLR);
+        if (port < SIM_GPIO_PORTS) {
+            state.latch[port] &= ~value;
+        }
+    } else if (GPIO_IN(offset, NOT)) {
+        port = GPIO_PORT(offset, NOT);
+        if (port < SIM_GPIO_PORTS) {
+            state.latch[port] ^= value;
+        }
+    } else if (reg == &sim_pin_int.SIENR) {
+        sim_pin_int.IENR |= value;
+    } else if (reg == &sim_pin_int.CIENR) {
+        sim_pin_int.IENR &= ~value;
+    } else if (reg == &sim_pin_int.SIENF) {
+        sim_pin_int.IENF |= value;
+    } else if (reg == &sim_pin_int.CIENF) {
+        sim_pin_int.IENF &= ~value;
+    } else if (reg == &sim_pin_int.RISE) {
+        sim_pin_int.RISE &= ~value;
+    } else if (reg == &sim_pin_int.FALL) {
+        sim_pin_int.FALL &= ~value;
+    } else if (reg == &sim_pin_int.IST) {
+        sim_pin_int.RISE &= ~value;
+        sim_pin_int.FALL &= ~value;
+    } else {
+        *reg = value;
+    }
+
+    if (port < SIM_GPIO_PORTS) {
+        PortRefresh(port);
+    }
+    PinIntUpdate();
+    ServiceInterrupts();
+}
+
+uint32_t SimRegisterRead(const volatile uint32_t * reg) {
+    size_t offset = GPIO_OFFSET(reg);
+    uint8_t timer = TimerIndex(reg);
+    uint8_t uart = UartIndex(reg);
+    uint8_t ssp = SspIndex(reg);
+    uint32_t result;
+
+    CountAccess(false);
+    if (ssp < SIM_SSPS) {
+        uint64_t queued = SspQueued(ssp);
+
+        if (reg == &sim_ssp[ssp].SR) {
+            result = ((queued <= 1) ? SSP_STAT_TFE : 0) | ((queued <= SIM_SSP_FIFO) ? SSP_STAT_TNF : 0) |
+                     ((queued > 0) ? SSP_STAT_BSY : 0);
+        } else if ((reg == &sim_ssp[ssp].DR) || (reg == &sim_ssp[ssp].ICR)) {
+            /* No se modela la recepción */
+            result = 0;
+        } else {
+            result = *reg;
+        }
+    } else if (reg == &sim_eeprom.INTSTAT) {
+        EepromUpdate();
+        result = state.eepromStatus;
+    } else if (reg == &sim_eeprom.INTEN) {
+        result = state.eepromEnabled;
+    } else if ((reg == &sim_gpdma.INTSTAT) || (reg == &sim_gpdma.INTTCSTAT)) {
+        result = state.dmaTerminal & DmaInterruptMask();
+    } else if (reg == &sim_gpdma.RAWINTTCSTAT) {
+        result = state.dmaTerminal;
+    } else if (reg == &sim_gpdma.ENBLDCHNS) {
+        result = 0;
+        for (uint8_t channel = 0; channel < GPDMA_NUMBER_CHANNELS; channel++) {
+            result |= (sim_gpdma.CH[channel].CONFIG & GPDMA_DMACCxConfig_E) ? (1u << channel) : 0;
+        }
+    } else if (uart < SIM_UARTS) {
+        LPC_USART_T * block = &sim_uart[uart];
+        bool latch = (block->LCR & UART_LCR_DLAB_EN) != 0;
+        sim_uart_rx_t * rx = &state.uartRx[uart];
+        uint64_t queued = UartQueued(uart);
+
+        if ((reg == &block->RBR) && latch) {
+            result = state.uartDivisor[uart] & 0xFF;
+        } else if ((reg == &block->DLM) && latch) {
+            result = state.uartDivisor[uart] >> 8;
+        } else if (reg == &block->RBR) {
+            result = 0;
+            if (rx->fifoCount > 0) {
+                result = rx->fifo[rx->fifoFirst];
+                rx->fifoFirst = (rx->fifoFirst + 1) % SIM_UART_FIFO;
+                rx->fifoCount--;
+                UartUpdate();
+            }
+        } else if (reg == &block->LSR) {
+            result = ((queued <= 1) ? UART_LSR_THRE : 0) | ((queued == 0) ? UART_LSR_TEMT : 0) |
+                     ((rx->fifoCount > 0) ? UART_LSR_RDR : 0);
+        } else if (reg == &block->IIR) {
+            /* Se modelan el dato recibido, que tiene prioridad, y la FIFO de transmisión vacía */
+            if ((block->IER & UART_IER_RBRINT) && (rx->fifoCount > 0)) {
+                result = 0x04;
+            } else {
+                result = ((block->IER & UART_IER_THREINT) && (queued <= 1)) ? 0x02 : 0x01;
+            }
+        } else {
+            result = *reg;
+        }
+    } else if (timer < SIM_TIMERS) {
+        TimerSync(timer, state.cycles);
+        result = *reg;
+    } else if (GPIO_IN(offset, PIN)) {
+        uint32_t port = GPIO_PORT(offset, PIN);
+        result = (port < SIM_GPIO_PORTS) ? PortLevel(port) : 0;
+    } else if (GPIO_IN(offset, MPIN)) {
+        uint32_t port = GPIO_PORT(offset, MPIN);
+        result = (port < SIM_GPIO_PORTS) ? PortLevel(port) & ~sim_gpio_port.MASK[port] : 0;
+    } else if (GPIO_IN(offset, SET)) {
+        uint32_t port = GPIO_PORT(offset, SET);
+        result = (port < SIM_GPIO_PORTS) ? state.latch[port] : 0;
+    } else if (GPIO_IN(offset, CLR) || GPIO_IN(offset, NOT)) {
+        result = 0;
+    } else {
+        result = *reg;
+    }
+    ServiceInterrupts();
+    return result;
+}
+
+void SimChipReset(void) {
+    memset(&state, 0, sizeof(state));
+    memset((void *)&sim_gpio_port, 0, sizeof(sim_gpio_port));
+    memset((void *)&sim_scu, 0, sizeof(sim_scu));
+    memset((void *)&sim_systick, 0, sizeof(sim_systick));
+    memset((void *)&sim_core_debug, 0, sizeof(sim_core_debug));
+    memset((void *)&sim_dwt, 0, sizeof(sim_dwt));
+    memset((void *)&sim_pin_int, 0, sizeof(sim_pin_int));
+    memset((void *)sim_timer, 0, sizeof(sim_timer));
+    memset((void *)sim_uart, 0, sizeof(sim_uart));
+    memset((void *)sim_ssp, 0, sizeof(sim_ssp));
+    memset((void *)&sim_gpdma, 0, sizeof(sim_gpdma));
+    memset((void *)&sim_eeprom, 0, sizeof(sim_eeprom));
+    for (uint8_t index = 0; index < SIM_UARTS; index++) {
+        sim_uart[index].LCR = UART_LCR_WLEN8;
+        sim_uart[index].TER1 = UART_TER1_TXEN;
+    }
+}
+
+void SimGpioSetInput(uint8_t port, uint8_t pin, bool level) {
+    if (port < SIM_GPIO_PORTS) {
+        if (level) {
+            state.input[port] |= (1u << pin);
+        } else {
+            state.input[port] &= ~(1u << pin);
+        }
+        PortRefresh(port);
+    }
+    ServiceInterrupts();
+}
+
+bool SimScheduleCallback(uint64_t cycle, sim_callback_t callback, void * object) {
+    uint8_t index = state.callbackCount;
+
+    if (index >= SIM_CALLBACKS) {
+        return false;
+    }
+    /* Las acciones que vencen en el mismo ciclo se ejecutan en el orden en que se programaron */
+    while ((index > 0) && (state.callbacks[index - 1].cycle > cycle)) {
+        state.callbacks[index] = state.callbacks[index - 1];
+        index--;
+    }
+    state.callbacks[index].cycle = cycle;
+    state.callbacks[index].callback = callback;
+    state.callbacks[index].object = object;
+    state.callbackCount++;
+    state.nextValid = false;
+    return true;
+}
+
+void SimSetPortObserver(sim_port_observer_t observer, void * object) {
+    state.observer = observer;
+    state.observerObject = object;
+}
+
+uint32_t SimGpioGetOutputs(uint8_t port) {
+    return (port < SIM_GPIO_PORTS) ? state.latch[port] : 0;
+}
+
+void SimUartSetOutput(LPC_USART_T * uart, FILE * file) {
+    uint8_t index = UartIndex(&uart->LCR);
+
+    if (index < SIM_UARTS) {
+        state.uartOutput[index] = file;
+    }
+}
+
+size_t SimUartReceive(LPC_USART_T * uart, const uint8_t * data, size_t size) {
+    uint8_t index = UartIndex(&uart->LCR);
+    size_t count = 0;
+
+    if (index < SIM_UARTS) {
+        sim_uart_rx_t * rx = &state.uartRx[index];
+
+        /* El primer byte de una serie termina de llegar un carácter después de empezar */
+        if ((size > 0) && (rx->lineCount == 0)) {
+            DueUpdate(&rx->lineDue, state.cycles + UartCharCycles(index));
+        }
+        while ((count < size) && (rx->lineCount < SIM_UART_RX_BUFFER)) {
+            rx->line[(rx->lineFirst + rx->lineCount) % SIM_UART_RX_BUFFER] = data[count++];
+            rx->lineCount++;
+        }
+    }
+    return count;
+}
+
+const char * SimUartOpenPty(LPC_USART_T * uart, const char * link) {
+    uint8_t index = UartIndex(&uart->LCR);
+    struct termios mode;
+    const char * name = NULL;
+    sim_pty_t * pty;
+    FILE * output;
+
+    if (index >= SIM_UARTS) {
+        return NULL;
+    }
+    pty = &ptys[index];
+    pty->master = posix_openpt(O_RDWR | O_NOCTTY);
+    if ((pty->master < 0) || (grantpt(pty->master) != 0) || (unlockpt(pty->master) != 0) ||
+        ((name = ptsname(pty->master)) == NULL)) {
+        if (pty->master >= 0) {
+            close(pty->master);
+        }
+        return NULL;
+    }
+    snprintf(pty->name, sizeof(pty->name), "%s", name);
+
+    /* El lado externo queda abierto y en modo crudo, para que no devuelva como eco lo que transmite el UART */
+    pty->slave = open(pty->name, O_RDWR | O_NOCTTY);
+    if ((pty->slave >= 0) && (tcgetattr(pty->slave, &mode) == 0)) {
+        cfmakeraw(&mode);
+        tcsetattr(pty->slave, TCSANOW, &mode);
+    }
+    /* Si nadie lee la pseudoterminal, lo que no entra en ella se descarta en lugar de detener la simulación */
+    fcntl(pty->master, F_SETFL, fcntl(pty->master, F_GETFL) | O_NONBLOCK);
+    output = fdopen(dup(pty->master), "wb");
+    if (output != NULL) {
+        setvbuf(output, NULL, _IONBF, 0);
+    }
+    SimUartSetOutput(uart, output);
+    if (link != NULL) {
+        unlink(link);
+        if (symlink(pty->name, link) != 0) {
+            perror(link);
+        }
+    }
+
+    pty->uart = uart;
+    pty->startCycle = state.cycles;
+    clock_gettime(CLOCK_MONOTONIC, &pty->start);
+    SimScheduleCallback(state.cycles, PtyPoll, pty);
+    return pty->name;
+}
+
+size_t SimSspRead(LPC_SSP_T * ssp, uint8_t * data, size_t size) {
+    uint8_t index = SspIndex(&ssp->CR0);
+    size_t count = 0;
+
+    if (index < SIM_SSPS) {
+        while ((count < size) && (state.sspCount[index] > 0) &&
+               (state.sspLog[index][state.sspFirst[index]].cycle <= state.cycles)) {
+            data[count++] = state.sspLog[index][state.sspFirst[index]].data;
+            state.sspFirst[index] = (state.sspFirst[index] + 1) % SIM_SSP_LOG;
+            state.sspCount[index]--;
+        }
+    }
+    return count;
+}
+
+bool SimEepromOpen(const char * path) {
+    FILE * file = fopen(path, "r+b");
+
+    if (file == NULL) {
+        file = fopen(path, "w+b");
+    }
+    if (file == NULL) {
+        return false;
+    }
+    if (fread(sim_eeprom_memory, 1, sizeof(sim_eeprom_memory), file) < sizeof(sim_eeprom_memory)) {
+        /* Un archivo nuevo o más corto que la EEPROM se completa con el contenido actual */
+        fseek(file, 0, SEEK_SET);
+        fwrite(sim_eeprom_memory, sizeof(sim_eeprom_memory), 1, file);
+        fflush(file);
+    }
+    if (eepromFile != NULL) {
+        fclose(eepromFile);
+    }
+    eepromFile = file;
+    return true;
+}
+
+void SimEepromGetStats(sim_eeprom_stats_t * stats) {
+    *stats = state.eepromStats;
+}
+
+uint32_t SimEepromGetPageCycles(uint16_t page) {
+    return (page < EEPROM_PAGE_NUM) ? state.eepromCycles[page] : 0;
+}
+
+void SimConfigureFromEnvironment(LPC_USART_T * trace, LPC_USART_T * console) {
+    const char * path = getenv("RELOJ_TRACE");
+
+    if (path != NULL) {
+        SimUartSetOutput(trace, fopen(path, "wb"));
+    }
+    path = getenv("RELOJ_CONSOLE");
+    if (path != NULL) {
+        const char * name = SimUartOpenPty(console, (*path != '\0') ? path : NULL);
+        fprintf(stderr, "consola: %s\n", (name != NULL) ? name : "no se pudo abrir la pseudoterminal");
+    }
+    path = getenv("RELOJ_EEPROM");
+    if (path != NULL) {
+        SimEepromOpen(path);
+    }
+}
+
+void SimReportPrintf(const char * format, ...) {
+    va_list arguments;
+
+    va_start(arguments, format);
+    vprintf(format, arguments);
+    va_end(arguments);
+}
+
+uint32_t SimScuGetMode(uint8_t port, uint8_t pin) {
+    return sim_scu.SFSP[port][pin];
+}
+
+uint64_t SimGetCycles(void) {
+    return state.cycles;
+}
+
+void SimAddCycles(uint32_t cycles) {
+    Advance(state.cycles + cycles);
+    DispatchInterrupts();
+}
+
+DWT_Type * SimDwt(void) {
+    if (sim_dwt.CYCCNT != state.dwtLast) {
+        /* La aplicación escribió CYCCNT desde la última consulta */
+        state.dwtBase = (uint32_t)state.cycles - sim_dwt.CYCCNT;
+    }
+    if ((sim_dwt.CTRL & DWT_CTRL_CYCCNTENA_Msk) && (sim_core_debug.DEMCR & CoreDebug_DEMCR_TRCENA_Msk)) {
+        sim_dwt.CYCCNT = (uint32_t)state.cycles - state.dwtBase;
+    }
+    state.dwtLast = sim_dwt.CYCCNT;
+    return &sim_dwt;
+}
+
+uint64_t SimGetSleepCycles(void) {
+    return state.sleepCycles;
+}
+
+void SimGetStats(sim_chip_stats_t * stats) {
+    *stats = state.stats;
+}
+
+void Chip_GPIO_Init(LPC_GPIO_T * pGPIO) {
+    (void)pGPIO;
+}
+
+void Chip_GPIO_SetPinState(LPC_GPIO_T * pGPIO, uint8_t port, uint8_t pin, bool setting) {
+    (void)pGPIO;
+    ByteWrite(port, pin, setting);
+}
+
+bool Chip_GPIO_GetPinState(LPC_GPIO_T * pGPIO, uint8_t port, uint8_t pin) {
+    (void)pGPIO;
+    return ByteRead(port, pin);
+}
+
+bool Chip_GPIO_ReadPortBit(LPC_GPIO_T * pGPIO, uint32_t port, uint8_t pin) {
+    (void)pGPIO;
+    return ByteRead(port, pin);
+}
+
+void Chip_GPIO_SetPinDIR(LPC_GPIO_T * pGPIO, uint8_t port, uint8_t pin, bool output) {
+    Chip_GPIO_SetPortDIR(pGPIO, port, 1u << pin, output);
+}
+
+void Chip_GPIO_SetPortDIR(LPC_GPIO_T * pGPIO, uint8_t port, uint32_t pinMask, bool outSet) {
+    uint32_t dir = SimRegisterRead(&pGPIO->DIR[port]);
+    if (outSet) {
+        dir |= pinMask;
+    } else {
+        dir &= ~pinMask;
+    }
+    SimRegisterWrite(&pGPIO->DIR[port], dir);
+}
+
+uint32_t Chip_GPIO_GetPortDIR(LPC_GPIO_T * pGPIO, uint8_t port) {
+    return SimRegisterRead(&pGPIO->DIR[port]);
+}
+
+void Chip_GPIO_SetPortValue(LPC_GPIO_T * pGPIO, uint8_t port, uint32_t value) {
+    SimRegisterWrite(&pGPIO->PIN[port], value);
+}
+
+uint32_t Chip_GPIO_GetPortValue(LPC_GPIO_T * pGPIO, uint8_t port) {
+    return SimRegisterRead(&pGPIO->PIN[port]);
+}
+
+void Chip_GPIO_SetPortMask(LPC_GPIO_T * pGPIO, uint8_t port, uint32_t mask) {
+    SimRegisterWrite(&pGPIO->MASK[port], mask);
+}
+
+void Chip_GPIO_SetMaskedPortValue(LPC_GPIO_T * pGPIO, uint8_t port, uint32_t value) {
+    SimRegisterWrite(&pGPIO->MPIN[port], value);
+}
+
+uint32_t Chip_GPIO_GetMaskedPortValue(LPC_GPIO_T * pGPIO, uint8_t port) {
+    return SimRegisterRead(&pGPIO->MPIN[port]);
+}
+
+void Chip_GPIO_SetValue(LPC_GPIO_T * pGPIO, uint8_t port, uint32_t bitValue) {
+    SimRegisterWrite(&pGPIO->SET[port], bitValue);
+}
+
+void Chip_GPIO_ClearValue(LPC_GPIO_T * pGPIO, uint8_t port, uint32_t bitValue) {
+    SimRegisterWrite(&pGPIO->CLR[port], bitValue);
+}
+
+void Chip_GPIO_SetPortToggle(LPC_GPIO_T * pGPIO, uint8_t port, uint32_t pins) {
+    SimRegisterWrite(&pGPIO->NOT[port], pins);
+}
+
+void Chip_GPIO_SetPinToggle(LPC_GPIO_T * pGPIO, uint8_t port, uint8_t pin) {
+    SimRegisterWrite(&pGPIO->NOT[port], 1u << pin);
+}
+
+void Chip_SCU_PinMuxSet(uint8_t port, uint8_t pin, uint16_t modefunc) {
+    SimRegisterWrite(&LPC_SCU->SFSP[port][pin], modefunc);
+}
+
+void Chip_SCU_SetPinMuxing(const PINMUX_GRP_T * pinArray, uint32_t arrayLength) {
+    for (uint32_t index = 0; index < arrayLength; index++) {
+        Chip_SCU_PinMuxSet(pinArray[index].pingrp, pinArray[index].pinnum, pinArray[index].modefunc);
+    }
+}
+
+void Chip_SCU_GPIOIntPinSel(uint8_t PortSel, uint8_t PortNum, uint8_t PinNum) {
+    uint32_t shift = 8 * (PortSel % 4);
+    uint32_t value = SimRegisterRead(&LPC_SCU->PINTSEL[PortSel / 4]);
+
+    value = (value & ~(0xFFu << shift)) | ((uint32_t)((PortNum << 5) | PinNum) << shift);
+    SimRegisterWrite(&LPC_SCU->PINTSEL[PortSel / 4], value);
+}
+
+void Chip_PININT_Init(LPC_PIN_INT_T * pPININT) {
+    (void)pPININT;
+}
+
+void Chip_PININT_SetPinModeEdge(LPC_PIN_INT_T * pPININT, uint32_t pins) {
+    SimRegisterWrite(&pPININT->ISEL, SimRegisterRead(&pPININT->ISEL) & ~pins);
+}
+
+void Chip_PININT_EnableIntHigh(LPC_PIN_INT_T * pPININT, uint32_t pins) {
+    SimRegisterWrite(&pPININT->SIENR, pins);
+}
+
+void Chip_PININT_DisableIntHigh(LPC_PIN_INT_T * pPININT, uint32_t pins) {
+    SimRegisterWrite(&pPININT->CIENR, pins);
+}
+
+void Chip_PININT_EnableIntLow(LPC_PIN_INT_T * pPININT, uint32_t pins) {
+    SimRegisterWrite(&pPININT->SIENF, pins);
+}
+
+void Chip_PININT_DisableIntLow(LPC_PIN_INT_T * pPININT, uint32_t pins) {
+    SimRegisterWrite(&pPININT->CIENF, pins);
+}
+
+uint32_t Chip_PININT_GetRiseStates(LPC_PIN_INT_T * pPININT) {
+    return SimRegisterRead(&pPININT->RISE);
+}
+
+void Chip_PININT_ClearRiseStates(LPC_PIN_INT_T * pPININT, uint32_t pins) {
+    SimRegisterWrite(&pPININT->RISE, pins);
+}
+
+uint32_t Chip_PININT_GetFallStates(LPC_PIN_INT_T * pPININT) {
+    return SimRegisterRead(&pPININT->FALL);
+}
+
+void Chip_PININT_ClearFallStates(LPC_PIN_INT_T * pPININT, uint32_t pins) {
+    SimRegisterWrite(&pPININT->FALL, pins);
+}
+
+uint32_t Chip_PININT_GetIntStatus(LPC_PIN_INT_T * pPININT) {
+    return SimRegisterRead(&pPININT->IST);
+}
+
+void Chip_PININT_ClearIntStatus(LPC_PIN_INT_T * pPININT, uint32_t pins) {
+    SimRegisterWrite(&pPININT->IST, pins);
+}
+
+void Chip_TIMER_Init(LPC_TIMER_T * pTMR) {
+    (void)pTMR;
+}
+
+void Chip_TIMER_Enable(LPC_TIMER_T * pTMR) {
+    SimRegisterWrite(&pTMR->TCR, SimRegisterRead(&pTMR->TCR) | TIMER_ENABLE);
+}
+
+void Chip_TIMER_Disable(LPC_TIMER_T * pTMR) {
+    SimRegisterWrite(&pTMR->TCR, SimRegisterRead(&pTMR->TCR) & ~TIMER_ENABLE);
+}
+
+void Chip_TIMER_Reset(LPC_TIMER_T * pTMR) {
+    uint32_t control = SimRegisterRead(&pTMR->TCR);
+
+    SimRegisterWrite(&pTMR->TCR, TIMER_RESET);
+    SimRegisterWrite(&pTMR->TCR, control);
+}
+
+uint32_t Chip_TIMER_ReadCount(LPC_TIMER_T * pTMR) {
+    return SimRegisterRead(&pTMR->TC);
+}
+
+void Chip_TIMER_PrescaleSet(LPC_TIMER_T * pTMR, uint32_t prescale) {
+    SimRegisterWrite(&pTMR->PR, prescale);
+}
+
+void Chip_TIMER_SetMatch(LPC_TIMER_T * pTMR, int8_t matchnum, uint32_t matchval) {
+    SimRegisterWrite(&pTMR->MR[matchnum], matchval);
+}
+
+void Chip_TIMER_MatchEnableInt(LPC_TIMER_T * pTMR, int8_t matchnum) {
+    SimRegisterWrite(&pTMR->MCR, SimRegisterRead(&pTMR->MCR) | TIMER_INT_ON_MATCH(matchnum));
+}
+
+void Chip_TIMER_MatchDisableInt(LPC_TIMER_T * pTMR, int8_t matchnum) {
+    SimRegisterWrite(&pTMR->MCR, SimRegisterRead(&pTMR->MCR) & ~TIMER_INT_ON_MATCH(matchnum));
+}
+
+void Chip_TIMER_ResetOnMatchEnable(LPC_TIMER_T * pTMR, int8_t matchnum) {
+    SimRegisterWrite(&pTMR->MCR, SimRegisterRead(&pTMR->MCR) | TIMER_RESET_ON_MATCH(matchnum));
+}
+
+void Chip_TIMER_ResetOnMatchDisable(LPC_TIMER_T * pTMR, int8_t matchnum) {
+    SimRegisterWrite(&pTMR->MCR, SimRegisterRead(&pTMR->MCR) & ~TIMER_RESET_ON_MATCH(matchnum));
+}
+
+bool Chip_TIMER_MatchPending(LPC_TIMER_T * pTMR, int8_t matchnum) {
+    return (SimRegisterRead(&pTMR->IR) & TIMER_IR_CLR(matchnum)) != 0;
+}
+
+void Chip_TIMER_ClearMatch(LPC_TIMER_T * pTMR, int8_t matchnum) {
+    SimRegisterWrite(&pTMR->IR, TIMER_IR_CLR(matchnum));
+}
+
+uint32_t Chip_Clock_GetRate(CHIP_CCU_CLK_T clk) {
+    (void)clk;
+    return SystemCoreClock;
+}
+
+void Chip_UART_Init(LPC_USART_T * pUART) {
+    Chip_UART_SetupFIFOS(pUART, UART_FCR_FIFO_EN | UART_FCR_RX_RS | UART_FCR_TX_RS);
+    SimRegisterWrite(&pUART->IER, 0);
+    SimRegisterWrite(&pUART->LCR, UART_LCR_WLEN8 | UART_LCR_SBS_1BIT | UART_LCR_PARITY_DIS);
+    SimRegisterWrite(&pUART->FDR, 0x10);
+}
+
+uint32_t Chip_UART_SetBaud(LPC_USART_T * pUART, uint32_t baudrate) {
+    uint32_t rate = SystemCoreClock;
+    uint32_t divisor = rate / (16 * baudrate);
+    uint32_t format = SimRegisterRead(&pUART->LCR);
+
+    if (divisor == 0) {
+        divisor = 1;
+    }
+    SimRegisterWrite(&pUART->LCR, format | UART_LCR_DLAB_EN);
+    SimRegisterWrite(&pUART->DLL, divisor & 0xFF);
+    SimRegisterWrite(&pUART->DLM, (divisor >> 8) & 0xFF);
+    SimRegisterWrite(&pUART->LCR, format & ~UART_LCR_DLAB_EN);
+    return rate / (16 * divisor);
+}
+
+void Chip_UART_ConfigData(LPC_USART_T * pUART, uint32_t config) {
+    uint32_t format = SimRegisterRead(&pUART->LCR) & UART_LCR_DLAB_EN;
+    SimRegisterWrite(&pUART->LCR, format | config);
+}
+
+void Chip_UART_SetupFIFOS(LPC_USART_T * pUART, uint32_t fcr) {
+    SimRegisterWrite(&pUART->FCR, fcr);
+}
+
+void Chip_UART_TXEnable(LPC_USART_T * pUART) {
+    SimRegisterWrite(&pUART->TER1, UART_TER1_TXEN);
+}
+
+void Chip_UART_IntEnable(LPC_USART_T * pUART, uint32_t intMask) {
+    SimRegisterWrite(&pUART->IER, SimRegisterRead(&pUART->IER) | intMask);
+}
+
+void Chip_UART_IntDisable(LPC_USART_T * pUART, uint32_t intMask) {
+    SimRegisterWrite(&pUART->IER, SimRegisterRead(&pUART->IER) & ~intMask);
+}
+
+uint32_t Chip_UART_ReadIntIDReg(LPC_USART_T * pUART) {
+    return SimRegisterRead(&pUART->IIR);
+}
+
+uint32_t Chip_UART_ReadLineStatus(LPC_USART_T * pUART) {
+    return SimRegisterRead(&pUART->LSR);
+}
+
+void Chip_UART_SendByte(LPC_USART_T * pUART, uint8_t data) {
+    SimRegisterWrite(&pUART->THR, data);
+}
+
+uint8_t Chip_UART_ReadByte(LPC_USART_T * pUART) {
+    return SimRegisterRead(&pUART->RBR);
+}
+
+void Chip_SSP_Init(LPC_SSP_T * pSSP) {
+    Chip_SSP_SetMaster(pSSP, true);
+    Chip_SSP_SetFormat(pSSP, SSP_BITS_8, SSP_FRAMEFORMAT_SPI, SSP_CLOCK_CPHA0_CPOL0);
+    Chip_SSP_SetBitRate(pSSP, 100000);
+}
+
+void Chip_SSP_SetFormat(LPC_SSP_T * pSSP, uint32_t bits, uint32_t frameFormat, uint32_t clockMode) {
+    uint32_t control = SimRegisterRead(&pSSP->CR0) & ~0xFFu;
+    SimRegisterWrite(&pSSP->CR0, control | bits | frameFormat | clockMode);
+}
+
+void Chip_SSP_SetMaster(LPC_SSP_T * pSSP, bool master) {
+    uint32_t control = SimRegisterRead(&pSSP->CR1);
+    SimRegisterWrite(&pSSP->CR1, master ? (control & ~SSP_CR1_SLAVE_EN) : (control | SSP_CR1_SLAVE_EN));
+}
+
+void Chip_SSP_SetBitRate(LPC_SSP_T * pSSP, uint32_t bitRate) {
+    uint32_t rate = Chip_Clock_GetRate((pSSP == LPC_SSP0) ? CLK_MX_SSP0 : CLK_MX_SSP1);
+    uint32_t prescale = 2;
+    uint32_t divisor = 0;
+
+    /* Mismo recorrido que LPCOpen: el menor divisor, y luego el menor preescalador, que no supera la velocidad */
+    while (rate / ((divisor + 1) * prescale) > bitRate) {
+        divisor++;
+        if (divisor > 0xFF) {
+            divisor = 0;
+            prescale += 2;
+        }
+    }
+    SimRegisterWrite(&pSSP->CR0, (SimRegisterRead(&pSSP->CR0) & ~0xFF00u) | (divisor << 8));
+    SimRegisterWrite(&pSSP->CPSR, prescale);
+}
+
+void Chip_SSP_Enable(LPC_SSP_T * pSSP) {
+    SimRegisterWrite(&pSSP->CR1, SimRegisterRead(&pSSP->CR1) | SSP_CR1_SSP_EN);
+}
+
+void Chip_SSP_Disable(LPC_SSP_T * pSSP) {
+    SimRegisterWrite(&pSSP->CR1, SimRegisterRead(&pSSP->CR1) & ~SSP_CR1_SSP_EN);
+}
+
+void Chip_SSP_DMA_Enable(LPC_SSP_T * pSSP) {
+    SimRegisterWrite(&pSSP->DMACR, SimRegisterRead(&pSSP->DMACR) | SSP_DMA_BITMASK);
+}
+
+void Chip_SSP_DMA_Disable(LPC_SSP_T * pSSP) {
+    SimRegisterWrite(&pSSP->DMACR, SimRegisterRead(&pSSP->DMACR) & ~SSP_DMA_BITMASK);
+}
+
+FlagStatus Chip_SSP_GetStatus(LPC_SSP_T * pSSP, SSP_STATUS_T Stat) {
+    return (SimRegisterRead(&pSSP->SR) & Stat) ? SET : RESET;
+}
+
+void Chip_SSP_SendFrame(LPC_SSP_T * pSSP, uint16_t tx_data) {
+    SimRegisterWrite(&pSSP->DR, tx_data);
+}
+
+void Chip_GPDMA_Init(LPC_GPDMA_T * pGPDMA) {
+    /* Como en LPCOpen, los canales quedan libres pero los habilitados siguen transfiriendo */
+    SimRegisterWrite(&pGPDMA->INTTCCLEAR, 0xFF);
+    SimRegisterWrite(&pGPDMA->CONFIG, 1);
+    state.dmaClaimed = 0;
+}
+
+uint8_t Chip_GPDMA_GetFreeChannel(LPC_GPDMA_T * pGPDMA, uint32_t PeripheralConnection_ID) {
+    uint32_t enabled = SimRegisterRead(&pGPDMA->ENBLDCHNS) | state.dmaClaimed;
+
+    (void)PeripheralConnection_ID;
+    for (uint8_t channel = 0; channel < GPDMA_NUMBER_CHANNELS; channel++) {
+        if (!(enabled & (1u << channel))) {
+            return channel;
+        }
+    }
+    return GPDMA_NUMBER_CHANNELS;
+}
+
+Status Chip_GPDMA_Transfer(LPC_GPDMA_T * pGPDMA, uint8_t ChannelNum, uintptr_t src, uintptr_t dst,
+                           GPDMA_FLOW_CONTROL_T TransferType, uint32_t Size) {
+    GPDMA_CH_T * channel = &pGPDMA->CH[ChannelNum];
+    bool transmit = (TransferType == GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA);
+    uintptr_t connection = transmit ? dst : src;
+    LPC_SSP_T * ssp = ((connection == GPDMA_CONN_SSP0_Tx) || (connection == GPDMA_CONN_SSP0_Rx)) ? LPC_SSP0 : LPC_SSP1;
+    uint32_t config = GPDMA_DMACCxConfig_E | GPDMA_DMACCxConfig_TransferType(TransferType) | GPDMA_DMACCxConfig_ITC;
+
+    /* Solo se modelan las transferencias de memoria a la transmisión de un SSP y de su recepción a memoria */
+    if ((ChannelNum >= GPDMA_NUMBER_CHANNELS) || (Size > 0xFFF) ||
+        (transmit && (dst != GPDMA_CONN_SSP0_Tx) && (dst != GPDMA_CONN_SSP1_Tx)) ||
+        (!transmit && ((TransferType != GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA) ||
+                       ((src != GPDMA_CONN_SSP0_Rx) && (src != GPDMA_CONN_SSP1_Rx))))) {
+        return ERROR;
+    }
+    state.dmaClaimed |= 1u << ChannelNum;
+    state.dmaSource[ChannelNum] = transmit ? src : 0;
+    state.dmaTarget[ChannelNum] = transmit ? 0 : dst;
+    state.dmaNext[ChannelNum] = 0;
+    config |= transmit ? GPDMA_DMACCxConfig_DestPeripheral(dst) : GPDMA_DMACCxConfig_SrcPeripheral(src);
+    SimRegisterWrite(&pGPDMA->INTTCCLEAR, 1u << ChannelNum);
+    SimRegisterWrite(&channel->SRCADDR, transmit ? (uint32_t)src : (uint32_t)(uintptr_t)&ssp->DR);
+    SimRegisterWrite(&channel->DESTADDR, transmit ? (uint32_t)(uintptr_t)&ssp->DR : (uint32_t)dst);
+    SimRegisterWrite(&channel->LLI, 0);
+    SimRegisterWrite(&channel->CONTROL, GPDMA_DMACCxControl_TransferSize(Size) | GPDMA_DMACCxControl_I);
+    SimRegisterWrite(&channel->CONFIG, config);
+    return SUCCESS;
+}
+
+Status Chip_GPDMA_InitDescriptor(LPC_GPDMA_T * pGPDMA, DMA_TransferDescriptor_t * DMADescriptor, uintptr_t src,
+                                 uintptr_t dst, uint32_t Size, GPDMA_FLOW_CONTROL_T TransferType,
+                                 const DMA_TransferDescriptor_t * NextDescriptor) {
+    bool transmit = (TransferType == GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA);
+    volatile uint32_t * peripheral = DmaPeripheral(transmit ? dst : src);
+
+    (void)pGPDMA;
+    /* Solo se modelan las transferencias entre memoria y un periférico */
+    if ((!transmit && (TransferType != GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA)) || (peripheral == NULL) ||
+        (Size > 0xFFF)) {
+        return ERROR;
+    }
+    DMADescriptor->src = transmit ? src : (uintptr_t)peripheral;
+    DMADescriptor->dst = transmit ? (uintptr_t)peripheral : dst;
+    DMADescriptor->lli = (uintptr_t)NextDescriptor;
+    /* Como en LPCOpen, solo el último elemento de la lista pide la interrupción */
+    DMADescriptor->ctrl = GPDMA_DMACCxControl_TransferSize(Size);
+    if (NextDescriptor == NULL) {
+        DMADescriptor->ctrl |= GPDMA_DMACCxControl_I;
+    }
+    return SUCCESS;
+}
+
+Status Chip_GPDMA_SGTransfer(LPC_GPDMA_T * pGPDMA, uint8_t ChannelNum, const DMA_TransferDescriptor_t * DMADescriptor,
+                             GPDMA_FLOW_CONTROL_T TransferType) {
+    GPDMA_CH_T * channel = &pGPDMA->CH[ChannelNum];
+    bool transmit = (TransferType == GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA);
+    uint32_t connection = DmaConnection(transmit ? DMADescriptor->dst : DMADescriptor->src, transmit);
+    uint32_t config = GPDMA_DMACCxConfig_E | GPDMA_DMACCxConfig_TransferType(TransferType) | GPDMA_DMACCxConfig_ITC;
+
+    if ((ChannelNum >= GPDMA_NUMBER_CHANNELS) || (connection == GPDMA_CONN_MEMORY) ||
+        (!transmit && (TransferType != GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA))) {
+        return ERROR;
+    }
+    state.dmaClaimed |= 1u << ChannelNum;
+    state.dmaSource[ChannelNum] = DMADescriptor->src;
+    state.dmaTarget[ChannelNum] = DMADescriptor->dst;
+    state.dmaNext[ChannelNum] = DMADescriptor->lli;
+    config |= transmit ? GPDMA_DMACCxConfig_DestPeripheral(connection) : GPDMA_DMACCxConfig_SrcPeripheral(connection);
+    SimRegisterWrite(&pGPDMA->INTTCCLEAR, 1u << ChannelNum);
+    SimRegisterWrite(&channel->SRCADDR, (uint32_t)DMADescriptor->src);
+    SimRegisterWrite(&channel->DESTADDR, (uint32_t)DMADescriptor->dst);
+    SimRegisterWrite(&channel->LLI, (uint32_t)DMADescriptor->lli);
+    SimRegisterWrite(&channel->CONTROL, DMADescriptor->ctrl);
+    SimRegisterWrite(&channel->CONFIG, config);
+    return SUCCESS;
+}
+
+Status Chip_GPDMA_Interrupt(LPC_GPDMA_T * pGPDMA, uint8_t ch) {
+    uint32_t mask = 1u << ch;
+
+    if ((SimRegisterRead(&pGPDMA->INTSTAT) & mask) &&
+        (SimRegisterRead(&pGPDMA->INTTCSTAT) & mask)) {
+        SimRegisterWrite(&pGPDMA->INTTCCLEAR, mask);
+        state.dmaClaimed &= ~mask;
+        return SUCCESS;
+    }
+    return ERROR;
+}
+
+void Chip_GPDMA_Stop(LPC_GPDMA_T * pGPDMA, uint8_t ChannelNum) {
+    SimRegisterWrite(&pGPDMA->CH[ChannelNum].CONFIG,
+                     SimRegisterRead(&pGPDMA->CH[ChannelNum].CONFIG) & ~GPDMA_DMACCxConfig_E);
+    SimRegisterWrite(&pGPDMA->INTTCCLEAR, 1u << ChannelNum);
+    state.dmaClaimed &= ~(1u << ChannelNum);
+}
+
+void Chip_EEPROM_Init(LPC_EEPROM_T * pEEPROM) {
+    /* Reloj de la EEPROM de 1,5 MHz y registro de página programado solo por comando, como en LPCOpen */
+    SimRegisterWrite(&pEEPROM->PWRDWN, 0);
+    SimRegisterWrite(&pEEPROM->CLKDIV, (SystemCoreClock / 1500000) - 1);
+    Chip_EEPROM_SetAutoProg(pEEPROM, EEPROM_AUTOPROG_OFF);
+}
+
+void Chip_EEPROM_SetAutoProg(LPC_EEPROM_T * pEEPROM, uint32_t mode) {
+    SimRegisterWrite(&pEEPROM->AUTOPROG, mode);
+}
+
+void Chip_EEPROM_SetCmd(LPC_EEPROM_T * pEEPROM, uint32_t cmd) {
+    SimRegisterWrite(&pEEPROM->CMD, cmd);
+}
+
+uint32_t Chip_EEPROM_GetIntStatus(LPC_EEPROM_T * pEEPROM) {
+    return SimRegisterRead(&pEEPROM->INTSTAT);
+}
+
+void Chip_EEPROM_ClearIntStatus(LPC_EEPROM_T * pEEPROM, uint32_t mask) {
+    SimRegisterWrite(&pEEPROM->INTSTATCLR, mask);
+}
+
+void NVIC_EnableIRQ(IRQn_Type IRQn) {
+    state.nvicEnabled |= 1ull << IRQn;
+    ServiceInterrupts();
+}
+
+void NVIC_DisableIRQ(IRQn_Type IRQn) {
+    state.nvicEnabled &= ~(1ull << IRQn);
+}
+
+void NVIC_SetPendingIRQ(IRQn_Type IRQn) {
+    state.nvicPending |= 1ull << IRQn;
+    ServiceInterrupts();
+}
+
+void NVIC_ClearPendingIRQ(IRQn_Type IRQn) {
+    /* Un periférico que mantiene su pedido lo vuelve a marcar como pendiente */
+    state.nvicPending &= ~(1ull << IRQn);
+    PinIntUpdate();
+    TimerUpdate();
+    UartUpdate();
+    DmaUpdate();
+}
+
+void SystemCoreClockUpdate(void) {
+}
+
+uint32_t SysTick_Config(uint32_t ticks) {
+    if ((ticks - 1) > SysTick_LOAD_RELOAD_Msk) {
+        return 1;
+    }
+    sim_systick.LOAD = ticks - 1;
+    sim_systick.VAL = 0;
+    sim_systick.CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+    state.tickDue = state.cycles + ticks;
+    state.tickPending = false;
+    return 0;
+}
+
+void __WFI(void) {
+    uint64_t due = NextEvent();
+
+    /* El núcleo duerme hasta el próximo vencimiento, salvo que ya haya una interrupción pendiente */
+    if (!state.tickPending && !(state.nvicPending & state.nvicEnabled) && (due != UINT64_MAX)) {
+        if (due > state.cycles) {
+            state.sleepCycles += due - state.cycles;
+        }
+        Advance(due);
+    }
+    ServiceInterrupts();
+}
+
+void __disable_irq(void) {
+    state.irqMasked = true;
+}
+
+void __enable_irq(void) {
+    state.irqMasked = false;
+    ServiceInterrupts();
+}
+
+void __DMB(void) {
+    __asm volatile("" ::: "memory");
+}
+
+__attribute__((weak)) void SysTick_Handler(void) {
+}
+
+__attribute__((weak)) void DMA_IRQHandler(void) {
+}
+
+__attribute__((weak)) void TIMER0_IRQHandler(void) {
+}
+
+__attribute__((weak)) void TIMER1_IRQHandler(void) {
+}
+
+__attribute__((weak)) void TIMER2_IRQHandler(void) {
+}
+
+__attribute__((weak)) void TIMER3_IRQHandler(void) {
+}
+
+__attribute__((weak)) void UART0_IRQHandler(void) {
+}
+
+__attribute__((weak)) void UART1_IRQHandler(void) {
+}
+
+__attribute__((weak)) void UART2_IRQHandler(void) {
+}
+
+__attribute__((weak)) void UART3_IRQHandler(void) {
+}
+
+__attribute__((weak)) void GPIO0_IRQHandler(void) {
+}
+
+__attribute__((weak)) void GPIO1_IRQHandler(void) {
+}
+
+__attribute__((weak)) void GPIO2_IRQHandler(void) {
+}
+
+__attribute__((weak)) void GPIO3_IRQHandler(void) {
+}
+
+__attribute__((weak)) void GPIO4_IRQHandler(void) {
+}
+
+__attribute__((weak)) void GPIO5_IRQHandler(void) {
+}
+
+__attribute__((weak)) void GPIO6_IRQHandler(void) {
+}
+
+__attribute__((weak)) void GPIO7_IRQHandler(void) {
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,808 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file simulate.c
+ ** @brief Simulador en tiempo virtual del programa completo
+ **
+ ** Ejecuta el programa sobre el backend simulado, que salta de un vencimiento al siguiente sin esperar el tiempo real.
+ ** Un guion indica cuándo se presionan y se sueltan las teclas, con rebotes, y los LEDs, las teclas y lo que muestra la
+ ** pantalla se registran en un archivo VCD que se puede abrir con GTKWave. Al terminar escribe un resumen en la salida
+ ** estándar y el tiempo real que llevó en la salida de errores. La simulación es determinista: con el mismo guion y la
+ ** misma semilla el resumen y el archivo VCD son idénticos, lo que permite compararlos entre versiones del programa.
+ **
+ ** Uso: `simulate [-t duración] [-k guion] [-w archivo.vcd] [-g señales] [-s semilla]`
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "chip.h"
+#include "display.h"
+#include "edu-ciaa.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief Tiempo de programa que se simula si no se indica otro */
+#define SIMULATE_DEFAULT_DURATION "24h"
+
+/**
+ * @brief Señales que se registran en el archivo VCD si no se indican otras.
+ *
+ * Deja afuera el LED verde, que cambia cientos de veces por segundo por la modulación de su brillo y ocupa casi todo el
+ * archivo; se agrega con `-g leds,teclas,pantalla`. Sus flancos se cuentan igual en el resumen.
+ */
+#define SIMULATE_DEFAULT_SIGNALS "led_red,led_blue,led_yellow,teclas,pantalla"
+
+/** @brief Rebotes que se generan en cada flanco de una tecla si el guion no indica otra cantidad */
+#define SIMULATE_DEFAULT_BOUNCES 3
+
+/** @brief Separación mínima entre dos rebotes, en microsegundos */
+#define SIMULATE_BOUNCE_MIN_US 20
+
+/** @brief Separación máxima entre dos rebotes, en microsegundos */
+#define SIMULATE_BOUNCE_MAX_US 400
+
+/** @brief Largo máximo del nombre de una señal */
+#define SIMULATE_NAME_SIZE 16
+
+/** @brief Cantidad de elementos de un arreglo */
+#define COUNT(array) (sizeof(array) / sizeof((array)[0]))
+
+/** @brief Genera la descripción de un pin de una tabla con campo */
+#define FIELD_PIN(name, field, port, pin, func, gpio, bit) {#field, gpio, bit},
+
+/** @brief Genera la descripción de un pin de una tabla sin campo */
+#define NAMED_PIN(name, port, pin, func, gpio, bit) {#name, gpio, bit},
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Pin de la placa que observa el simulador.
+ */
+typedef struct board_pin_s {
+    const char * name; /**< Nombre del pin en las tablas de la placa */
+    uint8_t gpio;      /**< Puerto GPIO */
+    uint8_t bit;       /**< Bit dentro del puerto */
+} board_pin_t;
+
+/**
+ * @brief Señal registrada en el archivo VCD.
+ */
+typedef struct signal_s {
+    char name[SIMULATE_NAME_SIZE]; /**< Nombre de la señal en el archivo VCD */
+    const char * group;            /**< Grupo al que pertenece, que se vuelve un módulo en el archivo VCD */
+    uint8_t width;                 /**< Cantidad de bits: uno para un pin, ocho para el patrón de un dígito */
+    uint8_t gpio;                  /**< Puerto GPIO del pin, o número de dígito para los patrones */
+    uint8_t bit;                   /**< Bit del pin dentro del puerto */
+    bool enabled;                  /**< La señal se escribe en el archivo VCD */
+    uint32_t value;                /**< Último valor */
+    uint64_t changes;              /**< Cantidad de cambios de valor */
+} signal_t;
+
+/**
+ * @brief Cambio de nivel programado sobre una tecla.
+ */
+typedef struct key_edge_s {
+    uint64_t cycle; /**< Ciclo virtual en que ocurre */
+    uint32_t order; /**< Orden en que se generó, para desempatar los cambios en el mismo ciclo */
+    uint8_t key;    /**< Número de tecla */
+    bool level;     /**< Nivel eléctrico que impone; las teclas presionadas llevan el pin a nivel bajo */
+} key_edge_t;
+
+/**
+ * @brief Acciones de un guion sobre una tecla, en el orden de @ref ACTIONS.
+ */
+typedef enum key_action_e {
+    ACTION_PRESS,   /**< Presiona la tecla */
+    ACTION_RELEASE, /**< Suelta la tecla */
+    ACTION_PULSE,   /**< Presiona la tecla y la suelta después de una duración */
+} key_action_t;
+
+/**
+ * @brief Estado de la simulación.
+ */
+typedef struct simulation_s {
+    signal_t signals[64];             /**< Señales observadas */
+    uint8_t signalCount;              /**< Cantidad de señales observadas */
+    uint8_t patternBase;              /**< Posición de la primera señal con el patrón de un dígito */
+    uint32_t ports[SIM_GPIO_PORTS];   /**< Último nivel de cada puerto */
+    uint32_t watched[SIM_GPIO_PORTS]; /**< Pines de cada puerto que corresponden a alguna señal */
+    key_edge_t * edges;               /**< Cambios de nivel de las teclas ordenados por ciclo */
+    size_t edgeCount;                 /**< Cantidad de cambios de nivel */
+    size_t edgeCapacity;              /**< Lugar reservado para cambios de nivel */
+    size_t edgeNext;                  /**< Próximo cambio de nivel a aplicar */
+    uint32_t actions[8];              /**< Acciones del guion sobre cada tecla */
+    uint32_t seed;                    /**< Estado del generador de los tiempos de rebote */
+    FILE * vcd;                       /**< Archivo VCD, o `NULL` si no se registra la forma de onda */
+    bool recording;                   /**< Los cambios se escriben en el archivo VCD */
+    uint64_t vcdTime;                 /**< Último instante escrito en el archivo VCD, en nanosegundos */
+    uint64_t duration;                /**< Tiempo a simular, en ciclos */
+    struct timespec start;            /**< Instante real en que empezó la simulación */
+} simulation_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Convierte un tiempo escrito como una secuencia de números con unidades, como `1h30m` o `250ms`, a ciclos.
+ *
+ * @param text    Texto a convertir. Las unidades válidas son `h`, `m`, `s`, `ms` y `us`.
+ * @param cycles  Donde se guarda el resultado.
+ * @return `true` si el texto es válido.
+ */
+static bool ParseTime(const char * text, uint64_t * cycles);
+
+/**
+ * @brief Convierte ciclos a nanosegundos.
+ *
+ * @param cycles  Ciclos virtuales.
+ * @return Nanosegundos.
+ */
+static uint64_t CyclesToNs(uint64_t cycles);
+
+/**
+ * @brief Escribe un tiempo en ciclos como horas, minutos, segundos y milisegundos.
+ *
+ * @param file    Archivo de salida.
+ * @param cycles  Ciclos virtuales.
+ */
+static void PrintTime(FILE * file, uint64_t cycles);
+
+/**
+ * @brief Genera la separación hasta el próximo rebote con un generador pseudoaleatorio de semilla fija.
+ *
+ * @param sim  Estado de la simulación.
+ * @return Ciclos hasta el próximo rebote.
+ */
+static uint64_t BounceDelay(simulation_t * sim);
+
+/**
+ * @brief Agrega un cambio de nivel sobre una tecla.
+ *
+ * @param sim    Estado de la simulación.
+ * @param cycle  Ciclo virtual del cambio.
+ * @param key    Número de tecla.
+ * @param level  Nivel eléctrico que se impone.
+ */
+static void AddEdge(simulation_t * sim, uint64_t cycle, uint8_t key, bool level);
+
+/**
+ * @brief Agrega una transición de una tecla con sus rebotes, que termina en el nivel indicado.
+ *
+ * @param sim      Estado de la simulación.
+ * @param cycle    Ciclo virtual del primer flanco.
+ * @param key      Número de tecla.
+ * @param level    Nivel eléctrico final.
+ * @param bounces  Cantidad de idas y vueltas después del primer flanco.
+ */
+static void AddTransition(simulation_t * sim, uint64_t cycle, uint8_t key, bool level, uint32_t bounces);
+
+/**
+ * @brief Ordena los cambios de nivel por ciclo, y por orden de generación dentro de un mismo ciclo.
+ */
+static int CompareEdges(const void * first, const void * second);
+
+/**
+ * @brief Lee un guion de pulsaciones y agrega sus cambios de nivel.
+ *
+ * Cada línea tiene la forma `tiempo tecla acción [duración] [rebotes=N] [repetir=N] [cada=tiempo]`, donde la acción es
+ * `presionar`, `soltar` o `pulsar`, y esta última lleva la duración de la pulsación. Lo que sigue a `#` es un
+ * comentario.
+ *
+ * @param sim   Estado de la simulación.
+ * @param path  Nombre del archivo.
+ * @return `true` si el guion es válido.
+ */
+static bool LoadScript(simulation_t * sim, const char * path);
+
+/**
+ * @brief Arma la lista de señales a partir de las tablas de la placa.
+ *
+ * @param sim  Estado de la simulación.
+ */
+static void CreateSignals(simulation_t * sim);
+
+/**
+ * @brief Habilita las señales de una lista separada por comas de nombres de señales o de grupos.
+ *
+ * @param sim   Estado de la simulación.
+ * @param list  Lista de nombres.
+ * @return `true` si todos los nombres son válidos.
+ */
+static bool SelectSignals(simulation_t * sim, const char * list);
+
+/**
+ * @brief Escribe un valor de una señal en el archivo VCD.
+ *
+ * @param sim    Estado de la simulación.
+ * @param index  Posición de la señal.
+ */
+static void WriteValue(simulation_t * sim, uint8_t index);
+
+/**
+ * @brief Escribe las definiciones y los valores iniciales del archivo VCD.
+ *
+ * @param sim  Estado de la simulación.
+ */
+static void WriteHeader(simulation_t * sim);
+
+/**
+ * @brief Actualiza el valor de una señal y lo registra si cambió.
+ *
+ * @param sim    Estado de la simulación.
+ * @param index  Posición de la señal.
+ * @param value  Nuevo valor.
+ */
+static void UpdateSignal(simulation_t * sim, uint8_t index, uint32_t value);
+
+/**
+ * @brief Arma el patrón de segmentos que está presente en los pines de la pantalla.
+ *
+ * @param sim  Estado de la simulación.
+ * @return Patrón con los segmentos en el orden de @ref SEGMENT_A a @ref SEGMENT_P.
+ */
+static uint8_t SegmentPattern(const simulation_t * sim);
+
+/**
+ * @brief Convierte un patrón de segmentos al carácter que representa.
+ *
+ * @param pattern  Patrón de segmentos sin el punto.
+ * @return Dígito decimal, espacio si está apagado o `?` si no corresponde a un dígito.
+ */
+static char PatternChar(uint8_t pattern);
+
+/**
+ * @brief Observador de los puertos: registra los pines y decodifica el multiplexado de la pantalla.
+ *
+ * Cada vez que se enciende un dígito se toma el patrón presente en los segmentos como lo que muestra ese dígito.
+ */
+static void PortChanged(void * object, uint8_t port, uint32_t level);
+
+/**
+ * @brief Aplica los cambios de nivel de las teclas que vencieron y programa el siguiente.
+ *
+ * @param object  Estado de la simulación.
+ */
+static void KeyEdge(void * object);
+
+/**
+ * @brief Termina la simulación: cierra el archivo VCD y escribe el resumen.
+ *
+ * @param object  Estado de la simulación.
+ */
+static void Finish(void * object);
+
+/**
+ * @brief Punto de entrada del programa, que el makefile compila con `main` renombrado.
+ */
+int FirmwareMain(void);
+
+/* === Private variable definitions ================================================================================ */
+
+/** @brief LEDs de la placa */
+static const board_pin_t LEDS[] = {BOARD_OUTPUTS(FIELD_PIN)};
+
+/** @brief Teclas de la placa */
+static const board_pin_t KEYS[] = {BOARD_INPUTS(FIELD_PIN)};
+
+/** @brief Habilitaciones de los dígitos de la pantalla */
+static const board_pin_t DIGITS[] = {BOARD_DIGITS(NAMED_PIN)};
+
+/** @brief Segmentos de la pantalla, en el orden de los bits de los patrones */
+static const board_pin_t SEGMENTS[] = {BOARD_SEGMENTS(NAMED_PIN)};
+
+/** @brief Nombres de las acciones en los guiones, en el orden de @ref key_action_t */
+static const char * const ACTIONS[] = {"presionar", "soltar", "pulsar"};
+
+/** @brief Patrones de los dígitos decimales */
+static const uint8_t NUMBERS[10] = {
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F,             /* 0 */
+    SEGMENT_B | SEGMENT_C,                                                             /* 1 */
+    SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G,                         /* 2 */
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G,                         /* 3 */
+    SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G,                                     /* 4 */
+    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,                         /* 5 */
+    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,             /* 6 */
+    SEGMENT_A | SEGMENT_B | SEGMENT_C,                                                 /* 7 */
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G, /* 8 */
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,             /* 9 */
+};
+
+/* === Private function definitions ================================================================================ */
+
+static bool ParseTime(const char * text, uint64_t * cycles) {
+    static const struct {
+        const char * suffix;
+        double seconds;
+    } UNITS[] = {{"ms", 1e-3}, {"us", 1e-6}, {"h", 3600}, {"m", 60}, {"s", 1}};
+    double seconds = 0;
+
+    if (*text == 0) {
+        return false;
+    }
+    while (*text != 0) {
+        char * end;
+        double value = strtod(text, &end);
+        size_t unit;
+
+        if ((end == text) || (value < 0)) {
+            return false;
+        }
+        for (unit = 0; unit < COUNT(UNITS); unit++) {
+            if (strncmp(end, UNITS[unit].suffix, strlen(UNITS[unit].suffix)) == 0) {
+                break;
+            }
+        }
+        if (unit == COUNT(UNITS)) {
+            return false;
+        }
+        seconds += value * UNITS[unit].seconds;
+        text = end + strlen(UNITS[unit].suffix);
+    }
+    *cycles = (uint64_t)(seconds * SystemCoreClock + 0.5);
+    return true;
+}
+
+static uint64_t CyclesToNs(uint64_t cycles) {
+    /* Se separan los segundos enteros para no desbordar la multiplicación en simulaciones largas */
+    return (cycles / SystemCoreClock) * 1000000000ull + (cycles % SystemCoreClock) * 1000000000ull / SystemCoreClock;
+}
+
+static void PrintTime(FILE * file, uint64_t cycles) {
+    uint64_t ms = CyclesToNs(cycles) / 1000000;
+
+    fprintf(file, "%02lu:%02lu:%02lu.%03lu", (unsigned long)(ms / 3600000), (unsigned long)(ms / 60000 % 60),
+            (unsigned long)(ms / 1000 % 60), (unsigned long)(ms % 1000));
+}
+
+static uint64_t BounceDelay(simulation_t * sim) {
+    uint32_t range = SIMULATE_BOUNCE_MAX_US - SIMULATE_BOUNCE_MIN_US + 1;
+
+    sim->seed ^= sim->seed << 13;
+    sim->seed ^= sim->seed >> 17;
+    sim->seed ^= sim->seed << 5;
+    return (uint64_t)(SIMULATE_BOUNCE_MIN_US + sim->seed % range) * (SystemCoreClock / 1000000);
+}
+
+static void AddEdge(simulation_t * sim, uint64_t cycle, uint8_t key, bool level) {
+    if (sim->edgeCount == sim->edgeCapacity) {
+        sim->edgeCapacity = sim->edgeCapacity ? 2 * sim->edgeCapacity : 64;
+        sim->edges = realloc(sim->edges, sim->edgeCapacity * sizeof(sim->edges[0]));
+        if (sim->edges == NULL) {
+            perror("simulate");
+            exit(1);
+        }
+    }
+    sim->edges[sim->edgeCount].cycle = cycle;
+    sim->edges[sim->edgeCount].order = sim->edgeCount;
+    sim->edges[sim->edgeCount].key = key;
+    sim->edges[sim->edgeCount].level = level;
+    sim->edgeCount++;
+}
+
+static void AddTransition(simulation_t * sim, uint64_t cycle, uint8_t key, bool level, uint32_t bounces) {
+    AddEdge(sim, cycle, key, level);
+    for (uint32_t bounce = 0; bounce < bounces; bounce++) {
+        cycle += BounceDelay(sim);
+        AddEdge(sim, cycle, key, !level);
+        cycle += BounceDelay(sim);
+        AddEdge(sim, cycle, key, level);
+    }
+}
+
+static int CompareEdges(const void * first, const void * second) {
+    const key_edge_t * a = first;
+    const key_edge_t * b = second;
+
+    if (a->cycle != b->cycle) {
+        return (a->cycle < b->cycle) ? -1 : 1;
+    }
+    return (a->order < b->order) ? -1 : (a->order > b->order);
+}
+
+static bool LoadScript(simulation_t * sim, const char * path) {
+    FILE * file = fopen(path, "r");
+    char line[256];
+    unsigned number = 0;
+    bool valid = true;
+
+    if (file == NULL) {
+        perror(path);
+        return false;
+    }
+    while (valid && (fgets(line, sizeof(line), file) != NULL)) {
+        char * comment = strchr(line, '#');
+        char * fields[8];
+        int count = 0;
+        uint64_t start, duration = 0, every = 0;
+        uint32_t bounces = SIMULATE_DEFAULT_BOUNCES, repeat = 1;
+        uint8_t key;
+        int action;
+
+        number++;
+        if (comment != NULL) {
+            *comment = 0;
+        }
+        for (char * token = strtok(line, " \t\r\n"); token != NULL; token = strtok(NULL, " \t\r\n")) {
+            if (count < (int)COUNT(fields)) {
+                fields[count] = token;
+            }
+            count++;
+        }
+        if (count == 0) {
+            continue;
+        }
+
+        valid = (count >= 3) && (count <= (int)COUNT(fields)) && ParseTime(fields[0], &start);
+        for (key = 0; valid && (key < COUNT(KEYS)); key++) {
+            if (strcmp(fields[1], KEYS[key].name) == 0) {
+                break;
+            }
+        }
+        valid = valid && (key < COUNT(KEYS));
+        for (action = 0; valid && (action < (int)COUNT(ACTIONS)); action++) {
+            if (strcmp(fields[2], ACTIONS[action]) == 0) {
+                break;
+            }
+        }
+        valid = valid && (action < (int)COUNT(ACTIONS));
+
+        /* La pulsación lleva su duración como primer argumento; el resto son opciones con nombre */
+        int next = 3;
+        if (valid && (action == ACTION_PULSE)) {
+            valid = (count > 3) && ParseTime(fields[3], &duration);
+            next = 4;
+        }
+        for (; valid && (next < count); next++) {
+            char * value = strchr(fields[next], '=');
+
+            if (value == NULL) {
+                valid = false;
+                break;
+            }
+            *value++ = 0;
+            if (strcmp(fields[next], "rebotes") == 0) {
+                bounces = strtoul(value, NULL, 10);
+            } else if (strcmp(fields[next], "repetir") == 0) {
+                repeat = strtoul(value, NULL, 10);
+            } else if (strcmp(fields[next], "cada") == 0) {
+                valid = ParseTime(value, &every);
+            } else {
+                valid = false;
+            }
+        }
+        if (!valid) {
+            fprintf(stderr, "%s:%u: línea inválida\n", path, number);
+            break;
+        }
+
+        for (uint32_t index = 0; index < repeat; index++) {
+            uint64_t cycle = start + index * every;
+
+            if (action == ACTION_RELEASE) {
+                AddTransition(sim, cycle, key, true, bounces);
+            } else {
+                AddTransition(sim, cycle, key, false, bounces);
+            }
+            if (action == ACTION_PULSE) {
+                AddTransition(sim, cycle + duration, key, true, bounces);
+            }
+            sim->actions[key]++;
+        }
+    }
+    fclose(file);
+
+    if (sim->edgeCount > 0) {
+        qsort(sim->edges, sim->edgeCount, sizeof(sim->edges[0]), CompareEdges);
+    }
+    return valid;
+}
+
+static void CreateSignals(simulation_t * sim) {
+    static const struct {
+        const board_pin_t * pins;
+        uint8_t count;
+        const char * group;
+    } GROUPS[] = {
+        {LEDS, COUNT(LEDS), "leds"},
+        {KEYS, COUNT(KEYS), "teclas"},
+        {DIGITS, COUNT(DIGITS), "multiplexado"},
+        {SEGMENTS, COUNT(SEGMENTS), "multiplexado"},
+    };
+
+    for (uint8_t group = 0; group < COUNT(GROUPS); group++) {
+        for (uint8_t index = 0; index < GROUPS[group].count; index++) {
+            signal_t * signal = &sim->signals[sim->signalCount++];
+
+            snprintf(signal->name, sizeof(signal->name), "%s", GROUPS[group].pins[index].name);
+            signal->group = GROUPS[group].group;
+            signal->width = 1;
+            signal->gpio = GROUPS[group].pins[index].gpio;
+            signal->bit = GROUPS[group].pins[index].bit;
+            sim->watched[signal->gpio] |= 1u << signal->bit;
+        }
+    }
+
+    /* Lo que muestra cada dígito, decodificado del multiplexado */
+    sim->patternBase = sim->signalCount;
+    for (uint8_t digit = 0; digit < COUNT(DIGITS); digit++) {
+        signal_t * signal = &sim->signals[sim->signalCount++];
+
+        snprintf(signal->name, sizeof(signal->name), "digito_%u", digit + 1);
+        signal->group = "pantalla";
+        signal->width = 8;
+        signal->gpio = digit;
+    }
+}
+
+static bool SelectSignals(simulation_t * sim, const char * list) {
+    char names[256];
+
+    snprintf(names, sizeof(names), "%s", list);
+    for (char * name = strtok(names, ","); name != NULL; name = strtok(NULL, ",")) {
+        bool found = false;
+
+        for (uint8_t index = 0; index < sim->signalCount; index++) {
+            if ((strcmp(name, sim->signals[index].name) == 0) || (strcmp(name, sim->signals[index].group) == 0)) {
+                sim->signals[index].enabled = true;
+                found = true;
+            }
+        }
+        if (!found) {
+            fprintf(stderr, "señal desconocida: %s\n", name);
+            return false;
+        }
+    }
+    return true;
+}
+
+static void WriteValue(simulation_t * sim, uint8_t index) {
+    const signal_t * signal = &sim->signals[index];
+
+    if (signal->width == 1) {
+        fprintf(sim->vcd, "%u%c\n", signal->value, '!' + index);
+    } else {
+        fputc('b', sim->vcd);
+        for (int bit = signal->width - 1; bit >= 0; bit--) {
+            fputc((signal->value & (1u << bit)) ? '1' : '0', sim->vcd);
+        }
+        fprintf(sim->vcd, " %c\n", '!' + index);
+    }
+}
+
+static void WriteHeader(simulation_t * sim) {
+    const char * group = NULL;
+
+    fprintf(sim->vcd, "$version reloj simulate $end\n$timescale 1ns $end\n$scope module reloj $end\n");
+    for (uint8_t index = 0; index < sim->signalCount; index++) {
+        const signal_t * signal = &sim->signals[index];
+
+        if (!signal->enabled) {
+            continue;
+        }
+        if ((group == NULL) || (strcmp(group, signal->group) != 0)) {
+            if (group != NULL) {
+                fprintf(sim->vcd, "$upscope $end\n");
+            }
+            group = signal->group;
+            fprintf(sim->vcd, "$scope module %s $end\n", group);
+        }
+        fprintf(sim->vcd, "$var wire %u %c %s $end\n", signal->width, '!' + index, signal->name);
+    }
+    if (group != NULL) {
+        fprintf(sim->vcd, "$upscope $end\n");
+    }
+    fprintf(sim->vcd, "$upscope $end\n$enddefinitions $end\n#0\n$dumpvars\n");
+    for (uint8_t index = 0; index < sim->signalCount; index++) {
+        if (sim->signals[index].enabled) {
+            WriteValue(sim, index);
+        }
+    }
+    fprintf(sim->vcd, "$end\n");
+    sim->vcdTime = 0;
+}
+
+static void UpdateSignal(simulation_t * sim, uint8_t index, uint32_t value) {
+    signal_t * signal = &sim->signals[index];
+
+    if (signal->value == value) {
+        return;
+    }
+    signal->value = value;
+    signal->changes++;
+    if (sim->recording && signal->enabled) {
+        uint64_t now = CyclesToNs(SimGetCycles());
+
+        if (now != sim->vcdTime) {
+            fprintf(sim->vcd, "#%lu\n", (unsigned long)now);
+            sim->vcdTime = now;
+        }
+        WriteValue(sim, index);
+    }
+}
+
+static uint8_t SegmentPattern(const simulation_t * sim) {
+    uint8_t result = 0;
+
+    for (uint8_t index = 0; index < COUNT(SEGMENTS); index++) {
+        if (sim->ports[SEGMENTS[index].gpio] & (1u << SEGMENTS[index].bit)) {
+            result |= 1u << index;
+        }
+    }
+    return result;
+}
+
+static char PatternChar(uint8_t pattern) {
+    if (pattern == 0) {
+        return ' ';
+    }
+    for (uint8_t number = 0; number < COUNT(NUMBERS); number++) {
+        if (NUMBERS[number] == pattern) {
+            return '0' + number;
+        }
+    }
+    return '?';
+}
+
+static void PortChanged(void * object, uint8_t port, uint32_t level) {
+    simulation_t * sim = object;
+    uint32_t changed = (level ^ sim->ports[port]) & sim->watched[port];
+    uint32_t rise = level & ~sim->ports[port];
+
+    sim->ports[port] = level;
+    for (uint8_t index = 0; (changed != 0) && (index < sim->patternBase); index++) {
+        if (sim->signals[index].gpio == port) {
+            UpdateSignal(sim, index, (level >> sim->signals[index].bit) & 1);
+        }
+    }
+    for (uint8_t digit = 0; digit < COUNT(DIGITS); digit++) {
+        if ((DIGITS[digit].gpio == port) && (rise & (1u << DIGITS[digit].bit))) {
+            UpdateSignal(sim, sim->patternBase + digit, SegmentPattern(sim));
+        }
+    }
+}
+
+static void KeyEdge(void * object) {
+    simulation_t * sim = object;
+
+    while ((sim->edgeNext < sim->edgeCount) && (sim->edges[sim->edgeNext].cycle <= SimGetCycles())) {
+        const key_edge_t * edge = &sim->edges[sim->edgeNext++];
+        SimGpioSetInput(KEYS[edge->key].gpio, KEYS[edge->key].bit, edge->level);
+    }
+    if (sim->edgeNext < sim->edgeCount) {
+        SimScheduleCallback(sim->edges[sim->edgeNext].cycle, KeyEdge, sim);
+    }
+}
+
+static void Finish(void * object) {
+    simulation_t * sim = object;
+    sim_chip_stats_t stats;
+    struct timespec end;
+    double elapsed;
+
+    if (sim->vcd != NULL) {
+        fprintf(sim->vcd, "#%lu\n", (unsigned long)CyclesToNs(SimGetCycles()));
+        fclose(sim->vcd);
+    }
+    fflush(stdout);
+
+    printf("simulado: ");
+    PrintTime(stdout, SimGetCycles());
+    printf(" (%lu ciclos)\npantalla: \"", (unsigned long)SimGetCycles());
+    for (uint8_t digit = 0; digit < COUNT(DIGITS); digit++) {
+        uint8_t pattern = sim->signals[sim->patternBase + digit].value;
+
+        putchar(PatternChar(pattern & ~SEGMENT_P));
+        if (pattern & SEGMENT_P) {
+            putchar('.');
+        }
+    }
+    printf("\"\n");
+    for (uint8_t key = 0; key < COUNT(KEYS); key++) {
+        printf("%-12s %8u acciones %10lu flancos\n", KEYS[key].name, sim->actions[key],
+               (unsigned long)sim->signals[COUNT(LEDS) + key].changes);
+    }
+    for (uint8_t led = 0; led < COUNT(LEDS); led++) {
+        printf("%-12s %10lu flancos  nivel final %u\n", LEDS[led].name, (unsigned long)sim->signals[led].changes,
+               sim->signals[led].value);
+    }
+    SimGetStats(&stats);
+    printf("registros: %lu lecturas, %lu escrituras\n", (unsigned long)stats.reads, (unsigned long)stats.writes);
+    printf("reposo: %.2f %% del tiempo\n", 100.0 * SimGetSleepCycles() / SimGetCycles());
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    elapsed = (end.tv_sec - sim->start.tv_sec) + (end.tv_nsec - sim->start.tv_nsec) / 1e9;
+    fprintf(stderr, "tiempo real: %.2f s, %.0f veces más rápido que la placa\n", elapsed,
+            (double)SimGetCycles() / SystemCoreClock / elapsed);
+    fflush(stdout);
+    exit(0);
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(int argc, char * argv[]) {
+    static simulation_t sim;
+    const char * duration = SIMULATE_DEFAULT_DURATION;
+    const char * signals = SIMULATE_DEFAULT_SIGNALS;
+    const char * script = NULL;
+    const char * waveform = NULL;
+    int option;
+
+    sim.seed = 1;
+    while ((option = getopt(argc, argv, "t:k:w:g:s:")) != -1) {
+        switch (option) {
+        case 't':
+            duration = optarg;
+            break;
+        case 'k':
+            script = optarg;
+            break;
+        case 'w':
+            waveform = optarg;
+            break;
+        case 'g':
+            signals = optarg;
+            break;
+        case 's':
+            sim.seed = strtoul(optarg, NULL, 0);
+            break;
+        default:
+            fprintf(stderr, "uso: %s [-t duración] [-k guion] [-w archivo.vcd] [-g señales] [-s semilla]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    CreateSignals(&sim);
+    if (!ParseTime(duration, &sim.duration)) {
+        fprintf(stderr, "duración inválida: %s\n", duration);
+        return 2;
+    }
+    if ((sim.seed == 0) || !SelectSignals(&sim, signals) || ((script != NULL) && !LoadScript(&sim, script))) {
+        return 2;
+    }
+    if ((waveform != NULL) && ((sim.vcd = fopen(waveform, "w")) == NULL)) {
+        perror(waveform);
+        return 1;
+    }
+
+    /* Las teclas sueltas dejan las entradas en nivel alto por las resistencias de polarización */
+    SimSetPortObserver(PortChanged, &sim);
+    for (uint8_t key = 0; key < COUNT(KEYS); key++) {
+        SimGpioSetInput(KEYS[key].gpio, KEYS[key].bit, true);
+    }
+    if (sim.vcd != NULL) {
+        WriteHeader(&sim);
+        sim.recording = true;
+    }
+
+    if (sim.edgeCount > 0) {
+        SimScheduleCallback(sim.edges[0].cycle, KeyEdge, &sim);
+    }
+    SimScheduleCallback(sim.duration, Finish, &sim);
+    clock_gettime(CLOCK_MONOTONIC, &sim.start);
+    return FirmwareMain();
+}
+
+/* === End of documentation ======================================================================================== */
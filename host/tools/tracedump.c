@@ -0,0 +1,132 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file tracedump.c
+ ** @brief Decodificador de las trazas binarias que el programa envía por el UART
+ **
+ ** Lee el flujo de tramas de un archivo, o de la entrada estándar si no se indica ninguno, y escribe una línea por
+ ** evento con el instante desde el primer evento, la diferencia respecto del anterior, el nombre y el argumento. La
+ ** frecuencia del núcleo se toma del evento de inicio; hasta recibirlo se supone la de la EDU-CIAA.
+ **
+ ** Uso: `tracedump [archivo]`
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "trace.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief Frecuencia del núcleo en MHz que se supone hasta recibir el evento de inicio */
+#define TRACEDUMP_DEFAULT_MHZ 204
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Escribe la línea de un evento decodificado.
+ *
+ * @param time   Ciclos desde el primer evento.
+ * @param mhz    Frecuencia del núcleo en MHz.
+ * @param delta  Ciclos desde el evento anterior.
+ * @param event  Tipo de evento.
+ * @param arg    Argumento del evento.
+ */
+static void PrintEvent(int64_t time, uint32_t mhz, int32_t delta, trace_event_t event, uint16_t arg);
+
+/* === Private function definitions ================================================================================ */
+
+static void PrintEvent(int64_t time, uint32_t mhz, int32_t delta, trace_event_t event, uint16_t arg) {
+    printf("%14.3f us %+10ld  %-14s", (double)time / mhz, (long)delta, TraceEventName(event));
+    if ((TraceEventFormat(event) == TRACE_ARG_PIN) && ((arg >> 8) == TRACE_EXPANDER_GPIO)) {
+        printf(" EXP[%u]\n", arg & 0xFF);
+    } else if (TraceEventFormat(event) == TRACE_ARG_PIN) {
+        printf(" GPIO%u[%u]\n", arg >> 8, arg & 0xFF);
+    } else {
+        printf(" %u\n", arg);
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(int argc, char * argv[]) {
+    FILE * input = stdin;
+    uint8_t frame[TRACE_FRAME_SIZE];
+    uint8_t length = 0;
+    bool overflow = false;
+    bool started = false;
+    uint32_t mhz = TRACEDUMP_DEFAULT_MHZ;
+    int64_t time = 0;
+    unsigned long invalid = 0;
+    int byte;
+
+    if (argc > 2) {
+        fprintf(stderr, "uso: %s [archivo]\n", argv[0]);
+        return 2;
+    }
+    if ((argc == 2) && ((input = fopen(argv[1], "rb")) == NULL)) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    while ((byte = fgetc(input)) != EOF) {
+        trace_event_t event;
+        uint16_t arg;
+        int32_t delta;
+
+        if (byte != 0) {
+            /* Una trama más larga que la máxima solo puede venir de bytes perdidos: se descarta hasta el próximo cero */
+            if (length < sizeof(frame)) {
+                frame[length++] = byte;
+            } else {
+                overflow = true;
+            }
+            continue;
+        }
+
+        if (overflow || !TraceDecode(frame, length, &event, &arg, &delta)) {
+            invalid += (length > 0) || overflow;
+        } else {
+            /* El primer evento define el origen de tiempo */
+            if (started) {
+                time += delta;
+            }
+            started = true;
+            if ((event == TRACE_START) && (arg != 0)) {
+                mhz = arg;
+            }
+            PrintEvent(time, mhz, delta, event, arg);
+        }
+        length = 0;
+        overflow = false;
+    }
+
+    if (invalid != 0) {
+        fprintf(stderr, "%lu tramas inválidas descartadas\n", invalid);
+    }
+    if (input != stdin) {
+        fclose(input);
+    }
+    return 0;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -28,6 +28,7 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions ==================================================================================== */
 
 #include "digital.h"
+#include "display.h"
 #include <stdbool.h>
 #include <stdint.h>
 #include "edu-ciaa.h"
@@ -40,23 +41,28 @@ extern "C" {
 
 /* === Public macros definitions =================================================================================== */
 
+/** @brief Declara el campo de la estructura de la placa asociado a una salida de la tabla BOARD_OUTPUTS */
+#define BOARD_OUTPUT_FIELD(name, field, port, pin, func, gpio, bit) digital_output_t field;
+
+/** @brief Declara el campo de la estructura de la placa asociado a una tecla de la tabla BOARD_INPUTS */
+#define BOARD_INPUT_FIELD(name, field, port, pin, func, gpio, bit) digital_input_t field;
+
 /* === Public data type declarations =============================================================================== */
 
 /**
  * @brief Puntero constante a una estructura que representa las entradas y salidas digitales de la placa.
  *
- * La estructura agrupa salidas digitales (LEDs) y entradas digitales (teclas).
+ * La estructura agrupa salidas digitales (LEDs), entradas digitales (teclas) y la pantalla de siete segmentos. Los
+ * campos de los LEDs y de las teclas se generan a partir de las tablas BOARD_OUTPUTS y BOARD_INPUTS de edu-ciaa.h, con
+ * los nombres `led_red`, `led_green`, `led_blue`, `led_yellow` y `tec_1` a `tec_4`. Las teclas pertenecen al banco
+ * `keys`, que debe explorarse con DigitalInputBankScan() una vez por ciclo antes de consultarlas.
  *
  */
 typedef struct board_s {
-    digital_output_t led_red;    /**< LED color rojo */
-    digital_output_t led_green;  /**< LED color verde */
-    digital_output_t led_blue;   /**< LED color azul */
-    digital_output_t led_yellow; /**< LED color amarillo */
-    digital_input_t tec_1;       /**< Tecla 1 */
-    digital_input_t tec_2;       /**< Tecla 2 */
-    digital_input_t tec_3;       /**< Tecla 3 */
-    digital_input_t tec_4;       /**< Tecla 4 */
+    BOARD_OUTPUTS(BOARD_OUTPUT_FIELD)
+    BOARD_INPUTS(BOARD_INPUT_FIELD)
+    digital_input_bank_t keys; /**< Banco que captura todas las teclas en una sola lectura por puerto */
+    display_t display;         /**< Pantalla de cuatro dígitos de siete segmentos */
 } const * board_t;
 
 /* === Public variable declarations ================================================================================ */
@@ -66,9 +72,11 @@ typedef struct board_s {
 /**
  * @brief Crea una estructura con los periféricos de la placa.
  *
- * Inicializa los LEDs y teclas, y devuelve un puntero a la estructura que los contiene.
+ * Inicializa los LEDs y teclas, y devuelve un puntero a la estructura que los contiene. La estructura se reserva en
+ * forma estática, por lo que las llamadas posteriores devuelven la misma instancia sin volver a configurar los pines.
  *
- * @return Puntero a la estructura de la placa.
+ * @return Puntero a la estructura de la placa, o `NULL` si alguna de las reservas estáticas no alcanzó para crear sus
+ * salidas, sus teclas o su pantalla.
  */
 board_t BoardCreate(void);
 
@@ -0,0 +1,67 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef CHIPREG_H_
+#define CHIPREG_H_
+
+/** @file chipreg.h
+ ** @brief Acceso a registros a través de punteros precalculados.
+ **
+ ** Incluye el chip.h del backend y completa las macros CHIP_REG_WRITE y CHIP_REG_READ cuando este no las define. En
+ ** el microcontrolador son un acceso directo al registro; el backend simulado las define para aplicar la semántica
+ ** del periférico y contar los accesos.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "chip.h"
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#ifndef CHIP_REG_WRITE
+/** @brief Escribe un registro a través de un puntero precalculado */
+#define CHIP_REG_WRITE(reg, value) (*(reg) = (value))
+#endif
+
+#ifndef CHIP_REG_READ
+/** @brief Lee un registro a través de un puntero precalculado */
+#define CHIP_REG_READ(reg) (*(reg))
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/* === End of conditional blocks ==================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHIPREG_H_ */
@@ -0,0 +1,172 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef CLOCK_H_
+#define CLOCK_H_
+
+/** @file clock.h
+ ** @brief Módulo de reloj con hora y alarma en BCD empaquetado.
+ **
+ ** La hora se guarda como seis dígitos BCD en una única palabra, con el formato `0x00HHMMSS`. Cada tick incrementa un
+ ** contador y, al completar un segundo, se avanza la hora con una cadena de acarreo incremental: en el caso común solo
+ ** cambia el dígito de las unidades de segundos. Las rutinas de visualización pueden tomar cada dígito con un
+ ** desplazamiento y una máscara, sin divisiones ni restos.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Hora en BCD empaquetado.
+ *
+ * Los campos individuales suponen un procesador little-endian, como el Cortex-M4 y los equipos de escritorio.
+ */
+typedef union clock_time_u {
+    uint32_t bcd; /**< Hora completa con el formato `0x00HHMMSS`. */
+    struct {
+        uint8_t seconds; /**< Segundos en BCD, de `0x00` a `0x59`. */
+        uint8_t minutes; /**< Minutos en BCD, de `0x00` a `0x59`. */
+        uint8_t hours;   /**< Horas en BCD, de `0x00` a `0x23`. */
+        uint8_t unused;  /**< Siempre en cero. */
+    } time;
+} clock_time_t;
+
+/**
+ * @brief Puntero a una instancia de un reloj
+ */
+typedef struct clock_s * clk_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea un reloj.
+ *
+ * El reloj se crea con una hora no válida y la alarma deshabilitada.
+ *
+ * @param ticks  Cantidad de llamadas a ClockTick() que equivalen a un segundo.
+ * @return clk_t  Puntero a la instancia del reloj creado, o `NULL` si `ticks` es cero o se agotó la reserva de
+ *                `CLOCK_POOL_SIZE` instancias.
+ */
+clk_t ClockCreate(uint16_t ticks);
+
+/**
+ * @brief Obtiene la hora actual del reloj.
+ *
+ * @param clock  Puntero a la instancia del reloj, obtenida mediante ClockCreate().
+ * @param time   Estructura donde se copia la hora.
+ * @return `true` si la hora es válida; `false` si todavía no se configuró.
+ */
+bool ClockGetTime(clk_t clock, clock_time_t * time);
+
+/**
+ * @brief Configura la hora actual del reloj.
+ *
+ * También reinicia la fracción de segundo en curso.
+ *
+ * @param clock  Puntero a la instancia del reloj, obtenida mediante ClockCreate().
+ * @param time   Hora a configurar.
+ * @return `true` si la hora es un valor BCD válido; `false` en caso contrario.
+ */
+bool ClockSetTime(clk_t clock, const clock_time_t * time);
+
+/**
+ * @brief Informa al reloj que transcurrió un tick.
+ *
+ * Debe llamarse con un período constante, por ejemplo desde una tarea del planificador. Al completar un segundo avanza
+ * la hora y compara el resultado con la alarma, ambos en tiempo constante. La alarma no suena mientras la hora no se
+ * haya configurado con ClockSetTime().
+ *
+ * @param clock  Puntero a la instancia del reloj, obtenida mediante ClockCreate().
+ */
+void ClockTick(clk_t clock);
+
+/**
+ * @brief Configura la hora de la alarma y la habilita.
+ *
+ * @param clock  Puntero a la instancia del reloj, obtenida mediante ClockCreate().
+ * @param alarm  Hora de la alarma.
+ * @return `true` si la hora es un valor BCD válido; `false` en caso contrario.
+ */
+bool ClockSetAlarm(clk_t clock, const clock_time_t * alarm);
+
+/**
+ * @brief Obtiene la hora de la alarma.
+ *
+ * @param clock  Puntero a la instancia del reloj, obtenida mediante ClockCreate().
+ * @param alarm  Estructura donde se copia la hora de la alarma.
+ * @return `true` si la alarma está habilitada; `false` en caso contrario.
+ */
+bool ClockGetAlarm(clk_t clock, clock_time_t * alarm);
+
+/**
+ * @brief Habilita o deshabilita la alarma.
+ *
+ * Deshabilitar la alarma también la silencia y descarta una posposición en curso.
+ *
+ * @param clock    Puntero a la instancia del reloj, obtenida mediante ClockCreate().
+ * @param enabled  `true` para habilitar la alarma; `false` para deshabilitarla.
+ */
+void ClockEnableAlarm(clk_t clock, bool enabled);
+
+/**
+ * @brief Indica si la alarma está sonando.
+ *
+ * @param clock  Puntero a la instancia del reloj, obtenida mediante ClockCreate().
+ * @return `true` si la alarma está sonando; `false` en caso contrario.
+ */
+bool ClockIsAlarmRinging(clk_t clock);
+
+/**
+ * @brief Silencia la alarma y la vuelve a activar algunos minutos más tarde.
+ *
+ * @param clock    Puntero a la instancia del reloj, obtenida mediante ClockCreate().
+ * @param minutes  Minutos de posposición, entre 1 y 59.
+ * @return `true` si la alarma estaba sonando y se pospuso; `false` en caso contrario.
+ */
+bool ClockSnooze(clk_t clock, uint8_t minutes);
+
+/**
+ * @brief Silencia la alarma hasta su próxima ocurrencia, al día siguiente.
+ *
+ * @param clock  Puntero a la instancia del reloj, obtenida mediante ClockCreate().
+ */
+void ClockStopAlarm(clk_t clock);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CLOCK_H_ */
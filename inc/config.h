@@ -33,6 +33,148 @@ extern "C" {
 
 /* === Public macros definitions =================================================================================== */
 
+/*
+ * Tamaño de las reservas estáticas de instancias. Las funciones de creación devuelven `NULL` cuando la reserva
+ * correspondiente está agotada. Al enlazar en Linux (`make BOARD=host`) se informa la RAM que ocupa cada reserva.
+ */
+
+/** @brief Cantidad máxima de salidas digitales que se pueden crear. Las 16 de la placa dejan 8 libres, que alcanzan
+ * para el latch y siete salidas de un expansor: cada registro de la cadena que se use completo suma 8 salidas */
+#define DIGITAL_OUTPUT_POOL_SIZE 24
+
+/** @brief Cantidad máxima de entradas digitales que se pueden crear */
+#define DIGITAL_INPUT_POOL_SIZE 8
+
+/** @brief Cantidad máxima de grupos de salidas digitales que se pueden crear */
+#define DIGITAL_GROUP_POOL_SIZE 3
+
+/** @brief Cantidad máxima de bancos de entradas digitales que se pueden crear */
+#define DIGITAL_BANK_POOL_SIZE 2
+
+/** @brief Cantidad máxima de salidas que puede contener un grupo de salidas digitales */
+#define DIGITAL_GROUP_MAX_OUTPUTS 32
+
+/** @brief Cantidad máxima de puertos GPIO distintos que puede abarcar un grupo de salidas digitales */
+#define DIGITAL_GROUP_MAX_PORTS 4
+
+/** @brief Cantidad máxima de puertos GPIO distintos que puede abarcar un banco de entradas digitales */
+#define DIGITAL_BANK_MAX_PORTS 4
+
+/** @brief Bits de los contadores verticales del filtro antirrebote, que limitan las muestras estables configurables */
+#define DIGITAL_DEBOUNCE_BITS 4
+
+/** @brief Capacidad de la cola de eventos de las entradas asociadas a interrupciones, que debe ser potencia de dos */
+#define DIGITAL_EVENT_QUEUE_SIZE 16
+
+/** @brief Exploraciones consecutivas estables que necesitan las teclas de la placa para aceptar un cambio, que con la
+ * exploración cada 5 ms equivalen a 20 ms sin rebotes */
+#define BOARD_KEYS_DEBOUNCE_SAMPLES 4
+
+/** @brief Frecuencia de los ticks del planificador en Hz */
+#define SCHEDULER_TICK_HZ 1000
+
+/** @brief Cantidad máxima de tareas que se pueden crear en el planificador */
+#define SCHEDULER_TASK_POOL_SIZE 8
+
+/** @brief Cantidad máxima de relojes que se pueden crear */
+#define CLOCK_POOL_SIZE 1
+
+/** @brief Cantidad máxima de pantallas multiplexadas que se pueden crear */
+#define DISPLAY_POOL_SIZE 1
+
+/** @brief Cantidad máxima de dígitos de una pantalla, que no puede superar 8 por las máscaras de parpadeo */
+#define DISPLAY_MAX_DIGITS 8
+
+/** @brief Dígitos de la pantalla que se encienden por segundo, que con cuatro dígitos dan 250 barridos por segundo */
+#define DISPLAY_REFRESH_HZ 1000
+
+/** @brief Barridos de la pantalla que dura cada mitad del parpadeo, medio segundo con la frecuencia de refresco */
+#define DISPLAY_BLINK_PERIOD 125
+
+/** @brief Cantidad máxima de teclados matriciales que se pueden crear */
+#define KEYPAD_POOL_SIZE 1
+
+/** @brief Cantidad máxima de filas de un teclado matricial, que no puede superar 8 por la palabra de estado */
+#define KEYPAD_MAX_ROWS 8
+
+/** @brief Cantidad máxima de columnas de un teclado matricial, que no puede superar 8 por la palabra de estado */
+#define KEYPAD_MAX_COLUMNS 8
+
+/** @brief Cantidad máxima de expansores de salidas con registros de desplazamiento que se pueden crear */
+#define EXPANDER_POOL_SIZE 1
+
+/** @brief Cantidad máxima de registros 74HC595 encadenados en un expansor, que fija el tamaño de su copia en RAM */
+#define EXPANDER_MAX_CHIPS 8
+
+/** @brief Velocidad en bits por segundo del SSP de los expansores, que con 8 registros da 8 us por refresco */
+#define EXPANDER_BITRATE 10000000
+
+/** @brief Cantidad máxima de almacenamientos de ajustes en la EEPROM que se pueden crear */
+#define SETTINGS_POOL_SIZE 1
+
+/** @brief Llamadas a SettingsService() sin cambios que esperan los datos antes de grabarse, que con el servicio cada
+ * 100 ms equivalen a 2 s */
+#define SETTINGS_WRITE_DELAY 20
+
+/** @brief Cantidad máxima de temporizadores de software que se pueden crear */
+#define SOFT_TIMER_POOL_SIZE 8
+
+/** @brief Cantidad máxima de conjuntos de canales de modulación por ancho de pulso que se pueden crear */
+#define PWM_POOL_SIZE 1
+
+/** @brief Cantidad máxima de canales de un conjunto de modulación por ancho de pulso, como máximo 32 */
+#define PWM_MAX_CHANNELS 8
+
+/** @brief Pasos de la modulación por período, como máximo 32768 */
+#define PWM_STEPS 1024
+
+/** @brief Períodos de modulación por segundo, suficientes para que no se perciba parpadeo */
+#define PWM_FREQUENCY_HZ 200
+
+#ifndef PROFILE_ENABLED
+/** @brief Habilita las sondas de medición de tiempos. Una compilación de producción puede definirlo en cero con
+ * `-DPROFILE_ENABLED=0` para que las macros de medición desaparezcan */
+#define PROFILE_ENABLED 1
+#endif
+
+/** @brief Cantidad máxima de sondas de medición de tiempos que se pueden crear */
+#define PROFILE_POOL_SIZE 8
+
+/** @brief Intervalos en potencias de dos del histograma de cada sonda, que con 16 distinguen hasta 16384 ciclos */
+#define PROFILE_HISTOGRAM_BUCKETS 16
+
+/** @brief Cantidad máxima de etapas del arranque que se pueden marcar con PROFILE_BOOT() */
+#define PROFILE_BOOT_PHASES 8
+
+#ifndef TRACE_ENABLED
+/** @brief Habilita el registro de eventos en el buffer de trazas. Una compilación puede definirlo en cero con
+ * `-DTRACE_ENABLED=0` para que las macros de traza desaparezcan */
+#define TRACE_ENABLED 1
+#endif
+
+/** @brief Capacidad en registros del buffer circular de trazas, que debe ser potencia de dos */
+#define TRACE_BUFFER_SIZE 256
+
+/** @brief Velocidad en baudios del UART por el que se vacía el buffer de trazas */
+#define TRACE_BAUDRATE 460800
+
+/** @brief Velocidad en baudios del UART de la consola */
+#define CONSOLE_BAUDRATE 115200
+
+/** @brief Capacidad en bytes del buffer circular que llena el DMA con lo recibido por la consola, potencia de dos. Una
+ * línea puede ocupar hasta la mitad, y la otra mitad es el margen para lo que llega entre dos atenciones */
+#define CONSOLE_RX_SIZE 256
+
+/** @brief Capacidad en bytes de la cola de transmisión de la consola, potencia de dos, que tiene que alcanzar para la
+ * respuesta más larga, el informe de las sondas de medición */
+#define CONSOLE_TX_SIZE 2048
+
+/** @brief Cantidad máxima de palabras de una línea de la consola, incluido el nombre del comando */
+#define CONSOLE_MAX_ARGS 4
+
+/** @brief Tamaño del buffer en el que ConsolePrintf() arma el texto antes de agregarlo a la cola */
+#define CONSOLE_PRINT_SIZE 96
+
 /* === End of conditional blocks =================================================================================== */
 
 #ifdef __cplusplus
@@ -0,0 +1,194 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef CONSOLE_H_
+#define CONSOLE_H_
+
+/** @file console.h
+ ** @brief Consola de comandos de texto por el UART del adaptador USB de depuración.
+ **
+ ** Un canal de DMA copia cada byte recibido en un buffer circular con una lista enlazada de un único elemento que se
+ ** apunta a sí mismo, así la recepción no pide ninguna interrupción. ConsoleService(), que la aplicación llama desde
+ ** una tarea periódica, averigua hasta dónde escribió el DMA leyendo la dirección de destino del canal y separa las
+ ** líneas y sus palabras sobre el mismo buffer, sin copiarlas, aunque den la vuelta al final.
+ **
+ ** Las respuestas se copian en una cola circular y otro canal de DMA transmite en cada transferencia el tramo contiguo
+ ** más largo que esté pendiente. Escribir nunca espera: lo que no entra en la cola se descarta y se cuenta. El fin de
+ ** cada transferencia lo atiende la interrupción compartida del DMA, que libera el canal, y la siguiente comienza en la
+ ** próxima escritura o atención de la consola.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Puntero a la instancia de la consola
+ */
+typedef struct console_s * console_t;
+
+/**
+ * @brief Línea recibida, dividida en palabras que siguen guardadas en el buffer de recepción.
+ *
+ * Solo se accede a las palabras con ConsoleArgCount(), ConsoleArgLength(), ConsoleArgChar() y ConsoleArgIs(), y la
+ * línea deja de ser válida cuando termina la función del comando.
+ */
+typedef struct console_line_s console_line_t;
+
+/**
+ * @brief Función que ejecuta un comando.
+ *
+ * @param console  Consola que recibió el comando, para escribir la respuesta.
+ * @param line     Línea recibida; la palabra cero es el nombre del comando.
+ * @param object   Objeto indicado al crear la consola.
+ */
+typedef void (*console_handler_t)(console_t console, const console_line_t * line, void * object);
+
+/**
+ * @brief Comando de la consola.
+ */
+typedef struct console_command_s {
+    const char * name;         /**< Palabra que invoca el comando. */
+    const char * help;         /**< Descripción que muestra el comando `ayuda`. */
+    console_handler_t handler; /**< Función que ejecuta el comando. */
+} console_command_t;
+
+/**
+ * @brief Contadores de la consola.
+ */
+typedef struct console_stats_s {
+    uint32_t lines;     /**< Líneas recibidas y ejecutadas, reconocidas o no. */
+    uint32_t discarded; /**< Líneas descartadas por superar el largo máximo. */
+    uint32_t dropped;   /**< Bytes de respuesta descartados porque la cola de transmisión estaba llena. */
+    uint32_t transfers; /**< Transferencias de DMA iniciadas para transmitir. */
+} console_stats_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea la consola, configura su UART y comienza la recepción por DMA.
+ *
+ * La tabla de comandos no se copia y tiene que existir mientras exista la consola. El comando `ayuda`, que lista los
+ * comandos de la tabla con sus descripciones, siempre está disponible.
+ *
+ * @param commands  Tabla de comandos.
+ * @param count     Cantidad de comandos de la tabla.
+ * @param object    Puntero que se entrega a las funciones de los comandos.
+ * @return console_t  Puntero a la consola, o `NULL` si ya se creó o no hay un canal de DMA libre para la recepción.
+ */
+console_t ConsoleCreate(const console_command_t commands[], uint8_t count, void * object);
+
+/**
+ * @brief Atiende la consola: ejecuta las líneas completas recibidas y continúa la transmisión pendiente.
+ *
+ * Tiene que llamarse antes de que el DMA complete una vuelta del buffer de recepción sobre la línea en curso. Con
+ * `CONSOLE_RX_SIZE` en 256 bytes a 115200 baudios, una vez cada 10 ms deja margen de sobra.
+ *
+ * @param self  Puntero a la consola.
+ */
+void ConsoleService(console_t self);
+
+/**
+ * @brief Agrega un texto a la cola de transmisión y comienza a transmitirlo si el DMA está libre.
+ *
+ * Cada salto de línea se transmite como retorno de carro y salto de línea. Vuelve sin esperar que termine la
+ * transmisión.
+ *
+ * @param self  Puntero a la consola.
+ * @param text  Texto terminado en cero.
+ * @return `true` si el texto entró completo en la cola; `false` si se descartó una parte.
+ */
+bool ConsoleWrite(console_t self, const char * text);
+
+/**
+ * @brief Agrega un texto con formato a la cola de transmisión, como ConsoleWrite().
+ *
+ * @param self    Puntero a la consola.
+ * @param format  Formato de `printf`, que no puede generar más de `CONSOLE_PRINT_SIZE` - 1 caracteres.
+ * @return `true` si el texto entró completo en la cola; `false` si se descartó una parte.
+ */
+bool ConsolePrintf(console_t self, const char * format, ...) __attribute__((format(printf, 2, 3)));
+
+/**
+ * @brief Obtiene los contadores de la consola.
+ *
+ * @param self   Puntero a la consola.
+ * @param stats  Estructura donde se copian los contadores.
+ */
+void ConsoleGetStats(console_t self, console_stats_t * stats);
+
+/**
+ * @brief Devuelve la cantidad de palabras de una línea, incluido el nombre del comando.
+ *
+ * @param line  Línea recibida.
+ * @return Cantidad de palabras.
+ */
+uint8_t ConsoleArgCount(const console_line_t * line);
+
+/**
+ * @brief Devuelve el largo de una palabra de una línea.
+ *
+ * @param line   Línea recibida.
+ * @param index  Número de palabra, empezando por el nombre del comando.
+ * @return Cantidad de caracteres, o cero si la palabra no existe.
+ */
+uint8_t ConsoleArgLength(const console_line_t * line, uint8_t index);
+
+/**
+ * @brief Devuelve un carácter de una palabra de una línea.
+ *
+ * @param line    Línea recibida.
+ * @param index   Número de palabra, empezando por el nombre del comando.
+ * @param offset  Posición del carácter dentro de la palabra.
+ * @return Carácter, o `'\0'` si la palabra o la posición no existen.
+ */
+char ConsoleArgChar(const console_line_t * line, uint8_t index, uint8_t offset);
+
+/**
+ * @brief Compara una palabra de una línea con un texto.
+ *
+ * @param line   Línea recibida.
+ * @param index  Número de palabra, empezando por el nombre del comando.
+ * @param text   Texto terminado en cero.
+ * @return `true` si la palabra existe y es igual al texto.
+ */
+bool ConsoleArgIs(const console_line_t * line, uint8_t index, const char * text);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CONSOLE_H_ */
@@ -27,6 +27,7 @@ SPDX-License-Identifier: MIT
 
 /* === Headers files inclusions ==================================================================================== */
 
+#include "chipreg.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -40,6 +41,9 @@ extern "C" {
 
 /* === Public data type declarations =============================================================================== */
 
+/** @brief Expansor de salidas, declarado en expander.h; aquí solo hace falta su puntero */
+struct expander_s;
+
 /**
  * @brief Estados de cambio de una entrada digital.
  *
@@ -57,11 +61,74 @@ typedef enum digital_states_e {
  */
 typedef struct digital_output_s * digital_output_t;
 
+/**
+ * @brief Puntero a una instancia de un grupo de salidas digitales
+ */
+typedef struct digital_output_group_s * digital_output_group_t;
+
 /**
  * @brief Puntero a una instancia de una entrada digital
  */
 typedef struct digital_input_s * digital_input_t;
 
+/**
+ * @brief Puntero a una instancia de un banco de entradas digitales
+ */
+typedef struct digital_input_bank_s * digital_input_bank_t;
+
+/**
+ * @brief Acceso directo a un pin GPIO, precalculado al crear la salida o la entrada digital.
+ *
+ * Guarda las direcciones de los registros del puerto y la máscara del bit, de modo que las funciones en línea
+ * DigitalPinActivate(), DigitalPinDeactivate(), DigitalPinToggle() y DigitalPinGetIsActive() se reducen a una única
+ * escritura o lectura sin recalcular la dirección del registro ni el desplazamiento del bit.
+ */
+typedef struct digital_pin_s {
+    volatile uint32_t * set;    /**< Registro SET del puerto: pone en uno los bits escritos. */
+    volatile uint32_t * clear;  /**< Registro CLR del puerto: pone en cero los bits escritos. */
+    volatile uint32_t * toggle; /**< Registro NOT del puerto: invierte los bits escritos. */
+    volatile uint32_t * level;  /**< Registro PIN del puerto: nivel eléctrico de los pines. */
+    uint32_t mask;              /**< Máscara del bit dentro del puerto. */
+    uint32_t invert;            /**< Igual a `mask` si la lógica es invertida, cero en caso contrario. */
+} digital_pin_t;
+
+/**
+ * @brief Ubicación de un pin GPIO, para crear varias salidas o entradas digitales en una sola llamada.
+ */
+typedef struct digital_pin_location_s {
+    uint8_t gpio; /**< Número del puerto GPIO. */
+    uint8_t bit;  /**< Número de bit dentro del puerto. */
+} digital_pin_location_t;
+
+/**
+ * @brief Evento de cambio de una entrada digital registrado por una interrupción de pin.
+ */
+typedef struct digital_event_s {
+    uint32_t timestamp;    /**< Valor del contador de ciclos del DWT al atender la interrupción. */
+    digital_input_t input; /**< Entrada que cambió. */
+    digital_states_t edge; /**< Cambio detectado: activada o desactivada. */
+} digital_event_t;
+
+/**
+ * @brief Función que se ejecuta ante un cambio de una entrada digital de un banco.
+ *
+ * @param input   Entrada que cambió.
+ * @param object  Objeto indicado al registrar la función con DigitalInputSetHandlers().
+ */
+typedef void (*digital_input_handler_t)(digital_input_t input, void * object);
+
+/**
+ * @brief Funciones que se ejecutan ante los cambios de una entrada digital de un banco.
+ *
+ * Cualquiera de las funciones puede ser `NULL` si el cambio correspondiente no interesa.
+ */
+typedef struct digital_input_handlers_s {
+    digital_input_handler_t activated;   /**< Se ejecuta cuando la entrada pasa de inactiva a activa. */
+    digital_input_handler_t deactivated; /**< Se ejecuta cuando la entrada pasa de activa a inactiva. */
+    digital_input_handler_t hold;        /**< Se ejecuta una vez por activación si la entrada sigue activa. */
+    uint16_t holdScans;                  /**< Exploraciones después de la activación hasta ejecutar `hold`. */
+} digital_input_handlers_t;
+
 /* === Public variable declarations ================================================================================ */
 
 /* === Public function declarations ================================================================================ */
@@ -73,10 +140,40 @@ typedef struct digital_input_s * digital_input_t;
  *
  * @param gpio  Número del puerto GPIO a utilizar.
  * @param bit   Bit dentro del puerto GPIO que se utilizará.
- * @return digital_output_t  Puntero a la instancia de la salida digital creada.
+ * @return digital_output_t  Puntero a la instancia de la salida digital creada, o `NULL` si se agotó la reserva de
+ *                           `DIGITAL_OUTPUT_POOL_SIZE` instancias.
  */
 digital_output_t DigitalOutputCreate(uint8_t gpio, uint8_t bit);
 
+/**
+ * @brief Crea varias salidas digitales en una sola llamada.
+ *
+ * Equivale a llamar a DigitalOutputCreate() con cada pin, pero agrupa los pines por puerto GPIO: todas las salidas
+ * arrancan inactivas con una única escritura en el registro CLR de cada puerto y se configuran como salidas con un
+ * único acceso enmascarado al registro DIR del puerto, en lugar de dos accesos por pin.
+ *
+ * @param pins     Arreglo con la ubicación de cada pin.
+ * @param count    Cantidad de pines en el arreglo.
+ * @param outputs  Arreglo donde se guarda la salida creada para cada pin, en el mismo orden.
+ * @return `true` si se crearon todas las salidas; `false` si algún pin no está en un puerto válido o no alcanza la
+ *         reserva de `DIGITAL_OUTPUT_POOL_SIZE` instancias, en cuyo caso no se crea ninguna.
+ */
+bool DigitalOutputCreateMany(const digital_pin_location_t pins[], uint8_t count, digital_output_t outputs[]);
+
+/**
+ * @brief Crea una salida digital sobre una salida de un expansor con registros de desplazamiento.
+ *
+ * La salida se maneja con las mismas funciones que una salida GPIO, pero cada cambio solo modifica la copia del
+ * expansor y llega al pin en el próximo ExpanderRefresh(). No tiene acceso directo a un pin, por lo que no puede
+ * formar parte de un grupo ni usarse en los módulos que manejan pines desde una interrupción.
+ *
+ * @param expander  Puntero a la instancia del expansor, obtenida mediante ExpanderCreate().
+ * @param bit       Número de salida en la cadena: `8 * registro + n` para la salida Qn de cada registro.
+ * @return digital_output_t  Puntero a la instancia de la salida digital creada, o `NULL` si el expansor no es válido
+ *                           o se agotó la reserva de `DIGITAL_OUTPUT_POOL_SIZE` instancias.
+ */
+digital_output_t DigitalOutputCreateOnExpander(struct expander_s * expander, uint8_t bit);
+
 /**
  * @brief Activa una salida digital.
  *
@@ -105,6 +202,116 @@ void DigitalOutputDeactivate(digital_output_t output);
  */
 void DigitalOutputToggle(digital_output_t output);
 
+/**
+ * @brief Devuelve el estado de una salida digital.
+ *
+ * El estado se guarda en RAM, por lo que la consulta no accede al puerto. Refleja los cambios hechos con las funciones
+ * de la salida, incluso los que todavía esperan a DigitalOutputCommit(), pero no los hechos a través de su pin o de un
+ * grupo.
+ *
+ * @param output  Puntero a la instancia de la salida digital, obtenida mediante DigitalOutputCreate().
+ * @return `true` si la salida está activa; `false` en caso contrario.
+ */
+bool DigitalOutputGetState(digital_output_t output);
+
+/**
+ * @brief Configura si los cambios de una salida digital se escriben en el pin al instante o en la próxima confirmación.
+ *
+ * Los cambios de una salida diferida solo modifican una copia en RAM de su puerto, y DigitalOutputCommit() escribe en
+ * una sola vez los bits que quedaron distintos de la confirmación anterior. Así las activaciones repetidas no generan
+ * accesos al puerto y las salidas cambian juntas al final de cada ciclo del programa. Al dejar de ser diferida, un
+ * cambio pendiente de la salida se escribe en ese momento.
+ *
+ * @param output    Puntero a la instancia de la salida digital, obtenida mediante DigitalOutputCreate().
+ * @param deferred  `true` para diferir los cambios de la salida; `false` para escribirlos al instante.
+ * @return `true` si la configuración se aplicó; `false` si la salida pertenece a un expansor o a un grupo, o si su pin
+ *         ya se entregó con DigitalOutputGetPin().
+ */
+bool DigitalOutputSetDeferred(digital_output_t output, bool deferred);
+
+/**
+ * @brief Escribe en los puertos los cambios pendientes de todas las salidas diferidas.
+ *
+ * Recorre solo los puertos con cambios y en cada uno escribe a lo sumo una vez el registro SET y una vez el registro
+ * CLR, con los bits que cambiaron desde la confirmación anterior. Debe llamarse desde el mismo contexto de ejecución
+ * que modifica las salidas diferidas, por ejemplo una vez por ciclo del lazo principal después de ejecutar las tareas.
+ */
+void DigitalOutputCommit(void);
+
+/**
+ * @brief Devuelve el acceso directo al pin de una salida digital.
+ *
+ * El puntero es válido mientras exista la salida y puede guardarse para usarlo con las funciones en línea en los
+ * caminos críticos, como las rutinas de servicio de interrupción. Desde ese momento la salida ya no puede ser diferida.
+ *
+ * @param output  Puntero a la instancia de la salida digital, obtenida mediante DigitalOutputCreate().
+ * @return Puntero constante al acceso directo del pin, o `NULL` si la salida pertenece a un expansor o es diferida.
+ */
+const digital_pin_t * DigitalOutputGetPin(digital_output_t output);
+
+/**
+ * @brief Crea un grupo de salidas digitales que se actualizan en conjunto.
+ *
+ * Precalcula, para cada puerto GPIO que abarcan las salidas, la máscara de bits del grupo. Así activar, desactivar o
+ * conmutar el grupo es una única escritura en los registros SET, CLR o NOT por cada puerto involucrado, y todos los
+ * pines de un mismo puerto cambian en el mismo instante.
+ *
+ * @param outputs  Arreglo con las salidas digitales del grupo. La posición de cada salida en el arreglo es el número
+ *                 de bit que la representa en DigitalOutputGroupWrite().
+ * @param count    Cantidad de salidas en el arreglo, como máximo `DIGITAL_GROUP_MAX_OUTPUTS`.
+ * @return digital_output_group_t  Puntero a la instancia del grupo creado, o `NULL` si los parámetros no son válidos,
+ *                                 alguna salida pertenece a un expansor o es diferida, las salidas abarcan más de
+ *                                 `DIGITAL_GROUP_MAX_PORTS` puertos o se agotó la reserva de `DIGITAL_GROUP_POOL_SIZE`
+ *                                 instancias.
+ */
+digital_output_group_t DigitalOutputGroupCreate(const digital_output_t outputs[], uint8_t count);
+
+/**
+ * @brief Verifica si un conjunto de salidas puede formar un grupo, sin crearlo.
+ *
+ * Permite validar todos los grupos de un objeto antes de tomar alguno de la reserva, que no devuelve instancias.
+ *
+ * @param outputs  Arreglo con las salidas digitales del grupo.
+ * @param count    Cantidad de salidas en el arreglo.
+ * @return `true` si DigitalOutputGroupCreate() aceptaría las salidas habiendo lugar en la reserva; `false` si no.
+ */
+bool DigitalOutputGroupIsValid(const digital_output_t outputs[], uint8_t count);
+
+/**
+ * @brief Activa todas las salidas de un grupo.
+ *
+ * @param group  Puntero a la instancia del grupo, obtenida mediante DigitalOutputGroupCreate().
+ */
+void DigitalOutputGroupActivate(digital_output_group_t group);
+
+/**
+ * @brief Desactiva todas las salidas de un grupo.
+ *
+ * @param group  Puntero a la instancia del grupo, obtenida mediante DigitalOutputGroupCreate().
+ */
+void DigitalOutputGroupDeactivate(digital_output_group_t group);
+
+/**
+ * @brief Cambia el estado de todas las salidas de un grupo.
+ *
+ * @param group  Puntero a la instancia del grupo, obtenida mediante DigitalOutputGroupCreate().
+ */
+void DigitalOutputGroupToggle(digital_output_group_t group);
+
+/**
+ * @brief Escribe un patrón de bits sobre las salidas de un grupo.
+ *
+ * El bit `n` del patrón fija el estado de la salida que ocupaba la posición `n` al crear el grupo. Cada puerto se
+ * actualiza con una escritura en el registro CLR, que desactiva las salidas del grupo que quedan inactivas, seguida de
+ * una en el registro SET, que activa las demás. Entre las dos escrituras las salidas que se activan todavía no
+ * cambiaron y las que se desactivan ya lo hicieron. No se usa el registro MASK del puerto, de modo que la función se
+ * puede interrumpir o llamar desde una interrupción sin afectar otros pines del puerto.
+ *
+ * @param group    Puntero a la instancia del grupo, obtenida mediante DigitalOutputGroupCreate().
+ * @param pattern  Patrón con el estado de cada salida, `1` para activa y `0` para inactiva.
+ */
+void DigitalOutputGroupWrite(digital_output_group_t group, uint32_t pattern);
+
 /**
  * @brief Crea una entrada digital.
  *
@@ -113,10 +320,28 @@ void DigitalOutputToggle(digital_output_t output);
  * @param gpio      Número del puerto GPIO a utilizar.
  * @param bit       Bit dentro del puerto GPIO que se utilizará.
  * @param inverted  `true` si la lógica de la entrada es invertida; `false` en caso contrario.
- * @return digital_input_t  Puntero a la instancia de la entrada digital creada.
+ * @return digital_input_t  Puntero a la instancia de la entrada digital creada, o `NULL` si se agotó la reserva de
+ *                          `DIGITAL_INPUT_POOL_SIZE` instancias.
  */
 digital_input_t DigitalInputCreate(uint8_t gpio, uint8_t bit, bool inverted);
 
+/**
+ * @brief Crea varias entradas digitales en una sola llamada.
+ *
+ * Equivale a llamar a DigitalInputCreate() con cada pin, pero configura como entradas todos los pines de un mismo
+ * puerto GPIO con un único acceso enmascarado al registro DIR y toma el estado inicial de todas las entradas del
+ * puerto con una única lectura.
+ *
+ * @param pins      Arreglo con la ubicación de cada pin.
+ * @param count     Cantidad de pines en el arreglo.
+ * @param inverted  `true` si la lógica de las entradas es invertida; `false` en caso contrario.
+ * @param inputs    Arreglo donde se guarda la entrada creada para cada pin, en el mismo orden.
+ * @return `true` si se crearon todas las entradas; `false` si algún pin no está en un puerto válido o no alcanza la
+ *         reserva de `DIGITAL_INPUT_POOL_SIZE` instancias, en cuyo caso no se crea ninguna.
+ */
+bool DigitalInputCreateMany(const digital_pin_location_t pins[], uint8_t count, bool inverted,
+                            digital_input_t inputs[]);
+
 /**
  * @brief Lee el estado actual de una entrada digital.
  *
@@ -125,6 +350,17 @@ digital_input_t DigitalInputCreate(uint8_t gpio, uint8_t bit, bool inverted);
  */
 bool DigitalInputGetIsActive(digital_input_t input);
 
+/**
+ * @brief Devuelve el acceso directo al pin de una entrada digital.
+ *
+ * DigitalPinGetIsActive() lee el pin en el momento de la llamada y aplica la inversión de la entrada, sin pasar por la
+ * captura del banco ni por el filtro antirrebote.
+ *
+ * @param input  Puntero a la instancia de la entrada digital, obtenida mediante DigitalInputCreate().
+ * @return Puntero constante al acceso directo del pin.
+ */
+const digital_pin_t * DigitalInputGetPin(digital_input_t input);
+
 /**
  * @brief Verifica si el estado de una entrada digital ha cambiado.
  *
@@ -155,6 +391,164 @@ bool DigitalInputWasActivated(digital_input_t input);
  */
 bool DigitalInputWasDeactivated(digital_input_t input);
 
+/**
+ * @brief Crea un banco de entradas digitales que se leen en conjunto.
+ *
+ * El banco precalcula, para cada puerto GPIO que abarcan las entradas, la máscara de bits de las entradas y la máscara
+ * de inversión. Cada llamada a DigitalInputBankScan() lee una única vez cada puerto y calcula los flancos de todas las
+ * entradas con operaciones sobre la palabra completa. A partir de ese momento las funciones de consulta de cada
+ * entrada responden con la última captura del banco, sin acceder al hardware.
+ *
+ * @param inputs  Arreglo con las entradas digitales del banco. Una entrada solo puede pertenecer a un banco.
+ * @param count   Cantidad de entradas en el arreglo.
+ * @return digital_input_bank_t  Puntero a la instancia del banco creado, o `NULL` si los parámetros no son válidos,
+ *                               las entradas abarcan más de `DIGITAL_BANK_MAX_PORTS` puertos o se agotó la reserva de
+ *                               `DIGITAL_BANK_POOL_SIZE` instancias.
+ */
+digital_input_bank_t DigitalInputBankCreate(const digital_input_t inputs[], uint8_t count);
+
+/**
+ * @brief Captura el estado de todas las entradas de un banco.
+ *
+ * Lee cada puerto del banco una única vez, aplica la inversión de las entradas y el filtro antirrebote y calcula las
+ * máscaras de flancos respecto de la captura anterior. Debe llamarse una vez por ciclo de exploración, con un período
+ * constante para que el filtro antirrebote tenga una duración definida.
+ *
+ * Antes de volver ejecuta las funciones registradas con DigitalInputSetHandlers() para las entradas que cambiaron o
+ * que completaron una pulsación prolongada. Solo se recorren los bits que cambiaron en cada puerto, de modo que el
+ * costo depende de la cantidad de cambios y no de la cantidad de entradas del banco.
+ *
+ * @param bank  Puntero a la instancia del banco, obtenida mediante DigitalInputBankCreate().
+ */
+void DigitalInputBankScan(digital_input_bank_t bank);
+
+/**
+ * @brief Configura el filtro antirrebote de las entradas de un banco.
+ *
+ * Una entrada del banco cambia de estado recién cuando DigitalInputBankScan() la encuentra en el nuevo nivel durante
+ * `samples` exploraciones consecutivas. El filtro se aplica a todos los bits del puerto a la vez, por lo que su costo
+ * no depende de la cantidad de entradas. Con `samples` igual a 1, valor inicial de todo banco, no hay filtrado.
+ *
+ * @param bank     Puntero a la instancia del banco, obtenida mediante DigitalInputBankCreate().
+ * @param samples  Cantidad de muestras consecutivas estables, entre 1 y `2^DIGITAL_DEBOUNCE_BITS - 1`.
+ * @return `true` si la configuración es válida; `false` en caso contrario.
+ */
+bool DigitalInputBankSetDebounce(digital_input_bank_t bank, uint8_t samples);
+
+/**
+ * @brief Devuelve el estado de las entradas de un banco en un puerto, según la última captura.
+ *
+ * @param bank  Puntero a la instancia del banco, obtenida mediante DigitalInputBankCreate().
+ * @param gpio  Número del puerto GPIO a consultar.
+ * @return Máscara con un `1` en el bit de cada entrada activa del puerto.
+ */
+uint32_t DigitalInputBankGetState(digital_input_bank_t bank, uint8_t gpio);
+
+/**
+ * @brief Devuelve las entradas de un banco en un puerto que se activaron en la última captura.
+ *
+ * @param bank  Puntero a la instancia del banco, obtenida mediante DigitalInputBankCreate().
+ * @param gpio  Número del puerto GPIO a consultar.
+ * @return Máscara con un `1` en el bit de cada entrada del puerto que pasó de inactiva a activa.
+ */
+uint32_t DigitalInputBankGetActivated(digital_input_bank_t bank, uint8_t gpio);
+
+/**
+ * @brief Devuelve las entradas de un banco en un puerto que se desactivaron en la última captura.
+ *
+ * @param bank  Puntero a la instancia del banco, obtenida mediante DigitalInputBankCreate().
+ * @param gpio  Número del puerto GPIO a consultar.
+ * @return Máscara con un `1` en el bit de cada entrada del puerto que pasó de activa a inactiva.
+ */
+uint32_t DigitalInputBankGetDeactivated(digital_input_bank_t bank, uint8_t gpio);
+
+/**
+ * @brief Registra las funciones que se ejecutan ante los cambios de una entrada digital de un banco.
+ *
+ * Las funciones se ejecutan dentro de DigitalInputBankScan(), en el contexto que explora el banco, y reemplazan a las
+ * que se hubieran registrado antes para la entrada. Son independientes de DigitalInputWasChanged(), que sigue
+ * informando los mismos cambios.
+ *
+ * @param input     Puntero a la instancia de la entrada digital, obtenida mediante DigitalInputCreate(). La entrada
+ *                  tiene que pertenecer a un banco.
+ * @param handlers  Funciones a ejecutar, que se copian en la entrada, o `NULL` para dejar de ejecutarlas.
+ * @param object    Objeto que reciben las funciones.
+ * @return `true` si las funciones quedaron registradas; `false` si la entrada no pertenece a un banco o si hay una
+ *         función de pulsación prolongada con `holdScans` igual a cero.
+ */
+bool DigitalInputSetHandlers(digital_input_t input, const digital_input_handlers_t * handlers, void * object);
+
+/**
+ * @brief Asocia una entrada digital a un canal de interrupción de pin.
+ *
+ * El canal se configura para interrumpir en ambos flancos. La rutina de servicio registra cada cambio de la entrada con
+ * su marca de tiempo en una cola de eventos de un único productor y un único consumidor, que la aplicación vacía con
+ * DigitalInputGetEvent(). A partir de ese momento DigitalInputWasChanged() informa, en orden y de a uno por consulta,
+ * los cambios registrados por la interrupción, por lo que no se pierden pulsaciones más breves que el período con que
+ * se consulta la entrada.
+ *
+ * @param input    Puntero a la instancia de la entrada digital, obtenida mediante DigitalInputCreate(). La entrada no
+ *                 puede pertenecer a un banco.
+ * @param channel  Canal de interrupción de pin, entre 0 y 7.
+ * @return `true` si la entrada quedó asociada; `false` si el canal no es válido o ya está en uso, o si la entrada ya
+ *         tiene un canal o pertenece a un banco.
+ */
+bool DigitalInputAttachInterrupt(digital_input_t input, uint8_t channel);
+
+/**
+ * @brief Retira el evento más antiguo de la cola de eventos de las entradas asociadas a interrupciones.
+ *
+ * Debe llamarse desde un único contexto de ejecución, que es el consumidor de la cola.
+ *
+ * @param event  Estructura donde se copia el evento.
+ * @return `true` si había un evento en la cola; `false` si la cola estaba vacía.
+ */
+bool DigitalInputGetEvent(digital_event_t * event);
+
+/**
+ * @brief Devuelve la cantidad de eventos descartados porque la cola estaba llena.
+ *
+ * @return Cantidad de eventos descartados desde el inicio.
+ */
+uint32_t DigitalInputGetLostEvents(void);
+
+/**
+ * @brief Activa un pin con una única escritura en el registro SET de su puerto.
+ *
+ * @param pin  Acceso directo al pin, obtenido mediante DigitalOutputGetPin().
+ */
+static inline void DigitalPinActivate(const digital_pin_t * pin) {
+    CHIP_REG_WRITE(pin->set, pin->mask);
+}
+
+/**
+ * @brief Desactiva un pin con una única escritura en el registro CLR de su puerto.
+ *
+ * @param pin  Acceso directo al pin, obtenido mediante DigitalOutputGetPin().
+ */
+static inline void DigitalPinDeactivate(const digital_pin_t * pin) {
+    CHIP_REG_WRITE(pin->clear, pin->mask);
+}
+
+/**
+ * @brief Cambia el estado de un pin con una única escritura en el registro NOT de su puerto.
+ *
+ * @param pin  Acceso directo al pin, obtenido mediante DigitalOutputGetPin().
+ */
+static inline void DigitalPinToggle(const digital_pin_t * pin) {
+    CHIP_REG_WRITE(pin->toggle, pin->mask);
+}
+
+/**
+ * @brief Lee el estado lógico de un pin con una única lectura del registro PIN de su puerto.
+ *
+ * @param pin  Acceso directo al pin, obtenido mediante DigitalOutputGetPin() o DigitalInputGetPin().
+ * @return `true` si el pin está activo, teniendo en cuenta la inversión de la entrada; `false` en caso contrario.
+ */
+static inline bool DigitalPinGetIsActive(const digital_pin_t * pin) {
+    return ((CHIP_REG_READ(pin->level) ^ pin->invert) & pin->mask) != 0;
+}
+
 /* === End of conditional blocks =================================================================================== */
 
 #ifdef __cplusplus
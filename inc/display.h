@@ -0,0 +1,147 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef DISPLAY_H_
+#define DISPLAY_H_
+
+/** @file display.h
+ ** @brief Controlador de una pantalla multiplexada de dígitos de siete segmentos.
+ **
+ ** El refresco se hace desde la interrupción de un temporizador, que enciende un dígito por vez. Cada llamada realiza
+ ** siempre las mismas escrituras de puerto, sin importar el contenido de la pantalla, por lo que su costo es acotado.
+ ** Las funciones de escritura preparan un cuadro completo con los segmentos ya calculados y lo publican de una sola
+ ** vez; la interrupción lo toma al comenzar el barrido siguiente, por lo que nunca se muestra un cuadro a medias.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "digital.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define SEGMENT_A (1 << 0) /**< Bit del segmento A en los patrones de segmentos */
+#define SEGMENT_B (1 << 1) /**< Bit del segmento B en los patrones de segmentos */
+#define SEGMENT_C (1 << 2) /**< Bit del segmento C en los patrones de segmentos */
+#define SEGMENT_D (1 << 3) /**< Bit del segmento D en los patrones de segmentos */
+#define SEGMENT_E (1 << 4) /**< Bit del segmento E en los patrones de segmentos */
+#define SEGMENT_F (1 << 5) /**< Bit del segmento F en los patrones de segmentos */
+#define SEGMENT_G (1 << 6) /**< Bit del segmento G en los patrones de segmentos */
+#define SEGMENT_P (1 << 7) /**< Bit del punto decimal en los patrones de segmentos */
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Puntero a una instancia de una pantalla
+ */
+typedef struct display_s * display_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea una pantalla multiplexada.
+ *
+ * La pantalla se crea apagada, sin puntos ni parpadeo.
+ *
+ * @param digits    Salidas que encienden cada dígito, de izquierda a derecha.
+ * @param count     Cantidad de dígitos, como máximo `DISPLAY_MAX_DIGITS`.
+ * @param segments  Ocho salidas que encienden los segmentos, en el orden A, B, C, D, E, F, G y punto decimal.
+ * @return display_t  Puntero a la instancia de la pantalla creada, o `NULL` si los parámetros no son válidos, no se
+ *                    pudieron crear los grupos de salidas o se agotó la reserva de `DISPLAY_POOL_SIZE` instancias.
+ */
+display_t DisplayCreate(const digital_output_t digits[], uint8_t count, const digital_output_t segments[8]);
+
+/**
+ * @brief Muestra un número en la pantalla.
+ *
+ * Cada valor se traduce a segmentos con una tabla constante. Los valores de 10 a 15 se muestran como las letras
+ * hexadecimales correspondientes. Los puntos decimales configurados con DisplaySetDot() se conservan.
+ *
+ * @param display  Puntero a la instancia de la pantalla, obtenida mediante DisplayCreate().
+ * @param number   Arreglo con un valor BCD por dígito, empezando por el de la izquierda.
+ * @param size     Cantidad de valores del arreglo. Los dígitos que sobran se apagan.
+ */
+void DisplayWriteBcd(display_t display, const uint8_t number[], uint8_t size);
+
+/**
+ * @brief Enciende o apaga el punto decimal de un dígito.
+ *
+ * @param display  Puntero a la instancia de la pantalla, obtenida mediante DisplayCreate().
+ * @param digit    Número de dígito, empezando por cero a la izquierda.
+ * @param on       `true` para encender el punto; `false` para apagarlo.
+ */
+void DisplaySetDot(display_t display, uint8_t digit, bool on);
+
+/**
+ * @brief Configura el parpadeo de un conjunto de dígitos.
+ *
+ * @param display  Puntero a la instancia de la pantalla, obtenida mediante DisplayCreate().
+ * @param digits   Máscara de los dígitos que parpadean: el bit `n` corresponde al dígito `n`.
+ * @param period   Barridos completos de la pantalla que dura cada mitad del parpadeo, o cero para no parpadear.
+ */
+void DisplaySetBlink(display_t display, uint8_t digits, uint16_t period);
+
+/**
+ * @brief Apaga el dígito encendido y enciende el siguiente con su patrón de segmentos.
+ *
+ * Al comenzar cada barrido toma el último cuadro publicado. Está pensada para llamarse desde una interrupción
+ * periódica; DisplayStart() configura un temporizador que la invoca.
+ *
+ * @param display  Puntero a la instancia de la pantalla, obtenida mediante DisplayCreate().
+ */
+void DisplayRefresh(display_t display);
+
+/**
+ * @brief Inicia el refresco de una pantalla desde la interrupción del temporizador de la pantalla.
+ *
+ * Solo una pantalla puede refrescarse por interrupción; iniciar otra reemplaza a la anterior.
+ *
+ * @param display    Puntero a la instancia de la pantalla, obtenida mediante DisplayCreate().
+ * @param frequency  Cantidad de dígitos que se encienden por segundo. La frecuencia de cada barrido completo es esta
+ *                   dividida por la cantidad de dígitos.
+ * @return `true` si el temporizador se pudo configurar; `false` si la frecuencia no es válida.
+ */
+bool DisplayStart(display_t display, uint32_t frequency);
+
+/**
+ * @brief Devuelve el costo máximo medido de un refresco hecho por la interrupción.
+ *
+ * @param display  Puntero a la instancia de la pantalla, obtenida mediante DisplayCreate().
+ * @return Mayor cantidad de ciclos del contador del DWT que insumió una llamada a DisplayRefresh() desde la
+ *         interrupción.
+ */
+uint32_t DisplayGetRefreshCycles(display_t display);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISPLAY_H_ */
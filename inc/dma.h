@@ -0,0 +1,81 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef DMA_H_
+#define DMA_H_
+
+/** @file dma.h
+ ** @brief Atención compartida de la interrupción del controlador de DMA.
+ **
+ ** El controlador de DMA tiene una única interrupción para todos sus canales. Este módulo la atiende: reconoce el fin
+ ** de transferencia y el error de cada canal que los pidió, tenga o no una función registrada, para que la
+ ** interrupción nunca quede pendiente, y después ejecuta la función que el dueño del canal registró con
+ ** DmaSetHandler(). Liberar el canal, por ejemplo con `Chip_GPDMA_Stop()`, queda a cargo de esa función.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Función que se ejecuta desde la interrupción del DMA cuando un canal la pidió.
+ *
+ * @param channel    Canal que pidió la interrupción.
+ * @param completed  `true` si terminó la transferencia; `false` si hubo un error.
+ * @param object     Objeto indicado al registrar la función.
+ */
+typedef void (*dma_handler_t)(uint8_t channel, bool completed, void * object);
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Registra la función que atiende las interrupciones de un canal de DMA.
+ *
+ * Reemplaza a la función registrada antes para el canal. La primera función registrada habilita la interrupción del
+ * controlador de DMA.
+ *
+ * @param channel  Canal de DMA, obtenido con `Chip_GPDMA_GetFreeChannel()`.
+ * @param handler  Función a ejecutar, o `NULL` para que el canal solo se reconozca.
+ * @param object   Puntero que se entrega a la función.
+ * @return `true` si el canal es válido; `false` en caso contrario.
+ */
+bool DmaSetHandler(uint8_t channel, dma_handler_t handler, void * object);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DMA_H_ */
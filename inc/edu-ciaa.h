@@ -27,6 +27,8 @@ SPDX-License-Identifier: MIT
 
 /* === Headers files inclusions ==================================================================================== */
 
+#include "chip.h"
+
 /* === Header for C++ compatibility ================================================================================ */
 
 #ifdef __cplusplus
@@ -35,56 +37,113 @@ extern "C" {
 
 /* === Public macros definitions =================================================================================== */
 
-#define LED_B_PORT 2
-#define LED_B_PIN  2
-#define LED_B_FUNC SCU_MODE_FUNC4
-#define LED_B_GPIO 5
-#define LED_B_BIT  2
-
-#define LED_1_PORT 2
-#define LED_1_PIN  10
-#define LED_1_FUNC SCU_MODE_FUNC0
-#define LED_1_GPIO 0
-#define LED_1_BIT  14
-
-#define LED_2_PORT 2
-#define LED_2_PIN  11
-#define LED_2_FUNC SCU_MODE_FUNC0
-#define LED_2_GPIO 1
-#define LED_2_BIT  11
-
-#define LED_3_PORT 2
-#define LED_3_PIN  12
-#define LED_3_FUNC SCU_MODE_FUNC0
-#define LED_3_GPIO 1
-#define LED_3_BIT  12
-
-#define TEC_1_PORT 1
-#define TEC_1_PIN  0
-#define TEC_1_FUNC SCU_MODE_FUNC0
-#define TEC_1_GPIO 0
-#define TEC_1_BIT  4
-
-#define TEC_2_PORT 1
-#define TEC_2_PIN  1
-#define TEC_2_FUNC SCU_MODE_FUNC0
-#define TEC_2_GPIO 0
-#define TEC_2_BIT  8
-
-#define TEC_3_PORT 1
-#define TEC_3_PIN  2
-#define TEC_3_FUNC SCU_MODE_FUNC0
-#define TEC_3_GPIO 0
-#define TEC_3_BIT  9
-
-#define TEC_4_PORT 1
-#define TEC_4_PIN  6
-#define TEC_4_FUNC SCU_MODE_FUNC0
-#define TEC_4_GPIO 1
-#define TEC_4_BIT  9
+/*
+ * Tablas de pines de la placa. Cada fila describe un pin con su nombre, su posición en el SCU, su función y su puerto
+ * y bit GPIO. A partir de estas tablas se generan las constantes `<nombre>_PORT`, `<nombre>_PIN`, `<nombre>_FUNC`,
+ * `<nombre>_GPIO` y `<nombre>_BIT`, la configuración del SCU que BoardCreate() aplica en un solo recorrido, y los campos
+ * de la estructura de la placa. Agregar un pin es agregar una fila.
+ *
+ * Las constantes conservan los nombres de las antiguas macros `LED_*` y `TEC_*`, pero son enumeraciones: se usan igual
+ * en el código y en las expresiones constantes, aunque no con `#if` ni `#ifdef`. Las macros BOARD_PIN_SET() y
+ * siguientes acceden al puerto sin pasar por la salida digital del pin, así que no se deben usar sobre una salida
+ * diferida ni perteneciente a un grupo.
+ */
+
+/**
+ * @brief Salidas digitales de la placa: X(nombre, campo, puerto SCU, pin SCU, función, puerto GPIO, bit GPIO).
+ *
+ * Cada fila genera un campo `campo` de tipo digital_output_t en la estructura de la placa.
+ */
+#define BOARD_OUTPUTS(X)                                                                                               \
+    X(LED_2, led_red,    2, 11, SCU_MODE_FUNC0, 1, 11)                                                                 \
+    X(LED_3, led_green,  2, 12, SCU_MODE_FUNC0, 1, 12)                                                                 \
+    X(LED_B, led_blue,   2, 2,  SCU_MODE_FUNC4, 5, 2)                                                                  \
+    X(LED_1, led_yellow, 2, 10, SCU_MODE_FUNC0, 0, 14)
+
+/**
+ * @brief Teclas de la placa: X(nombre, campo, puerto SCU, pin SCU, función, puerto GPIO, bit GPIO).
+ *
+ * Cada fila genera un campo `campo` de tipo digital_input_t en la estructura de la placa, que además forma parte del
+ * banco de teclas.
+ */
+#define BOARD_INPUTS(X)                                                                                                \
+    X(TEC_1, tec_1, 1, 0, SCU_MODE_FUNC0, 0, 4)                                                                        \
+    X(TEC_2, tec_2, 1, 1, SCU_MODE_FUNC0, 0, 8)                                                                        \
+    X(TEC_3, tec_3, 1, 2, SCU_MODE_FUNC0, 0, 9)                                                                        \
+    X(TEC_4, tec_4, 1, 6, SCU_MODE_FUNC0, 1, 9)
+
+/**
+ * @brief Dígitos de la pantalla del poncho, de izquierda a derecha: X(nombre, puerto SCU, pin SCU, función, puerto
+ * GPIO, bit GPIO).
+ */
+#define BOARD_DIGITS(X)                                                                                                \
+    X(DIGIT_1, 0, 0,  SCU_MODE_FUNC0, 0, 0)                                                                            \
+    X(DIGIT_2, 0, 1,  SCU_MODE_FUNC0, 0, 1)                                                                            \
+    X(DIGIT_3, 1, 15, SCU_MODE_FUNC0, 0, 2)                                                                            \
+    X(DIGIT_4, 1, 17, SCU_MODE_FUNC0, 0, 3)
+
+/**
+ * @brief Segmentos de la pantalla del poncho, en el orden A a G y punto decimal: X(nombre, puerto SCU, pin SCU,
+ * función, puerto GPIO, bit GPIO).
+ */
+#define BOARD_SEGMENTS(X)                                                                                              \
+    X(SEGMENT_A, 4, 0, SCU_MODE_FUNC0, 2, 0)                                                                           \
+    X(SEGMENT_B, 4, 1, SCU_MODE_FUNC0, 2, 1)                                                                           \
+    X(SEGMENT_C, 4, 2, SCU_MODE_FUNC0, 2, 2)                                                                           \
+    X(SEGMENT_D, 4, 3, SCU_MODE_FUNC0, 2, 3)                                                                           \
+    X(SEGMENT_E, 4, 4, SCU_MODE_FUNC0, 2, 4)                                                                           \
+    X(SEGMENT_F, 4, 5, SCU_MODE_FUNC0, 2, 5)                                                                           \
+    X(SEGMENT_G, 4, 6, SCU_MODE_FUNC0, 2, 6)                                                                           \
+    X(SEGMENT_P, 6, 8, SCU_MODE_FUNC4, 5, 16)
+
+/**
+ * @brief Pines asignados a funciones de periféricos: X(nombre, puerto SCU, pin SCU, modo y función).
+ */
+#define BOARD_FUNCTIONS(X)                                                                                             \
+    X(UART_TXD, 7, 1, SCU_MODE_INACT | SCU_MODE_FUNC6)                                                                 \
+    X(UART_RXD, 7, 2, SCU_MODE_INACT | SCU_MODE_INBUFF_EN | SCU_MODE_ZIF_DIS | SCU_MODE_FUNC6)                         \
+    X(RS232_TXD, 2, 3, SCU_MODE_INACT | SCU_MODE_FUNC2)                                                                \
+    X(RS232_RXD, 2, 4, SCU_MODE_INACT | SCU_MODE_INBUFF_EN | SCU_MODE_ZIF_DIS | SCU_MODE_FUNC2)                        \
+    X(SPI_MOSI, 1, 4, SCU_MODE_INACT | SCU_MODE_HIGHSPEEDSLEW_EN | SCU_MODE_FUNC5)                                     \
+    X(SPI_SCK, 15, 4, SCU_MODE_INACT | SCU_MODE_HIGHSPEEDSLEW_EN | SCU_MODE_FUNC0)
+
+/** @brief Modo del SCU de los pines de salida */
+#define BOARD_OUTPUT_MODE (SCU_MODE_INBUFF_EN | SCU_MODE_INACT)
+
+/** @brief Modo del SCU de los pines de las teclas */
+#define BOARD_INPUT_MODE (SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP)
+
+/** @brief Genera las constantes de un pin de una tabla con campo */
+#define BOARD_PIN_FIELD_CONSTANTS(name, field, port, pin, func, gpio, bit)                                             \
+    BOARD_PIN_CONSTANTS(name, port, pin, func, gpio, bit)
+
+/** @brief Genera las constantes de un pin */
+#define BOARD_PIN_CONSTANTS(name, port, pin, func, gpio, bit)                                                          \
+    enum { name##_PORT = port, name##_PIN = pin, name##_FUNC = func, name##_GPIO = gpio, name##_BIT = bit };
+
+/** @brief Genera las constantes de un pin asignado a un periférico */
+#define BOARD_FUNCTION_CONSTANTS(name, port, pin, mode) enum { name##_PORT = port, name##_PIN = pin };
+
+/** @brief Activa un pin de salida de la tabla con una única escritura en el registro SET de su puerto */
+#define BOARD_PIN_SET(name) Chip_GPIO_SetValue(LPC_GPIO_PORT, name##_GPIO, 1u << name##_BIT)
+
+/** @brief Desactiva un pin de salida de la tabla con una única escritura en el registro CLR de su puerto */
+#define BOARD_PIN_CLEAR(name) Chip_GPIO_ClearValue(LPC_GPIO_PORT, name##_GPIO, 1u << name##_BIT)
+
+/** @brief Invierte un pin de salida de la tabla con una única escritura en el registro NOT de su puerto */
+#define BOARD_PIN_TOGGLE(name) Chip_GPIO_SetPortToggle(LPC_GPIO_PORT, name##_GPIO, 1u << name##_BIT)
+
+/** @brief Lee el nivel eléctrico de un pin de la tabla con una única lectura del registro PIN de su puerto */
+#define BOARD_PIN_READ(name) ((Chip_GPIO_GetPortValue(LPC_GPIO_PORT, name##_GPIO) & (1u << name##_BIT)) != 0)
 
 /* === Public data type declarations =============================================================================== */
 
+BOARD_OUTPUTS(BOARD_PIN_FIELD_CONSTANTS)
+BOARD_INPUTS(BOARD_PIN_FIELD_CONSTANTS)
+BOARD_DIGITS(BOARD_PIN_CONSTANTS)
+BOARD_SEGMENTS(BOARD_PIN_CONSTANTS)
+BOARD_FUNCTIONS(BOARD_FUNCTION_CONSTANTS)
+
 /* === Public variable declarations ================================================================================ */
 
 /* === Public function declarations ================================================================================ */
@@ -0,0 +1,141 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef EXPANDER_H_
+#define EXPANDER_H_
+
+/** @file expander.h
+ ** @brief Expansor de salidas con registros de desplazamiento 74HC595 encadenados sobre el SSP.
+ **
+ ** El expansor guarda una copia en RAM de las salidas de toda la cadena. Las escrituras solo modifican esa copia y la
+ ** marcan como modificada, de modo que todos los cambios que se acumulan entre dos refrescos se envían juntos. Cada
+ ** refresco con cambios copia la cadena completa en un buffer y la transmite con una única transferencia de DMA hacia
+ ** la FIFO del SSP. Un segundo canal descarta las tramas que el SSP recibe al mismo tiempo y termina cuando sale el
+ ** último bit, y en ese momento su interrupción genera el pulso de carga que pasa los datos a las salidas de todos los
+ ** registros a la vez. El procesador no espera en ningún momento a que termine la transmisión.
+ **
+ ** Las salidas del expansor se usan como cualquier otra salida digital creándolas con DigitalOutputCreateOnExpander().
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Puntero a una instancia de un expansor de salidas
+ */
+typedef struct expander_s * expander_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea un expansor de salidas.
+ *
+ * El primer expansor configura el SSP y el controlador de DMA. Todas las salidas de la cadena quedan inactivas y
+ * marcadas como modificadas, para que el primer refresco fije el estado de los registros después del encendido.
+ *
+ * @param chips      Cantidad de registros 74HC595 encadenados, como máximo `EXPANDER_MAX_CHIPS`. El registro 0 es el
+ *                   que recibe los datos del microcontrolador.
+ * @param latchGpio  Número del puerto GPIO del pin conectado a la entrada de carga (RCLK) de los registros.
+ * @param latchBit   Bit dentro del puerto GPIO del pin de carga.
+ * @return expander_t  Puntero a la instancia del expansor creado, o `NULL` si los parámetros no son válidos, no se
+ *                     pudo crear la salida de carga o se agotó la reserva de `EXPANDER_POOL_SIZE` instancias.
+ */
+expander_t ExpanderCreate(uint8_t chips, uint8_t latchGpio, uint8_t latchBit);
+
+/**
+ * @brief Escribe salidas de un registro de la cadena en la copia del expansor.
+ *
+ * @param expander  Puntero a la instancia del expansor, obtenida mediante ExpanderCreate().
+ * @param chip      Número de registro en la cadena.
+ * @param mask      Salidas del registro a escribir, con el bit `n` para la salida Qn.
+ * @param value     Estado de las salidas indicadas en `mask`, `1` para activa y `0` para inactiva.
+ */
+void ExpanderWrite(expander_t expander, uint8_t chip, uint8_t mask, uint8_t value);
+
+/**
+ * @brief Cambia el estado de salidas de un registro de la cadena en la copia del expansor.
+ *
+ * @param expander  Puntero a la instancia del expansor, obtenida mediante ExpanderCreate().
+ * @param chip      Número de registro en la cadena.
+ * @param mask      Salidas del registro a cambiar, con el bit `n` para la salida Qn.
+ */
+void ExpanderToggle(expander_t expander, uint8_t chip, uint8_t mask);
+
+/**
+ * @brief Devuelve el estado de las salidas de un registro según la copia del expansor.
+ *
+ * Incluye los cambios que todavía no se enviaron con ExpanderRefresh().
+ *
+ * @param expander  Puntero a la instancia del expansor, obtenida mediante ExpanderCreate().
+ * @param chip      Número de registro en la cadena.
+ * @return Estado de las salidas del registro, con el bit `n` para la salida Qn, o cero si el registro no existe.
+ */
+uint8_t ExpanderRead(expander_t expander, uint8_t chip);
+
+/**
+ * @brief Envía la copia del expansor a los registros si tiene cambios.
+ *
+ * Inicia una única transferencia de DMA con la cadena completa y vuelve sin esperar que termine. Si la copia no tiene
+ * cambios, o si todavía hay una transferencia en curso en el SSP, no hace nada y los cambios quedan para el próximo
+ * refresco. Debe llamarse en forma periódica, por ejemplo desde una tarea del planificador.
+ *
+ * @param expander  Puntero a la instancia del expansor, obtenida mediante ExpanderCreate().
+ * @return `true` si se inició una transferencia; `false` en caso contrario.
+ */
+bool ExpanderRefresh(expander_t expander);
+
+/**
+ * @brief Indica si hay una transferencia del expansor en curso.
+ *
+ * @param expander  Puntero a la instancia del expansor, obtenida mediante ExpanderCreate().
+ * @return `true` si la transferencia todavía no terminó con el pulso de carga; `false` en caso contrario.
+ */
+bool ExpanderIsBusy(expander_t expander);
+
+/**
+ * @brief Devuelve la cantidad de transferencias que inició el expansor.
+ *
+ * @param expander  Puntero a la instancia del expansor, obtenida mediante ExpanderCreate().
+ * @return Transferencias iniciadas desde su creación.
+ */
+uint32_t ExpanderGetTransfers(expander_t expander);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EXPANDER_H_ */
@@ -0,0 +1,171 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef KEYPAD_H_
+#define KEYPAD_H_
+
+/** @file keypad.h
+ ** @brief Controlador de un teclado matricial de hasta 8 filas por 8 columnas.
+ **
+ ** Las filas son salidas digitales que se seleccionan de a una y las columnas son entradas digitales de un mismo puerto
+ ** GPIO, de modo que cada fila se lee con una única lectura del puerto. El estado de todas las teclas se guarda en una
+ ** palabra de 64 bits con un byte por fila, y el filtro antirrebote, la detección de teclas fantasma y las máscaras de
+ ** teclas presionadas y soltadas se calculan con operaciones sobre la palabra completa al terminar cada barrido.
+ **
+ ** La exploración se hace desde la interrupción de un temporizador, que lee una fila por llamada, por lo que el costo
+ ** de cada interrupción es acotado y no depende de la cantidad de teclas presionadas en el barrido.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "digital.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/** @brief Bit de la tecla de una fila y una columna en las palabras de estado del teclado */
+#define KEYPAD_KEY(row, column) (UINT64_C(1) << (8 * (row) + (column)))
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Puntero a una instancia de un teclado matricial
+ */
+typedef struct keypad_s * keypad_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea un teclado matricial.
+ *
+ * Todas las filas quedan sin seleccionar, salvo la primera, que se lee en la primera llamada a KeypadScanRow(). El
+ * teclado se crea sin filtro antirrebote y con todas las teclas sueltas.
+ *
+ * @param rows         Salidas que seleccionan cada fila.
+ * @param rowCount     Cantidad de filas, como máximo `KEYPAD_MAX_ROWS`.
+ * @param columns      Entradas que leen cada columna, todas en el mismo puerto GPIO. Una columna está activa cuando la
+ *                     tecla de la fila seleccionada está presionada, según la lógica configurada en la entrada.
+ * @param columnCount  Cantidad de columnas, como máximo `KEYPAD_MAX_COLUMNS`.
+ * @param activeLow    `true` si una fila se selecciona poniendo su salida en nivel bajo; `false` si se selecciona en
+ *                     nivel alto.
+ * @return keypad_t  Puntero a la instancia del teclado creado, o `NULL` si los parámetros no son válidos, las columnas
+ *                   están en más de un puerto o se agotó la reserva de `KEYPAD_POOL_SIZE` instancias.
+ */
+keypad_t KeypadCreate(const digital_output_t rows[], uint8_t rowCount, const digital_input_t columns[],
+                      uint8_t columnCount, bool activeLow);
+
+/**
+ * @brief Configura el filtro antirrebote del teclado.
+ *
+ * Una tecla cambia de estado recién cuando se la encuentra en el nuevo nivel durante `samples` barridos completos
+ * consecutivos. Con `samples` igual a 1, valor inicial de todo teclado, no hay filtrado.
+ *
+ * @param keypad   Puntero a la instancia del teclado, obtenida mediante KeypadCreate().
+ * @param samples  Cantidad de barridos consecutivos estables, entre 1 y `2^DIGITAL_DEBOUNCE_BITS - 1`.
+ * @return `true` si la configuración es válida; `false` en caso contrario.
+ */
+bool KeypadSetDebounce(keypad_t keypad, uint8_t samples);
+
+/**
+ * @brief Lee la fila seleccionada y selecciona la siguiente.
+ *
+ * La fila se lee una llamada después de seleccionarla, así las columnas tienen un período completo para estabilizarse.
+ * Al leer la última fila se completa el barrido y se actualizan el estado, las teclas fantasma y las máscaras de teclas
+ * presionadas y soltadas. Está pensada para llamarse desde una interrupción periódica; KeypadStart() configura un
+ * temporizador que la invoca.
+ *
+ * @param keypad  Puntero a la instancia del teclado, obtenida mediante KeypadCreate().
+ */
+void KeypadScanRow(keypad_t keypad);
+
+/**
+ * @brief Inicia la exploración de un teclado desde la interrupción del temporizador del teclado.
+ *
+ * Solo un teclado puede explorarse por interrupción; iniciar otro reemplaza al anterior.
+ *
+ * @param keypad     Puntero a la instancia del teclado, obtenida mediante KeypadCreate().
+ * @param frequency  Cantidad de filas que se leen por segundo. La frecuencia de cada barrido completo es esta dividida
+ *                   por la cantidad de filas.
+ * @return `true` si el temporizador se pudo configurar; `false` si la frecuencia no es válida.
+ */
+bool KeypadStart(keypad_t keypad, uint32_t frequency);
+
+/**
+ * @brief Devuelve el estado de todas las teclas según el último barrido.
+ *
+ * @param keypad  Puntero a la instancia del teclado, obtenida mediante KeypadCreate().
+ * @return Palabra con un `1` en el bit KEYPAD_KEY() de cada tecla presionada.
+ */
+uint64_t KeypadGetState(keypad_t keypad);
+
+/**
+ * @brief Devuelve y borra las teclas que se presionaron desde la consulta anterior.
+ *
+ * @param keypad  Puntero a la instancia del teclado, obtenida mediante KeypadCreate().
+ * @return Palabra con un `1` en el bit KEYPAD_KEY() de cada tecla que pasó de suelta a presionada.
+ */
+uint64_t KeypadGetPressed(keypad_t keypad);
+
+/**
+ * @brief Devuelve y borra las teclas que se soltaron desde la consulta anterior.
+ *
+ * @param keypad  Puntero a la instancia del teclado, obtenida mediante KeypadCreate().
+ * @return Palabra con un `1` en el bit KEYPAD_KEY() de cada tecla que pasó de presionada a suelta.
+ */
+uint64_t KeypadGetReleased(keypad_t keypad);
+
+/**
+ * @brief Devuelve las teclas cuya lectura fue ambigua en el último barrido.
+ *
+ * En una matriz sin diodos, tres teclas presionadas en tres esquinas de un rectángulo hacen que la cuarta esquina se
+ * lea presionada. Cuando dos filas comparten dos o más columnas presionadas no se puede saber cuál esquina es la
+ * fantasma, así que las cuatro conservan el estado que tenían hasta que la lectura deja de ser ambigua.
+ *
+ * @param keypad  Puntero a la instancia del teclado, obtenida mediante KeypadCreate().
+ * @return Palabra con un `1` en el bit KEYPAD_KEY() de cada tecla con lectura ambigua.
+ */
+uint64_t KeypadGetGhosts(keypad_t keypad);
+
+/**
+ * @brief Devuelve el costo máximo medido de un barrido completo hecho por la interrupción.
+ *
+ * @param keypad  Puntero a la instancia del teclado, obtenida mediante KeypadCreate().
+ * @return Mayor suma de ciclos del contador del DWT que insumieron las llamadas a KeypadScanRow() desde la interrupción
+ *         durante un barrido completo.
+ */
+uint32_t KeypadGetScanCycles(keypad_t keypad);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* KEYPAD_H_ */
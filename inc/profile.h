@@ -0,0 +1,210 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+/** @file profile.h
+ ** @brief Medición de tiempos de ejecución con el contador de ciclos del DWT.
+ **
+ ** Cada punto de medición es una sonda con nombre que acumula la cantidad de mediciones, el mínimo, el máximo, el
+ ** promedio y un histograma en potencias de dos. Las macros `PROFILE_*` desaparecen por completo cuando
+ ** `PROFILE_ENABLED` vale cero, de modo que las sondas pueden quedar en el código de producción sin costo alguno. En
+ ** el backend simulado el contador de ciclos es el contador virtual del simulador.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include "chip.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#if PROFILE_ENABLED
+
+/** @brief Declara la variable que guarda una sonda, con alcance de archivo */
+#define PROFILE_PROBE(name) static profile_probe_t name
+
+/** @brief Crea la sonda declarada con PROFILE_PROBE(), usando su identificador como nombre, si aún no fue creada */
+#define PROFILE_INIT(name)                                                                                             \
+    do {                                                                                                               \
+        if (name == NULL) {                                                                                            \
+            name = ProfileProbeCreate(#name);                                                                          \
+        }                                                                                                              \
+    } while (0)
+
+/** @brief Toma el instante de comienzo de una medición. Debe usarse en el mismo bloque que PROFILE_END() */
+#define PROFILE_BEGIN(name) uint32_t name##Start = DWT->CYCCNT
+
+/** @brief Registra los ciclos transcurridos desde el PROFILE_BEGIN() de la misma sonda */
+#define PROFILE_END(name) ProfileRecord(name, DWT->CYCCNT - name##Start)
+
+/** @brief Registra una medición obtenida por otro medio, como la cuenta de un temporizador al atender su interrupción */
+#define PROFILE_RECORD(name, cycles) ProfileRecord(name, cycles)
+
+/** @brief Marca el fin de una etapa del arranque, identificada por una cadena constante */
+#define PROFILE_BOOT(phase) ProfileBootMark(phase)
+
+#else
+
+#define PROFILE_PROBE(name)
+#define PROFILE_INIT(name)
+#define PROFILE_BEGIN(name)
+#define PROFILE_END(name)
+#define PROFILE_RECORD(name, cycles)
+#define PROFILE_BOOT(phase)
+
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Puntero a una instancia de una sonda de medición
+ */
+typedef struct profile_probe_s * profile_probe_t;
+
+/**
+ * @brief Estadísticas acumuladas por una sonda.
+ *
+ * La posición `n` del histograma cuenta las mediciones de `2^(n-1)` a `2^n - 1` ciclos, la posición cero las de cero
+ * ciclos y la última también las mayores.
+ */
+typedef struct profile_stats_s {
+    const char * name;                             /**< Nombre de la sonda. */
+    uint32_t count;                                /**< Cantidad de mediciones. */
+    uint32_t min;                                  /**< Menor medición, en ciclos. */
+    uint32_t max;                                  /**< Mayor medición, en ciclos. */
+    uint32_t mean;                                 /**< Promedio de las mediciones, en ciclos. */
+    uint32_t histogram[PROFILE_HISTOGRAM_BUCKETS]; /**< Cantidad de mediciones en cada intervalo. */
+} profile_stats_t;
+
+/**
+ * @brief Marca de tiempo del fin de una etapa del arranque.
+ */
+typedef struct profile_boot_phase_s {
+    const char * name; /**< Nombre de la etapa. */
+    uint32_t cycles;   /**< Valor del contador de ciclos al terminar la etapa. */
+} profile_boot_phase_t;
+
+/**
+ * @brief Función que recibe cada línea de texto generada por ProfileDump() y ProfileBootDump().
+ *
+ * @param object  Puntero opaco pasado a ProfileDump().
+ * @param text    Línea terminada en salto de línea.
+ */
+typedef void (*profile_writer_t)(void * object, const char * text);
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea una sonda de medición.
+ *
+ * La primera llamada habilita el contador de ciclos del DWT y mide el costo de una medición vacía, que luego se
+ * descuenta de cada medición.
+ *
+ * @param name  Nombre de la sonda. Debe permanecer válido mientras exista la sonda.
+ * @return profile_probe_t  Puntero a la sonda creada, o `NULL` si se agotó la reserva de `PROFILE_POOL_SIZE`
+ *                          instancias.
+ */
+profile_probe_t ProfileProbeCreate(const char * name);
+
+/**
+ * @brief Registra una medición en una sonda.
+ *
+ * Una misma sonda no debe usarse desde una interrupción y desde el programa principal a la vez.
+ *
+ * @param probe   Puntero a la sonda, obtenida mediante ProfileProbeCreate(). Si es `NULL` no se registra nada.
+ * @param cycles  Duración medida, en ciclos.
+ */
+void ProfileRecord(profile_probe_t probe, uint32_t cycles);
+
+/**
+ * @brief Obtiene las estadísticas de una sonda.
+ *
+ * @param probe  Puntero a la sonda, obtenida mediante ProfileProbeCreate().
+ * @param stats  Estructura donde se copian las estadísticas.
+ */
+void ProfileGetStats(profile_probe_t probe, profile_stats_t * stats);
+
+/**
+ * @brief Descarta las mediciones acumuladas por una sonda.
+ *
+ * @param probe  Puntero a la sonda, obtenida mediante ProfileProbeCreate().
+ */
+void ProfileReset(profile_probe_t probe);
+
+/**
+ * @brief Genera un informe de texto con las estadísticas de todas las sondas creadas.
+ *
+ * Por cada sonda se genera una línea con las estadísticas y otra con los intervalos no vacíos del histograma.
+ *
+ * @param writer  Función que recibe cada línea del informe.
+ * @param object  Puntero opaco que se pasa a la función en cada llamada.
+ */
+void ProfileDump(profile_writer_t writer, void * object);
+
+/**
+ * @brief Registra el fin de una etapa del arranque con el valor actual del contador de ciclos.
+ *
+ * La primera llamada habilita el contador de ciclos del DWT si aún no lo estaba. En el simulador el contador cuenta
+ * desde el reset; en la placa cuenta desde que se habilita, por lo que conviene marcar la primera etapa al comenzar
+ * main(), cuando el código de arranque ya configuró los relojes. Las marcas que exceden `PROFILE_BOOT_PHASES` se
+ * descartan.
+ *
+ * @param name  Nombre de la etapa. Debe permanecer válido mientras se consulten las marcas.
+ */
+void ProfileBootMark(const char * name);
+
+/**
+ * @brief Obtiene las marcas de las etapas del arranque, en el orden en que se registraron.
+ *
+ * @param phases  Arreglo donde se copian las marcas, con al menos `PROFILE_BOOT_PHASES` posiciones.
+ * @return Cantidad de marcas copiadas.
+ */
+uint8_t ProfileBootGetPhases(profile_boot_phase_t phases[]);
+
+/**
+ * @brief Genera un informe de texto con la duración de cada etapa del arranque.
+ *
+ * Por cada etapa se genera una línea con el instante en que terminó y su duración, en ciclos y en microsegundos.
+ *
+ * @param writer  Función que recibe cada línea del informe.
+ * @param object  Puntero opaco que se pasa a la función en cada llamada.
+ */
+void ProfileBootDump(profile_writer_t writer, void * object);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PROFILE_H_ */
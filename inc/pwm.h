@@ -0,0 +1,109 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef PWM_H_
+#define PWM_H_
+
+/** @file pwm.h
+ ** @brief Modulación por ancho de pulso por software sobre salidas digitales.
+ **
+ ** Los niveles de los canales se ordenan, fuera de la interrupción, en una lista de flancos con el instante de cada
+ ** uno y el estado que toman todas las salidas a partir de él. La interrupción del temporizador solo escribe el
+ ** patrón del flanco actual en el grupo de salidas y programa la comparación del siguiente, por lo que su costo no
+ ** depende de la cantidad de canales. Los niveles nuevos se aplican al comenzar un período, sin pulsos truncados.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "digital.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Puntero a una instancia de un conjunto de canales de modulación por ancho de pulso
+ */
+typedef struct pwm_s * pwm_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea un conjunto de canales de modulación por ancho de pulso.
+ *
+ * Los canales se crean con nivel cero, es decir con las salidas desactivadas.
+ *
+ * @param outputs  Salidas digitales que se modulan. La posición de cada salida en el arreglo es su número de canal.
+ * @param count    Cantidad de salidas, como máximo `PWM_MAX_CHANNELS`.
+ * @return pwm_t  Puntero a la instancia creada, o `NULL` si los parámetros no son válidos, no se pudo crear el grupo
+ *                de salidas o se agotó la reserva de `PWM_POOL_SIZE` instancias.
+ */
+pwm_t PwmCreate(const digital_output_t outputs[], uint8_t count);
+
+/**
+ * @brief Fija el brillo de un canal.
+ *
+ * El nivel se corrige con una tabla de gamma constante para que los pasos se perciban uniformes, y se cuantiza en
+ * `PWM_STEPS` pasos por período. El nuevo nivel se aplica al comenzar el período siguiente.
+ *
+ * @param pwm      Puntero a la instancia, obtenida mediante PwmCreate().
+ * @param channel  Número de canal.
+ * @param level    Brillo, de 0 (apagado) a 255 (encendido todo el período).
+ */
+void PwmSetLevel(pwm_t pwm, uint8_t channel, uint8_t level);
+
+/**
+ * @brief Devuelve el brillo configurado en un canal.
+ *
+ * @param pwm      Puntero a la instancia, obtenida mediante PwmCreate().
+ * @param channel  Número de canal.
+ * @return Último nivel fijado con PwmSetLevel(), o cero si el canal no existe.
+ */
+uint8_t PwmGetLevel(pwm_t pwm, uint8_t channel);
+
+/**
+ * @brief Inicia la modulación desde la interrupción del temporizador de modulación.
+ *
+ * Solo una instancia puede modularse por interrupción; iniciar otra reemplaza a la anterior.
+ *
+ * @param pwm        Puntero a la instancia, obtenida mediante PwmCreate().
+ * @param frequency  Cantidad de períodos por segundo.
+ * @return `true` si el temporizador se pudo configurar; `false` si la frecuencia no permite `PWM_STEPS` pasos por
+ *         período.
+ */
+bool PwmStart(pwm_t pwm, uint32_t frequency);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PWM_H_ */
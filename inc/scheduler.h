@@ -0,0 +1,161 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+/** @file scheduler.h
+ ** @brief Planificador cooperativo de tareas periódicas con reposo sin ticks.
+ **
+ ** Los ticks se cuentan con la comparación de un temporizador de 32 bits que corre libre. Cuando ninguna tarea está
+ ** por vencer, SchedulerIdle() programa la comparación directamente en la próxima activación y duerme el núcleo con
+ ** WFI, de modo que los ticks intermedios no despiertan al procesador. Cualquier otra interrupción, como el refresco
+ ** de la pantalla o una tecla, también lo despierta; después de atenderla el núcleo vuelve a dormir sin volver al lazo
+ ** principal mientras no venza ninguna tarea.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Función que implementa una tarea.
+ *
+ * @param object  Puntero al objeto que se indicó al crear la tarea.
+ */
+typedef void (*scheduler_entry_t)(void * object);
+
+/**
+ * @brief Puntero a una instancia de una tarea del planificador
+ */
+typedef struct scheduler_task_s * scheduler_task_t;
+
+/**
+ * @brief Estadísticas de ejecución de una tarea.
+ *
+ * Los tiempos se expresan en ciclos del núcleo, medidos con el contador de ciclos del DWT.
+ */
+typedef struct scheduler_task_stats_s {
+    uint32_t runs;     /**< Cantidad de ejecuciones de la tarea. */
+    uint32_t overruns; /**< Cantidad de activaciones que se perdieron porque la tarea no se ejecutó a tiempo. */
+    uint32_t last;     /**< Tiempo de ejecución de la última activación. */
+    uint32_t wcet;     /**< Peor tiempo de ejecución observado. */
+} scheduler_task_stats_t;
+
+/**
+ * @brief Tiempo de reposo acumulado por el planificador.
+ *
+ * Los tiempos se expresan en cuentas del temporizador de los ticks, que sigue contando mientras el núcleo duerme.
+ */
+typedef struct scheduler_idle_stats_s {
+    uint32_t sleeps;      /**< Cantidad de veces que el núcleo entró en reposo. */
+    uint64_t sleepCycles; /**< Tiempo total en reposo. */
+    uint64_t totalCycles; /**< Tiempo total transcurrido desde la inicialización. */
+} scheduler_idle_stats_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Inicializa el planificador y programa el temporizador de los ticks.
+ *
+ * Configura el temporizador para interrumpir con la frecuencia indicada y habilita el contador de ciclos del DWT que
+ * se utiliza para medir los tiempos de ejecución de las tareas.
+ *
+ * @param frequency  Frecuencia de los ticks del planificador en Hz.
+ * @return `true` si el temporizador se pudo configurar; `false` si la frecuencia no es válida.
+ */
+bool SchedulerInit(uint32_t frequency);
+
+/**
+ * @brief Crea una tarea periódica.
+ *
+ * La tarea se activa por primera vez `phase` ticks después de su creación y luego cada `period` ticks. Las tareas se
+ * ejecutan hasta completarse, en el orden en que fueron creadas, cuando se llama a SchedulerDispatch().
+ *
+ * @param entry   Función que implementa la tarea.
+ * @param object  Puntero que se entrega a la función en cada ejecución.
+ * @param period  Período de la tarea en ticks, mayor que cero.
+ * @param phase   Desfasaje de la primera activación en ticks.
+ * @return scheduler_task_t  Puntero a la instancia de la tarea creada, o `NULL` si los parámetros no son válidos o se
+ *                           agotó la reserva de `SCHEDULER_TASK_POOL_SIZE` instancias.
+ */
+scheduler_task_t SchedulerTaskCreate(scheduler_entry_t entry, void * object, uint32_t period, uint32_t phase);
+
+/**
+ * @brief Ejecuta las tareas cuya activación está vencida.
+ *
+ * Cada tarea vencida se ejecuta una vez. Si desde su activación transcurrió uno o más períodos completos, las
+ * activaciones perdidas se contabilizan como desbordes y la tarea se realinea a su próximo período.
+ *
+ * @return Cantidad de tareas ejecutadas.
+ */
+uint32_t SchedulerDispatch(void);
+
+/**
+ * @brief Duerme el núcleo hasta la próxima activación de una tarea.
+ *
+ * Si alguna tarea ya está vencida retorna sin dormir. Las interrupciones que despiertan al núcleo antes de la
+ * activación se atienden y el núcleo vuelve a dormir, de modo que el lazo principal solo corre cuando hay tareas
+ * vencidas. Los ticks transcurridos en reposo se contabilizan al despertar.
+ */
+void SchedulerIdle(void);
+
+/**
+ * @brief Obtiene el tiempo de reposo acumulado desde la inicialización del planificador.
+ *
+ * @param stats  Estructura donde se copian los tiempos.
+ */
+void SchedulerGetIdleStats(scheduler_idle_stats_t * stats);
+
+/**
+ * @brief Devuelve la cantidad de ticks transcurridos desde la inicialización del planificador.
+ *
+ * @return Cantidad de ticks.
+ */
+uint32_t SchedulerGetTicks(void);
+
+/**
+ * @brief Obtiene las estadísticas de ejecución de una tarea.
+ *
+ * @param task   Puntero a la instancia de la tarea, obtenida mediante SchedulerTaskCreate().
+ * @param stats  Estructura donde se copian las estadísticas.
+ */
+void SchedulerTaskGetStats(scheduler_task_t task, scheduler_task_stats_t * stats);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHEDULER_H_ */
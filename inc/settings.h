@@ -0,0 +1,129 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef SETTINGS_H_
+#define SETTINGS_H_
+
+/** @file settings.h
+ ** @brief Almacenamiento de ajustes en la EEPROM interna con nivelación del desgaste.
+ **
+ ** Los ajustes se guardan como un registro de escritura secuencial: cada grabación agrega un registro pequeño con un
+ ** número de secuencia, la versión del formato, los datos y un CRC, en la posición siguiente a la del último registro.
+ ** Las posiciones recorren en forma circular todas las páginas asignadas, alternando de página en cada grabación, de
+ ** modo que el desgaste se reparte en partes iguales y ninguna página se reescribe en cada cambio. Al crear el
+ ** almacenamiento se recorren todos los registros y se restauran los datos del más reciente con el CRC correcto, por
+ ** lo que una grabación interrumpida por un corte de energía solo pierde ese último cambio.
+ **
+ ** Los cambios se aplican en RAM y se graban recién cuando pasa un tiempo sin cambios, así una ráfaga de ediciones
+ ** desde las teclas cuesta una única programación. La programación de la página avanza en segundo plano y el
+ ** procesador no espera a que termine.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/** @brief Cantidad máxima de bytes de datos de un almacenamiento, fijada por el tamaño de cada registro */
+#define SETTINGS_MAX_SIZE 8
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Puntero a una instancia de un almacenamiento de ajustes
+ */
+typedef struct settings_s * settings_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea un almacenamiento de ajustes y restaura los datos guardados.
+ *
+ * Recorre los registros de las páginas asignadas y se queda con el más reciente que tenga el CRC correcto. Si ese
+ * registro tiene la misma versión y el mismo tamaño, sus datos quedan disponibles con SettingsLoad(). Las próximas
+ * grabaciones continúan a partir de él.
+ *
+ * @param firstPage  Primera página de la EEPROM asignada al almacenamiento.
+ * @param pages      Cantidad de páginas consecutivas asignadas. Cada página guarda ocho registros.
+ * @param version    Versión del formato de los datos. Los registros de otra versión no se restauran.
+ * @param size       Cantidad de bytes de datos, como máximo `SETTINGS_MAX_SIZE`.
+ * @return settings_t  Puntero a la instancia del almacenamiento creado, o `NULL` si los parámetros no son válidos o
+ *                     se agotó la reserva de `SETTINGS_POOL_SIZE` instancias.
+ */
+settings_t SettingsCreate(uint8_t firstPage, uint8_t pages, uint8_t version, uint8_t size);
+
+/**
+ * @brief Obtiene los datos del almacenamiento.
+ *
+ * @param settings  Puntero a la instancia del almacenamiento, obtenida mediante SettingsCreate().
+ * @param data      Arreglo donde se copian los datos, del tamaño indicado al crear el almacenamiento.
+ * @return `true` si se copiaron datos restaurados o guardados después; `false` si el almacenamiento no tiene datos, en
+ *         cuyo caso `data` no se modifica y la aplicación conserva sus valores iniciales.
+ */
+bool SettingsLoad(settings_t settings, void * data);
+
+/**
+ * @brief Guarda nuevos datos en el almacenamiento.
+ *
+ * Si los datos son iguales a los guardados no hace nada. En caso contrario los copia en RAM y la grabación queda
+ * pendiente hasta que pasen `SETTINGS_WRITE_DELAY` llamadas a SettingsService() sin nuevos cambios.
+ *
+ * @param settings  Puntero a la instancia del almacenamiento, obtenida mediante SettingsCreate().
+ * @param data      Datos a guardar, del tamaño indicado al crear el almacenamiento.
+ */
+void SettingsSave(settings_t settings, const void * data);
+
+/**
+ * @brief Atiende las grabaciones pendientes del almacenamiento.
+ *
+ * Termina la programación en curso si la EEPROM ya la completó y, cuando vence la espera de una grabación pendiente,
+ * escribe el nuevo registro e inicia su programación sin esperar a que termine. Debe llamarse en forma periódica, por
+ * ejemplo desde una tarea del planificador.
+ *
+ * @param settings  Puntero a la instancia del almacenamiento, obtenida mediante SettingsCreate().
+ */
+void SettingsService(settings_t settings);
+
+/**
+ * @brief Indica si el almacenamiento tiene cambios que todavía no terminaron de grabarse.
+ *
+ * @param settings  Puntero a la instancia del almacenamiento, obtenida mediante SettingsCreate().
+ * @return `true` si hay una grabación pendiente o una programación en curso; `false` en caso contrario.
+ */
+bool SettingsIsPending(settings_t settings);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SETTINGS_H_ */
@@ -0,0 +1,130 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef SOFTTIMER_H_
+#define SOFTTIMER_H_
+
+/** @file softtimer.h
+ ** @brief Temporizadores de software de un disparo y periódicos sobre una rueda de tiempos jerárquica.
+ **
+ ** Cada temporizador armado se guarda en una ranura de una de varias ruedas. La primera rueda tiene una ranura por
+ ** tick y cada una de las siguientes cubre con cada ranura una vuelta completa de la anterior. Armar o detener un
+ ** temporizador es insertarlo o quitarlo de una lista, y cada tick solo recorre la ranura que vence, de modo que el
+ ** costo no depende de cuántos temporizadores estén armados. Cuando una rueda completa su vuelta, los temporizadores
+ ** de la ranura siguiente de la rueda superior se redistribuyen en las inferiores.
+ **
+ ** El servicio no usa ningún periférico: avanza un tick en cada llamada a SoftTimerTick(), que la aplicación hace
+ ** desde una tarea periódica, y en las pruebas se puede avanzar en tiempo virtual.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Puntero a una instancia de un temporizador de software
+ */
+typedef struct soft_timer_s * soft_timer_t;
+
+/**
+ * @brief Función que se ejecuta al vencer un temporizador.
+ *
+ * Puede armar o detener cualquier temporizador, incluido el que venció.
+ *
+ * @param timer   Temporizador que venció.
+ * @param object  Objeto indicado al crear el temporizador.
+ */
+typedef void (*soft_timer_callback_t)(soft_timer_t timer, void * object);
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea un temporizador de software detenido.
+ *
+ * @param callback  Función que se ejecuta cada vez que vence el temporizador.
+ * @param object    Puntero que se entrega a la función.
+ * @return soft_timer_t  Puntero a la instancia del temporizador creado, o `NULL` si la función no es válida o se agotó
+ *                       la reserva de `SOFT_TIMER_POOL_SIZE` instancias.
+ */
+soft_timer_t SoftTimerCreate(soft_timer_callback_t callback, void * object);
+
+/**
+ * @brief Arma un temporizador.
+ *
+ * Si el temporizador ya estaba armado se descarta el vencimiento anterior.
+ *
+ * @param timer   Puntero a la instancia del temporizador, obtenida mediante SoftTimerCreate().
+ * @param delay   Ticks hasta el primer vencimiento, mayor que cero.
+ * @param period  Ticks entre vencimientos sucesivos, o cero para un temporizador de un disparo.
+ * @return `true` si el temporizador quedó armado; `false` si la demora no es válida.
+ */
+bool SoftTimerStart(soft_timer_t timer, uint32_t delay, uint32_t period);
+
+/**
+ * @brief Detiene un temporizador sin ejecutar su función. No tiene efecto si ya estaba detenido.
+ *
+ * @param timer  Puntero a la instancia del temporizador, obtenida mediante SoftTimerCreate().
+ */
+void SoftTimerStop(soft_timer_t timer);
+
+/**
+ * @brief Indica si un temporizador está armado.
+ *
+ * @param timer  Puntero a la instancia del temporizador, obtenida mediante SoftTimerCreate().
+ * @return `true` si el temporizador está armado; `false` si está detenido o fue de un disparo y ya venció.
+ */
+bool SoftTimerIsRunning(soft_timer_t timer);
+
+/**
+ * @brief Devuelve los ticks que faltan para el próximo vencimiento de un temporizador.
+ *
+ * @param timer  Puntero a la instancia del temporizador, obtenida mediante SoftTimerCreate().
+ * @return Ticks hasta el vencimiento, contando el tick en que vence, o cero si el temporizador está detenido.
+ */
+uint32_t SoftTimerGetRemaining(soft_timer_t timer);
+
+/**
+ * @brief Avanza un tick el servicio de temporizadores y ejecuta las funciones de los que vencen.
+ *
+ * Debe llamarse siempre con el mismo período, que fija la unidad de las demoras y los períodos de los temporizadores.
+ */
+void SoftTimerTick(void);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SOFTTIMER_H_ */
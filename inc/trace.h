@@ -0,0 +1,219 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+/** @file trace.h
+ ** @brief Registro binario de eventos con vaciado en segundo plano por UART.
+ **
+ ** Cada evento ocupa un registro de tamaño fijo con la marca de tiempo del contador de ciclos del DWT, el tipo de
+ ** evento y un argumento de 16 bits. Los registros se escriben sin bloqueos en un buffer circular en RAM, tanto desde
+ ** el programa principal como desde las interrupciones, y la interrupción del UART los envía codificados con la
+ ** diferencia de tiempo respecto del anterior. La herramienta `tracedump` del backend simulado decodifica el flujo
+ ** en una línea de tiempo. La macro TRACE() desaparece por completo cuando `TRACE_ENABLED` vale cero.
+ **
+ ** Cada evento se transmite como una trama COBS terminada en cero, de modo que el decodificador se sincroniza aunque
+ ** empiece a leer a mitad del flujo. El contenido de la trama es el tipo de evento, el argumento en little endian y la
+ ** diferencia de tiempo en ciclos en formato LEB128 con signo en zigzag, que es negativa cuando una interrupción
+ ** registra un evento entre la lectura del contador y la reserva del registro de otro.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/**
+ * @brief Tabla de eventos: X(identificador, nombre, formato del argumento).
+ *
+ * El formato es `TRACE_ARG_PIN` para los eventos cuyo argumento es un pin armado con TRACE_PIN(), y
+ * `TRACE_ARG_NUMBER` para el resto. El orden de la tabla fija el código de cada evento en el flujo.
+ */
+#define TRACE_EVENTS(X)                                                                                                \
+    X(TRACE_START, "start", TRACE_ARG_NUMBER)                                                                          \
+    X(TRACE_LOST, "lost", TRACE_ARG_NUMBER)                                                                            \
+    X(TRACE_OUTPUT_ACTIVATE, "output-on", TRACE_ARG_PIN)                                                               \
+    X(TRACE_OUTPUT_DEACTIVATE, "output-off", TRACE_ARG_PIN)                                                            \
+    X(TRACE_OUTPUT_TOGGLE, "output-toggle", TRACE_ARG_PIN)                                                             \
+    X(TRACE_INPUT_ACTIVATED, "input-on", TRACE_ARG_PIN)                                                                \
+    X(TRACE_INPUT_DEACTIVATED, "input-off", TRACE_ARG_PIN)                                                             \
+    X(TRACE_TASK_BEGIN, "task-begin", TRACE_ARG_NUMBER)                                                                \
+    X(TRACE_TASK_END, "task-end", TRACE_ARG_NUMBER)                                                                    \
+    X(TRACE_IDLE_ENTER, "idle-enter", TRACE_ARG_NUMBER)                                                                \
+    X(TRACE_IDLE_EXIT, "idle-exit", TRACE_ARG_NUMBER)                                                                  \
+    X(TRACE_BOOT_PHASE, "boot-phase", TRACE_ARG_NUMBER)                                                                \
+    X(TRACE_USER, "user", TRACE_ARG_NUMBER)
+
+/** @brief Genera el valor de la enumeración de un evento de la tabla TRACE_EVENTS */
+#define TRACE_EVENT_ENUM(id, name, format) id,
+
+/** @brief Arma el argumento de un evento de pin con el puerto GPIO en el byte alto y el bit en el bajo */
+#define TRACE_PIN(gpio, bit) ((uint16_t)(((gpio) << 8) | (bit)))
+
+/** @brief Puerto con el que se registran las salidas de un expansor, cuyo bit es el número de salida en la cadena */
+#define TRACE_EXPANDER_GPIO 0xFF
+
+/** @brief Longitud máxima de una trama en el flujo, incluido el cero final */
+#define TRACE_FRAME_SIZE 12
+
+#if TRACE_ENABLED
+
+/** @brief Registra un evento en el buffer de trazas */
+#define TRACE(event, arg) TraceRecord((event), (arg))
+
+/** @brief Configura el UART de las trazas y registra el evento de inicio */
+#define TRACE_START() TraceStart(TRACE_BAUDRATE)
+
+/** @brief Despierta el vaciado del buffer de trazas si tiene registros pendientes */
+#define TRACE_FLUSH() TraceFlush()
+
+#else
+
+#define TRACE(event, arg)
+#define TRACE_START()
+#define TRACE_FLUSH()
+
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Tipos de evento de las trazas, generados a partir de la tabla TRACE_EVENTS.
+ */
+typedef enum trace_event_e {
+    TRACE_EVENTS(TRACE_EVENT_ENUM) TRACE_EVENT_COUNT, /**< Cantidad de tipos de evento. */
+} trace_event_t;
+
+/**
+ * @brief Formatos del argumento de un evento, usados por el decodificador.
+ */
+typedef enum trace_arg_e {
+    TRACE_ARG_NUMBER, /**< Número sin signo. */
+    TRACE_ARG_PIN,    /**< Pin armado con TRACE_PIN(). */
+} trace_arg_t;
+
+/**
+ * @brief Estadísticas del buffer de trazas.
+ */
+typedef struct trace_stats_s {
+    uint32_t recorded; /**< Eventos registrados desde el inicio. */
+    uint32_t sent;     /**< Eventos enviados por el UART. */
+    uint32_t lost;     /**< Eventos sobrescritos antes de enviarse. */
+} trace_stats_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Configura el UART de las trazas y registra el evento de inicio.
+ *
+ * Habilita el contador de ciclos del DWT, que da las marcas de tiempo, y configura el UART con formato 8N1. El
+ * argumento del evento de inicio es la frecuencia del reloj del núcleo en MHz, con la que el decodificador convierte
+ * los ciclos en tiempo.
+ *
+ * @param baudrate  Velocidad del UART en baudios.
+ * @return `true` si el UART quedó configurado; `false` si la velocidad no es válida.
+ */
+bool TraceStart(uint32_t baudrate);
+
+/**
+ * @brief Registra un evento en el buffer de trazas.
+ *
+ * Puede llamarse desde cualquier contexto, incluidas las interrupciones anidadas: la posición del registro se reserva
+ * con un incremento atómico y el registro se publica al escribir su último campo. Si el buffer está lleno se
+ * sobrescribe el registro más antiguo, que se informa como perdido.
+ *
+ * @param event  Tipo de evento.
+ * @param arg    Argumento del evento.
+ */
+void TraceRecord(trace_event_t event, uint16_t arg);
+
+/**
+ * @brief Despierta el vaciado del buffer de trazas si tiene registros pendientes.
+ *
+ * Habilita la interrupción por FIFO de transmisión vacía del UART, cuya rutina de servicio envía registros hasta
+ * vaciar el buffer y vuelve a deshabilitarla. Conviene llamarla antes de dormir al núcleo.
+ */
+void TraceFlush(void);
+
+/**
+ * @brief Obtiene las estadísticas del buffer de trazas.
+ *
+ * @param stats  Estructura donde se copian las estadísticas.
+ */
+void TraceGetStats(trace_stats_t * stats);
+
+/**
+ * @brief Arma la trama de un evento tal como se transmite por el UART.
+ *
+ * @param frame  Arreglo de al menos `TRACE_FRAME_SIZE` bytes donde se escribe la trama.
+ * @param event  Tipo de evento.
+ * @param arg    Argumento del evento.
+ * @param delta  Ciclos transcurridos desde el evento anterior.
+ * @return Longitud de la trama, incluido el cero final.
+ */
+uint8_t TraceEncode(uint8_t frame[], trace_event_t event, uint16_t arg, int32_t delta);
+
+/**
+ * @brief Decodifica una trama recibida, sin el cero final.
+ *
+ * @param frame   Bytes de la trama.
+ * @param length  Cantidad de bytes.
+ * @param event   Variable donde se guarda el tipo de evento.
+ * @param arg     Variable donde se guarda el argumento.
+ * @param delta   Variable donde se guardan los ciclos transcurridos desde el evento anterior.
+ * @return `true` si la trama es válida; `false` en caso contrario.
+ */
+bool TraceDecode(const uint8_t frame[], uint8_t length, trace_event_t * event, uint16_t * arg, int32_t * delta);
+
+/**
+ * @brief Devuelve el nombre de un tipo de evento.
+ *
+ * @param event  Tipo de evento.
+ * @return Nombre del evento, o `NULL` si no es un tipo válido.
+ */
+const char * TraceEventName(trace_event_t event);
+
+/**
+ * @brief Devuelve el formato del argumento de un tipo de evento.
+ *
+ * @param event  Tipo de evento.
+ * @return Formato del argumento.
+ */
+trace_arg_t TraceEventFormat(trace_event_t event);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACE_H_ */
@@ -27,56 +27,139 @@ SPDX-License-Identifier: MIT
 
 /* === Headers files inclusions ==================================================================================== */
 
+#include "config.h"
 #include "bsp.h"
 #include "digital.h"
+#include "display.h"
 #include "chip.h"
 #include "edu-ciaa.h"
-#include <stdlib.h>
+#include <stdbool.h>
 
 /* === Macros definitions ========================================================================================== */
 
+/** @brief Genera la configuración del SCU de una salida de la tabla BOARD_OUTPUTS */
+#define OUTPUT_PINMUX(name, field, port, pin, func, gpio, bit) {port, pin, BOARD_OUTPUT_MODE | func},
+
+/** @brief Genera la configuración del SCU de una tecla de la tabla BOARD_INPUTS */
+#define INPUT_PINMUX(name, field, port, pin, func, gpio, bit) {port, pin, BOARD_INPUT_MODE | func},
+
+/** @brief Genera la configuración del SCU de un dígito o de un segmento de la pantalla */
+#define DISPLAY_PINMUX(name, port, pin, func, gpio, bit) {port, pin, BOARD_OUTPUT_MODE | func},
+
+/** @brief Genera la configuración del SCU de un pin asignado a un periférico */
+#define FUNCTION_PINMUX(name, port, pin, mode) {port, pin, mode},
+
+/** @brief Genera la ubicación del pin GPIO de una fila de la tabla BOARD_OUTPUTS o BOARD_INPUTS */
+#define FIELD_LOCATION(name, field, port, pin, func, gpio, bit) {gpio, bit},
+
+/** @brief Genera la ubicación del pin GPIO de un dígito o de un segmento de la pantalla */
+#define DISPLAY_LOCATION(name, port, pin, func, gpio, bit) {gpio, bit},
+
+/** @brief Asigna al campo de una fila de la tabla BOARD_OUTPUTS la siguiente salida creada */
+#define OUTPUT_ASSIGN(name, field, port, pin, func, gpio, bit) self->field = outputs[index++];
+
+/** @brief Asigna al campo de una fila de la tabla BOARD_INPUTS la siguiente entrada creada */
+#define INPUT_ASSIGN(name, field, port, pin, func, gpio, bit) self->field = keys[index++];
+
+/** @brief Cuenta una fila de cualquiera de las tablas de pines */
+#define PIN_COUNT(...) +1
+
+/** @brief Cantidad de LEDs, que ocupan las primeras posiciones de BOARD_OUTPUT_PINS */
+#define BOARD_LED_COUNT (0 BOARD_OUTPUTS(PIN_COUNT))
+
+/** @brief Cantidad de dígitos de la pantalla, que siguen a los LEDs en BOARD_OUTPUT_PINS */
+#define BOARD_DIGIT_COUNT (0 BOARD_DIGITS(PIN_COUNT))
+
+/** @brief Cantidad de elementos de un arreglo */
+#define ARRAY_SIZE(array) (sizeof(array) / sizeof((array)[0]))
+
 /* === Private data type declarations ============================================================================== */
 
 /* === Private function declarations =============================================================================== */
 
+/**
+ * @brief Configura los pines de la placa y crea sus salidas, sus teclas y la pantalla.
+ *
+ * @param self  Puntero a la estructura de la placa.
+ * @return `true` si se crearon todos los objetos; `false` si se agotó alguna de las reservas estáticas.
+ */
+static bool BoardSetup(struct board_s * self);
+
 /* === Private variable definitions ================================================================================ */
 
-/* === Public variable definitions ================================================================================= */
+/** @brief Configuración del SCU de todos los pines de la placa, generada a partir de las tablas de edu-ciaa.h */
+static const PINMUX_GRP_T BOARD_PINMUX[] = {
+    BOARD_OUTPUTS(OUTPUT_PINMUX)      /* LEDs */
+    BOARD_INPUTS(INPUT_PINMUX)        /* Teclas */
+    BOARD_DIGITS(DISPLAY_PINMUX)      /* Dígitos de la pantalla */
+    BOARD_SEGMENTS(DISPLAY_PINMUX)    /* Segmentos de la pantalla */
+    BOARD_FUNCTIONS(FUNCTION_PINMUX)  /* Periféricos */
+};
 
-/* === Private function definitions ================================================================================ */
+/** @brief Pines GPIO de todas las salidas de la placa: LEDs, dígitos y segmentos, en ese orden */
+static const digital_pin_location_t BOARD_OUTPUT_PINS[] = {
+    BOARD_OUTPUTS(FIELD_LOCATION)    /* LEDs */
+    BOARD_DIGITS(DISPLAY_LOCATION)   /* Dígitos de la pantalla */
+    BOARD_SEGMENTS(DISPLAY_LOCATION) /* Segmentos de la pantalla */
+};
 
-/* === Public function implementation ============================================================================== */
+/** @brief Pines GPIO de las teclas de la placa */
+static const digital_pin_location_t BOARD_INPUT_PINS[] = {BOARD_INPUTS(FIELD_LOCATION)};
 
-board_t BoardCreate(void) {
-    struct board_s * self = malloc(sizeof(struct board_s));
+/** @brief Única instancia de la placa, reservada en forma estática */
+static struct board_s boardPool[1];
 
-    if (self != NULL) {
-        Chip_SCU_PinMuxSet(LED_2_PORT, LED_2_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | LED_2_FUNC);
-        self->led_red = DigitalOutputCreate(LED_2_GPIO, LED_2_BIT);
+/** @brief Indica si la instancia de la placa ya fue inicializada */
+static bool boardCreated;
 
-        Chip_SCU_PinMuxSet(LED_3_PORT, LED_3_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | LED_3_FUNC);
-        self->led_green = DigitalOutputCreate(LED_3_GPIO, LED_3_BIT);
+/** @brief Resultado de la inicialización de la placa, que devuelven todas las llamadas a BoardCreate() */
+static board_t board;
 
-        Chip_SCU_PinMuxSet(LED_B_PORT, LED_B_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | LED_B_FUNC);
-        self->led_blue = DigitalOutputCreate(LED_B_GPIO, LED_B_BIT);
+_Static_assert(ARRAY_SIZE(BOARD_OUTPUT_PINS) <= DIGITAL_OUTPUT_POOL_SIZE,
+               "DIGITAL_OUTPUT_POOL_SIZE no alcanza para las salidas de la placa");
+_Static_assert(ARRAY_SIZE(BOARD_INPUT_PINS) <= DIGITAL_INPUT_POOL_SIZE,
+               "DIGITAL_INPUT_POOL_SIZE no alcanza para las teclas de la placa");
 
-        Chip_SCU_PinMuxSet(LED_1_PORT, LED_1_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | LED_1_FUNC);
-        self->led_yellow = DigitalOutputCreate(LED_1_GPIO, LED_1_BIT);
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
 
-        Chip_SCU_PinMuxSet(TEC_1_PORT, TEC_1_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | TEC_1_FUNC);
-        self->tec_1 = DigitalInputCreate(TEC_1_GPIO, TEC_1_BIT, true);
+static bool BoardSetup(struct board_s * self) {
+    digital_output_t outputs[ARRAY_SIZE(BOARD_OUTPUT_PINS)];
+    digital_input_t keys[ARRAY_SIZE(BOARD_INPUT_PINS)];
+    uint8_t index;
 
-        Chip_SCU_PinMuxSet(TEC_2_PORT, TEC_2_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | TEC_2_FUNC);
-        self->tec_2 = DigitalInputCreate(TEC_2_GPIO, TEC_2_BIT, true);
+    /* Un recorrido de la tabla del SCU y un acceso a DIR por puerto para las salidas y otro para las teclas */
+    Chip_SCU_SetPinMuxing(BOARD_PINMUX, ARRAY_SIZE(BOARD_PINMUX));
+    if (!DigitalOutputCreateMany(BOARD_OUTPUT_PINS, ARRAY_SIZE(BOARD_OUTPUT_PINS), outputs) ||
+        !DigitalInputCreateMany(BOARD_INPUT_PINS, ARRAY_SIZE(BOARD_INPUT_PINS), true, keys)) {
+        return false;
+    }
 
-        Chip_SCU_PinMuxSet(TEC_3_PORT, TEC_3_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | TEC_3_FUNC);
-        self->tec_3 = DigitalInputCreate(TEC_3_GPIO, TEC_3_BIT, true);
+    index = 0;
+    BOARD_OUTPUTS(OUTPUT_ASSIGN)
+    index = 0;
+    BOARD_INPUTS(INPUT_ASSIGN)
 
-        Chip_SCU_PinMuxSet(TEC_4_PORT, TEC_4_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_PULLUP | TEC_4_FUNC);
-        self->tec_4 = DigitalInputCreate(TEC_4_GPIO, TEC_4_BIT, true);
+    self->keys = DigitalInputBankCreate(keys, ARRAY_SIZE(keys));
+    if ((self->keys == NULL) || !DigitalInputBankSetDebounce(self->keys, BOARD_KEYS_DEBOUNCE_SAMPLES)) {
+        return false;
+    }
+
+    self->display = DisplayCreate(&outputs[BOARD_LED_COUNT], BOARD_DIGIT_COUNT,
+                                  &outputs[BOARD_LED_COUNT + BOARD_DIGIT_COUNT]);
+    return self->display != NULL;
+}
+
+/* === Public function implementation ============================================================================== */
+
+board_t BoardCreate(void) {
+    if (!boardCreated) {
+        boardCreated = true;
+        board = BoardSetup(&boardPool[0]) ? &boardPool[0] : NULL;
     }
 
-    return self;
+    return board;
 }
 
 /* === End of documentation ======================================================================================== */
\ No newline at end of file
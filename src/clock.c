@@ -0,0 +1,216 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file clock.c
+ ** @brief Código fuente del módulo de reloj con hora y alarma en BCD empaquetado
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include "clock.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Estructura que representa un reloj.
+ */
+struct clock_s {
+    uint16_t ticks;      /**< Ticks que equivalen a un segundo. */
+    uint16_t count;      /**< Ticks transcurridos en el segundo en curso. */
+    bool valid;          /**< Indica si la hora fue configurada. */
+    bool alarmEnabled;   /**< Indica si la alarma está habilitada. */
+    bool ringing;        /**< Indica si la alarma está sonando. */
+    clock_time_t time;   /**< Hora actual. */
+    clock_time_t alarm;  /**< Hora de la alarma. */
+    clock_time_t target; /**< Hora en que vuelve a sonar la alarma: la de la alarma o la de una posposición. */
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Verifica que una hora sea un valor BCD válido.
+ *
+ * @param time  Hora a verificar.
+ * @return `true` si todos los dígitos están en rango; `false` en caso contrario.
+ */
+static bool TimeIsValid(const clock_time_t * time);
+
+/**
+ * @brief Propaga el acarreo desde las unidades de minutos hacia las horas.
+ *
+ * @param bcd  Hora con las unidades de minutos recién incrementadas.
+ * @return Hora normalizada.
+ */
+static uint32_t CarryMinutes(uint32_t bcd);
+
+/**
+ * @brief Avanza una hora en un segundo.
+ *
+ * @param bcd  Hora a avanzar.
+ * @return Hora avanzada.
+ */
+static uint32_t AdvanceSecond(uint32_t bcd);
+
+/* === Private variable definitions ================================================================================ */
+
+/** @brief Reserva estática para las instancias de relojes */
+static struct clock_s clockPool[CLOCK_POOL_SIZE];
+
+/** @brief Cantidad de relojes asignados de la reserva */
+static uint8_t clocksUsed;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static bool TimeIsValid(const clock_time_t * time) {
+    uint32_t bcd = time->bcd;
+
+    return ((bcd & 0xFF000000) == 0) && ((bcd & 0x00000F) <= 0x000009) && ((bcd & 0x0000F0) <= 0x000050) &&
+           ((bcd & 0x000F00) <= 0x000900) && ((bcd & 0x00F000) <= 0x005000) && ((bcd & 0x0F0000) <= 0x090000) &&
+           ((bcd & 0xFF0000) <= 0x230000);
+}
+
+static uint32_t CarryMinutes(uint32_t bcd) {
+    if ((bcd & 0x000F00) == 0x000A00) {
+        bcd += 0x000600;
+        if ((bcd & 0x00F000) == 0x006000) {
+            bcd += 0x00A000;
+            if ((bcd & 0x0F0000) == 0x0A0000) {
+                bcd += 0x060000;
+            }
+            if ((bcd & 0xFF0000) == 0x240000) {
+                bcd &= 0x00FFFF;
+            }
+        }
+    }
+    return bcd;
+}
+
+static uint32_t AdvanceSecond(uint32_t bcd) {
+    bcd += 0x000001;
+    /* Caso común: solo cambian las unidades de segundos */
+    if ((bcd & 0x00000F) == 0x00000A) {
+        bcd += 0x000006;
+        if ((bcd & 0x0000F0) == 0x000060) {
+            bcd = CarryMinutes(bcd + 0x0000A0);
+        }
+    }
+    return bcd;
+}
+
+/* === Public function implementation ============================================================================== */
+
+clk_t ClockCreate(uint16_t ticks) {
+    clk_t self = NULL;
+
+    if ((ticks != 0) && (clocksUsed < CLOCK_POOL_SIZE)) {
+        self = &clockPool[clocksUsed++];
+        self->ticks = ticks;
+        self->count = 0;
+        self->valid = false;
+        self->alarmEnabled = false;
+        self->ringing = false;
+        self->time.bcd = 0;
+        self->alarm.bcd = 0;
+        self->target.bcd = 0;
+    }
+    return self;
+}
+
+bool ClockGetTime(clk_t self, clock_time_t * time) {
+    *time = self->time;
+    return self->valid;
+}
+
+bool ClockSetTime(clk_t self, const clock_time_t * time) {
+    if (!TimeIsValid(time)) {
+        return false;
+    }
+    self->time = *time;
+    self->count = 0;
+    self->valid = true;
+    return true;
+}
+
+void ClockTick(clk_t self) {
+    if (++self->count < self->ticks) {
+        return;
+    }
+    self->count = 0;
+    self->time.bcd = AdvanceSecond(self->time.bcd);
+
+    /* Sin hora configurada la cuenta arranca en 00:00:00 y no corresponde a la hora real, así que no hace sonar la
+     * alarma */
+    if (self->valid && self->alarmEnabled && (self->time.bcd == self->target.bcd)) {
+        self->ringing = true;
+        self->target = self->alarm;
+    }
+}
+
+bool ClockSetAlarm(clk_t self, const clock_time_t * alarm) {
+    if (!TimeIsValid(alarm)) {
+        return false;
+    }
+    self->alarm = *alarm;
+    self->target = *alarm;
+    self->alarmEnabled = true;
+    self->ringing = false;
+    return true;
+}
+
+bool ClockGetAlarm(clk_t self, clock_time_t * alarm) {
+    *alarm = self->alarm;
+    return self->alarmEnabled;
+}
+
+void ClockEnableAlarm(clk_t self, bool enabled) {
+    self->alarmEnabled = enabled;
+    self->ringing = false;
+    self->target = self->alarm;
+}
+
+bool ClockIsAlarmRinging(clk_t self) {
+    return self->ringing;
+}
+
+bool ClockSnooze(clk_t self, uint8_t minutes) {
+    if (!self->ringing || (minutes == 0) || (minutes > 59)) {
+        return false;
+    }
+
+    self->target = self->time;
+    for (uint8_t index = 0; index < minutes; index++) {
+        self->target.bcd = CarryMinutes(self->target.bcd + 0x000100);
+    }
+    self->ringing = false;
+    return true;
+}
+
+void ClockStopAlarm(clk_t self) {
+    self->ringing = false;
+    self->target = self->alarm;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,392 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file console.c
+ ** @brief Código fuente de la consola de comandos con recepción y transmisión por DMA
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include "console.h"
+#include "dma.h"
+#include "chipreg.h"
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdio.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief UART de la consola, conectado al adaptador USB de depuración de la placa */
+#define CONSOLE_UART LPC_USART2
+
+/** @brief Conexión del controlador de DMA con la FIFO de transmisión del UART */
+#define CONSOLE_DMA_TX GPDMA_CONN_UART2_Tx
+
+/** @brief Conexión del controlador de DMA con la FIFO de recepción del UART */
+#define CONSOLE_DMA_RX GPDMA_CONN_UART2_Rx
+
+/** @brief Mayor cantidad de bytes de una transferencia de DMA, limitada por el campo de CONTROL */
+#define CONSOLE_DMA_MAX 0xFFF
+
+/** @brief Largo máximo de una línea recibida. El resto del buffer es el margen para lo que llega entre atenciones */
+#define CONSOLE_LINE_MAX (CONSOLE_RX_SIZE / 2)
+
+/** @brief Posición en el buffer de recepción de un índice que avanza sin dar la vuelta */
+#define RX_INDEX(index) ((index) & (CONSOLE_RX_SIZE - 1))
+
+/** @brief Posición en la cola de transmisión de un índice que avanza sin dar la vuelta */
+#define TX_INDEX(index) ((index) & (CONSOLE_TX_SIZE - 1))
+
+#if ((CONSOLE_RX_SIZE & (CONSOLE_RX_SIZE - 1)) != 0) || ((CONSOLE_TX_SIZE & (CONSOLE_TX_SIZE - 1)) != 0)
+#error "CONSOLE_RX_SIZE y CONSOLE_TX_SIZE deben ser potencias de dos"
+#endif
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Línea recibida, con la posición y el largo de cada palabra en el buffer de recepción.
+ */
+struct console_line_s {
+    const uint8_t * buffer;            /**< Buffer de recepción en el que están las palabras. */
+    uint16_t start[CONSOLE_MAX_ARGS];  /**< Posición del primer carácter de cada palabra en el buffer. */
+    uint8_t length[CONSOLE_MAX_ARGS];  /**< Cantidad de caracteres de cada palabra. */
+    uint8_t count;                     /**< Cantidad de palabras. */
+};
+
+/**
+ * @brief Estructura que representa la consola.
+ *
+ * Los índices de recepción y de transmisión avanzan sin dar la vuelta y solo se reducen al tamaño de cada buffer al
+ * acceder, así la diferencia entre dos de ellos es siempre la cantidad de bytes que los separa.
+ */
+struct console_s {
+    const console_command_t * commands;     /**< Tabla de comandos. */
+    uint8_t count;                          /**< Cantidad de comandos de la tabla. */
+    void * object;                          /**< Objeto que reciben las funciones de los comandos. */
+    uint8_t receiver;                       /**< Canal de DMA que llena el buffer de recepción. */
+    uint8_t transmitter;                    /**< Canal de DMA de la transmisión en curso. */
+    volatile bool transmitting;             /**< Hay una transferencia de DMA de transmisión en curso. */
+    bool discarding;                        /**< La línea en curso superó el largo máximo y se descarta. */
+    uint16_t sending;                       /**< Bytes de la transferencia de transmisión en curso. */
+    uint32_t scanned;                       /**< Índice del próximo byte recibido a examinar. */
+    uint32_t lineStart;                     /**< Índice del primer byte de la línea en curso. */
+    uint32_t head;                          /**< Índice del próximo byte a agregar en la cola de transmisión. */
+    volatile uint32_t tail;                 /**< Índice del primer byte de la cola que todavía no se transmitió. */
+    console_stats_t stats;                  /**< Contadores. */
+    DMA_TransferDescriptor_t receiveList;   /**< Elemento que se apunta a sí mismo para recibir en círculo. */
+    DMA_TransferDescriptor_t transmitList;  /**< Elemento de la transferencia de transmisión en curso. */
+    uint8_t received[CONSOLE_RX_SIZE];      /**< Buffer circular que llena el DMA con los bytes recibidos. */
+    uint8_t transmit[CONSOLE_TX_SIZE];      /**< Cola circular de bytes a transmitir, que lee el DMA. */
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Calcula el índice del byte que el DMA va a escribir a continuación en el buffer de recepción.
+ *
+ * @param self  Puntero a la consola.
+ * @return Índice que avanza sin dar la vuelta, a partir del último byte examinado.
+ */
+static uint32_t ConsoleReceived(const struct console_s * self);
+
+/**
+ * @brief Divide una línea en palabras y ejecuta el comando que indica la primera.
+ *
+ * @param self   Puntero a la consola.
+ * @param start  Índice del primer byte de la línea.
+ * @param end    Índice del byte que termina la línea.
+ */
+static void ConsoleExecute(struct console_s * self, uint32_t start, uint32_t end);
+
+/**
+ * @brief Lista los comandos de la tabla con sus descripciones.
+ *
+ * @param self  Puntero a la consola.
+ */
+static void ConsoleHelp(struct console_s * self);
+
+/**
+ * @brief Agrega un byte a la cola de transmisión.
+ *
+ * @param self  Puntero a la consola.
+ * @param data  Byte a agregar.
+ * @return `true` si había lugar; `false` si se descartó.
+ */
+static bool ConsolePut(struct console_s * self, uint8_t data);
+
+/**
+ * @brief Comienza una transferencia con el tramo contiguo pendiente de la cola, si no hay otra en curso.
+ *
+ * Si no hay un canal de DMA libre, la transmisión queda pendiente hasta la próxima llamada.
+ *
+ * @param self  Puntero a la consola.
+ */
+static void ConsoleTransmit(struct console_s * self);
+
+/**
+ * @brief Libera el canal de la transferencia de transmisión que terminó y descarta de la cola los bytes enviados.
+ *
+ * Se ejecuta desde la interrupción del DMA. Si la transferencia terminó con un error, el mismo tramo se vuelve a
+ * transmitir en la próxima.
+ *
+ * @param channel    Canal de DMA de la transmisión.
+ * @param completed  `true` si la transferencia terminó; `false` si hubo un error.
+ * @param object     Puntero a la consola.
+ */
+static void ConsoleTransmitted(uint8_t channel, bool completed, void * object);
+
+/* === Private variable definitions ================================================================================ */
+
+/** @brief Única instancia de la consola, que ocupa el UART del adaptador USB */
+static struct console_s instance;
+
+/** @brief La consola ya se creó */
+static bool created;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t ConsoleReceived(const struct console_s * self) {
+    uint32_t address = CHIP_REG_READ(&LPC_GPDMA->CH[self->receiver].DESTADDR);
+
+    /* Justo al terminar una vuelta la dirección apunta al final del buffer, que equivale al principio */
+    return self->scanned + RX_INDEX(address - (uint32_t)(uintptr_t)self->received - self->scanned);
+}
+
+static void ConsoleExecute(struct console_s * self, uint32_t start, uint32_t end) {
+    console_line_t line = {.buffer = self->received};
+    bool inside = false;
+
+    for (uint32_t index = start; index < end; index++) {
+        uint8_t data = self->received[RX_INDEX(index)];
+
+        if ((data == ' ') || (data == '\t')) {
+            inside = false;
+        } else if (inside) {
+            line.length[line.count - 1]++;
+        } else if (line.count < CONSOLE_MAX_ARGS) {
+            line.start[line.count] = RX_INDEX(index);
+            line.length[line.count] = 1;
+            line.count++;
+            inside = true;
+        } else {
+            ConsoleWrite(self, "error: demasiadas palabras\n");
+            return;
+        }
+    }
+    if (line.count == 0) {
+        return;
+    }
+
+    self->stats.lines++;
+    if (ConsoleArgIs(&line, 0, "ayuda")) {
+        ConsoleHelp(self);
+        return;
+    }
+    for (uint8_t command = 0; command < self->count; command++) {
+        if (ConsoleArgIs(&line, 0, self->commands[command].name)) {
+            self->commands[command].handler(self, &line, self->object);
+            return;
+        }
+    }
+    ConsoleWrite(self, "error: comando desconocido\n");
+}
+
+static void ConsoleHelp(struct console_s * self) {
+    for (uint8_t command = 0; command < self->count; command++) {
+        ConsolePrintf(self, "%-8s %s\n", self->commands[command].name, self->commands[command].help);
+    }
+    ConsolePrintf(self, "%-8s %s\n", "ayuda", "muestra esta lista");
+}
+
+static bool ConsolePut(struct console_s * self, uint8_t data) {
+    if (self->head - self->tail >= CONSOLE_TX_SIZE) {
+        self->stats.dropped++;
+        return false;
+    }
+    self->transmit[TX_INDEX(self->head)] = data;
+    self->head++;
+    return true;
+}
+
+static void ConsoleTransmit(struct console_s * self) {
+    uint32_t first;
+    uint32_t size;
+
+    if (self->transmitting || (self->head == self->tail)) {
+        return;
+    }
+
+    self->transmitter = Chip_GPDMA_GetFreeChannel(LPC_GPDMA, CONSOLE_DMA_TX);
+    if (!DmaSetHandler(self->transmitter, ConsoleTransmitted, self)) {
+        return;
+    }
+    /* Cada transferencia llega a lo sumo hasta el final de la cola; lo que sigue desde el principio va en la próxima */
+    first = TX_INDEX(self->tail);
+    size = self->head - self->tail;
+    if (size > CONSOLE_TX_SIZE - first) {
+        size = CONSOLE_TX_SIZE - first;
+    }
+    if (size > CONSOLE_DMA_MAX) {
+        size = CONSOLE_DMA_MAX;
+    }
+    Chip_GPDMA_InitDescriptor(LPC_GPDMA, &self->transmitList, (uintptr_t)&self->transmit[first], CONSOLE_DMA_TX, size,
+                              GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA, NULL);
+    self->sending = size;
+    self->transmitting = true;
+    self->stats.transfers++;
+    Chip_GPDMA_SGTransfer(LPC_GPDMA, self->transmitter, &self->transmitList, GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA);
+}
+
+static void ConsoleTransmitted(uint8_t channel, bool completed, void * object) {
+    struct console_s * self = object;
+
+    DmaSetHandler(channel, NULL, NULL);
+    Chip_GPDMA_Stop(LPC_GPDMA, channel);
+    if (completed) {
+        self->tail += self->sending;
+    }
+    self->transmitting = false;
+}
+
+/* === Public function implementation ============================================================================== */
+
+console_t ConsoleCreate(const console_command_t commands[], uint8_t count, void * object) {
+    struct console_s * self = &instance;
+
+    if (created) {
+        return NULL;
+    }
+
+    Chip_UART_Init(CONSOLE_UART);
+    Chip_UART_SetBaud(CONSOLE_UART, CONSOLE_BAUDRATE);
+    Chip_UART_ConfigData(CONSOLE_UART, UART_LCR_WLEN8 | UART_LCR_SBS_1BIT | UART_LCR_PARITY_DIS);
+    Chip_UART_SetupFIFOS(CONSOLE_UART, UART_FCR_FIFO_EN | UART_FCR_TX_RS | UART_FCR_RX_RS | UART_FCR_DMAMODE_SEL |
+                                           UART_FCR_TRG_LEV0);
+    Chip_UART_TXEnable(CONSOLE_UART);
+    Chip_GPDMA_Init(LPC_GPDMA);
+
+    /* El único elemento de la lista se apunta a sí mismo, así el DMA llena el buffer en círculo sin pedir atención */
+    self->receiver = Chip_GPDMA_GetFreeChannel(LPC_GPDMA, CONSOLE_DMA_RX);
+    if ((self->receiver >= GPDMA_NUMBER_CHANNELS) ||
+        (Chip_GPDMA_InitDescriptor(LPC_GPDMA, &self->receiveList, CONSOLE_DMA_RX, (uintptr_t)self->received,
+                                   CONSOLE_RX_SIZE, GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA,
+                                   &self->receiveList) != SUCCESS) ||
+        (Chip_GPDMA_SGTransfer(LPC_GPDMA, self->receiver, &self->receiveList, GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA) !=
+         SUCCESS)) {
+        return NULL;
+    }
+
+    self->commands = commands;
+    self->count = count;
+    self->object = object;
+    created = true;
+    return self;
+}
+
+void ConsoleService(console_t self) {
+    uint32_t received = ConsoleReceived(self);
+
+    while (self->scanned != received) {
+        uint8_t data = self->received[RX_INDEX(self->scanned)];
+
+        self->scanned++;
+        if ((data == '\r') || (data == '\n')) {
+            /* Las líneas vacías, como la que deja un retorno de carro seguido de un salto de línea, no hacen nada */
+            if (!self->discarding) {
+                ConsoleExecute(self, self->lineStart, self->scanned - 1);
+            }
+            self->discarding = false;
+            self->lineStart = self->scanned;
+        } else if (self->scanned - self->lineStart > CONSOLE_LINE_MAX) {
+            if (!self->discarding) {
+                self->stats.discarded++;
+                ConsoleWrite(self, "error: línea demasiado larga\n");
+            }
+            self->discarding = true;
+            self->lineStart = self->scanned;
+        }
+    }
+    ConsoleTransmit(self);
+}
+
+bool ConsoleWrite(console_t self, const char * text) {
+    bool complete = true;
+
+    for (; *text != '\0'; text++) {
+        if ((*text == '\n') && !ConsolePut(self, '\r')) {
+            complete = false;
+        }
+        if (!ConsolePut(self, *text)) {
+            complete = false;
+        }
+    }
+    ConsoleTransmit(self);
+    return complete;
+}
+
+bool ConsolePrintf(console_t self, const char * format, ...) {
+    char text[CONSOLE_PRINT_SIZE];
+    va_list arguments;
+
+    va_start(arguments, format);
+    vsnprintf(text, sizeof(text), format, arguments);
+    va_end(arguments);
+    return ConsoleWrite(self, text);
+}
+
+void ConsoleGetStats(console_t self, console_stats_t * stats) {
+    *stats = self->stats;
+}
+
+uint8_t ConsoleArgCount(const console_line_t * line) {
+    return line->count;
+}
+
+uint8_t ConsoleArgLength(const console_line_t * line, uint8_t index) {
+    return (index < line->count) ? line->length[index] : 0;
+}
+
+char ConsoleArgChar(const console_line_t * line, uint8_t index, uint8_t offset) {
+    if ((index >= line->count) || (offset >= line->length[index])) {
+        return '\0';
+    }
+    return line->buffer[RX_INDEX(line->start[index] + offset)];
+}
+
+bool ConsoleArgIs(const console_line_t * line, uint8_t index, const char * text) {
+    uint8_t length = ConsoleArgLength(line, index);
+    uint8_t offset;
+
+    if (index >= line->count) {
+        return false;
+    }
+    for (offset = 0; (offset < length) && (text[offset] != '\0'); offset++) {
+        if (ConsoleArgChar(line, index, offset) != text[offset]) {
+            return false;
+        }
+    }
+    return (offset == length) && (text[offset] == '\0');
+}
+
+/* === End of documentation ======================================================================================== */
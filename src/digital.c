@@ -26,13 +26,32 @@ SPDX-License-Identifier: MIT
 
 #include "config.h"
 #include "digital.h"
-#include "chip.h"
+#include "expander.h"
+#include "chipreg.h"
+#include "trace.h"
 #include <stdio.h>
 #include <stdbool.h>
-#include <stdlib.h>
+#include <string.h>
 
 /* === Macros definitions ========================================================================================== */
 
+/** @brief Cantidad de canales de interrupción de pin */
+#define DIGITAL_INTERRUPT_CHANNELS 8
+
+/** @brief Cantidad de puertos GPIO con copia en RAM para las salidas diferidas */
+#define DIGITAL_GPIO_PORTS 8
+
+/** @brief Número de puerto de las salidas que no están en un puerto GPIO, como las de un expansor */
+#define DIGITAL_GPIO_NONE 0xFF
+
+/** @brief Arma el argumento de traza de una salida, con el puerto que usa la traza para las salidas de un expansor */
+#define OUTPUT_TRACE_PIN(output)                                                                                       \
+    TRACE_PIN(((output)->gpio == DIGITAL_GPIO_NONE) ? TRACE_EXPANDER_GPIO : (output)->gpio, (output)->bit)
+
+#if (DIGITAL_EVENT_QUEUE_SIZE & (DIGITAL_EVENT_QUEUE_SIZE - 1)) != 0
+#error "DIGITAL_EVENT_QUEUE_SIZE debe ser potencia de dos"
+#endif
+
 /* === Private data type declarations ============================================================================== */
 
 /**
@@ -42,8 +61,38 @@ SPDX-License-Identifier: MIT
  * en un determinado puerto GPIO del microcontrolador.
  */
 struct digital_output_s {
-    uint8_t gpio; /**< Número de puerto GPIO al que pertenece el bit. */
-    uint8_t bit;  /**< Número de bit dentro del puerto. */
+    digital_pin_t pin;   /**< Acceso directo a los registros del pin. Con un expansor solo se usa la máscara. */
+    uint8_t gpio;        /**< Número de puerto GPIO al que pertenece el bit, o `DIGITAL_GPIO_NONE` en un expansor. */
+    uint8_t bit;         /**< Número de bit dentro del puerto, o número de salida en la cadena del expansor. */
+    expander_t expander; /**< Expansor al que pertenece la salida, o `NULL` si es un pin GPIO. */
+    bool active;         /**< Último estado pedido con las funciones de la salida. */
+    bool deferred;       /**< Indica si los cambios esperan a DigitalOutputCommit() para llegar al pin. */
+    bool direct;         /**< Indica si el pin ya se entregó a un grupo o a otro módulo. */
+};
+
+/**
+ * @brief Copia en RAM de las salidas diferidas de un puerto GPIO.
+ *
+ * Solo contiene los bits de las salidas diferidas, de modo que DigitalOutputCommit() escribe únicamente esos bits.
+ */
+struct digital_port_shadow_s {
+    uint32_t state;   /**< Estado pedido de las salidas diferidas del puerto. */
+    uint32_t written; /**< Estado de las salidas diferidas escrito en el puerto por la última confirmación. */
+};
+
+/**
+ * @brief Estructura que representa un grupo de salidas digitales.
+ *
+ * Guarda la máscara de bits del grupo en cada puerto involucrado, junto con el puerto y el bit que corresponde a cada
+ * salida para traducir los patrones que recibe DigitalOutputGroupWrite().
+ */
+struct digital_output_group_s {
+    uint8_t count;                               /**< Cantidad de salidas del grupo. */
+    uint8_t ports;                               /**< Cantidad de puertos distintos que abarca el grupo. */
+    uint8_t gpio[DIGITAL_GROUP_MAX_PORTS];       /**< Número de cada puerto GPIO del grupo. */
+    uint32_t mask[DIGITAL_GROUP_MAX_PORTS];      /**< Bits del grupo dentro de cada puerto. */
+    uint8_t slot[DIGITAL_GROUP_MAX_OUTPUTS];     /**< Índice en `gpio` del puerto de cada salida. */
+    uint32_t bitMask[DIGITAL_GROUP_MAX_OUTPUTS]; /**< Máscara del bit de cada salida dentro de su puerto. */
 };
 
 /**
@@ -53,67 +102,670 @@ struct digital_output_s {
  * en un determinado puerto GPIO del microcontrolador.
  */
 struct digital_input_s {
-    uint8_t gpio;   /**< Número de puerto gpio al que pertenece el bit. */
-    uint8_t bit;    /**< Número de bit dentro del puerto. */
-    bool inverted;  /**< Indica si la entrada es invertida o no */
-    bool lastState; /**< Último estado leído de la entrada */
+    digital_pin_t pin;                 /**< Acceso directo a los registros del pin. */
+    uint8_t gpio;                      /**< Número de puerto gpio al que pertenece el bit. */
+    uint8_t bit;                       /**< Número de bit dentro del puerto. */
+    bool inverted;                     /**< Indica si la entrada es invertida o no */
+    bool lastState;                    /**< Último estado leído de la entrada */
+    digital_input_bank_t bank;         /**< Banco al que pertenece la entrada, o `NULL` si se lee en forma directa */
+    uint8_t slot;                      /**< Índice del puerto de la entrada dentro del banco */
+    int8_t channel;                    /**< Canal de interrupción de pin asociado, o -1 si no tiene */
+    volatile uint8_t edges;            /**< Cambios registrados por la interrupción, que solo ella incrementa */
+    uint8_t consumed;                  /**< Cambios ya informados por DigitalInputWasChanged() */
+    digital_input_handlers_t handlers; /**< Funciones que ejecuta el banco ante los cambios de la entrada */
+    void * handlerObject;              /**< Objeto que reciben las funciones */
+    uint16_t heldScans;                /**< Exploraciones que lleva activa la entrada desde su activación */
+};
+
+/**
+ * @brief Captura de un puerto GPIO dentro de un banco de entradas digitales.
+ *
+ * Todas las máscaras están expresadas en lógica positiva: un `1` indica una entrada activa.
+ */
+struct digital_port_snapshot_s {
+    uint8_t gpio;                            /**< Número de puerto GPIO. */
+    uint32_t mask;                           /**< Bits del puerto que corresponden a entradas del banco. */
+    uint32_t invert;                         /**< Bits de las entradas con lógica invertida, aplicados con XOR. */
+    uint32_t state;                          /**< Estado de las entradas en la última captura. */
+    uint32_t previous;                       /**< Estado de las entradas en la captura anterior. */
+    uint32_t reported;                       /**< Estado informado por la última consulta de cambios de cada entrada. */
+    uint32_t counter[DIGITAL_DEBOUNCE_BITS]; /**< Planos del contador vertical de muestras estables. */
+    uint32_t handled;                        /**< Bits de las entradas con funciones registradas. */
+    uint32_t holding;                        /**< Bits de las entradas activas que esperan su pulsación prolongada. */
+    uint8_t input[32];                       /**< Índice en la reserva de la entrada de cada bit con funciones. */
+};
+
+/**
+ * @brief Estructura que representa un banco de entradas digitales.
+ */
+struct digital_input_bank_s {
+    uint8_t samples;                                             /**< Muestras consecutivas para aceptar un cambio. */
+    uint8_t ports;                                               /**< Cantidad de puertos que abarca el banco. */
+    struct digital_port_snapshot_s port[DIGITAL_BANK_MAX_PORTS]; /**< Captura de cada puerto del banco. */
 };
 
 /* === Private function declarations =============================================================================== */
 
+/**
+ * @brief Precalcula el acceso directo a un pin GPIO.
+ *
+ * @param pin       Estructura donde se guarda el acceso directo.
+ * @param gpio      Número del puerto GPIO.
+ * @param bit       Número de bit dentro del puerto.
+ * @param inverted  `true` si la lógica del pin es invertida.
+ */
+static void PinInit(digital_pin_t * pin, uint8_t gpio, uint8_t bit, bool inverted);
+
+/**
+ * @brief Inicializa los campos de una salida digital sobre un pin GPIO, sin acceder a los registros del puerto.
+ *
+ * @param output  Puntero a la instancia de la salida.
+ * @param gpio    Número del puerto GPIO.
+ * @param bit     Número de bit dentro del puerto.
+ */
+static void OutputInit(digital_output_t output, uint8_t gpio, uint8_t bit);
+
+/**
+ * @brief Inicializa los campos de una entrada digital, sin acceder a los registros del puerto.
+ *
+ * @param input     Puntero a la instancia de la entrada.
+ * @param gpio      Número del puerto GPIO.
+ * @param bit       Número de bit dentro del puerto.
+ * @param inverted  `true` si la lógica de la entrada es invertida.
+ */
+static void InputInit(digital_input_t input, uint8_t gpio, uint8_t bit, bool inverted);
+
+/**
+ * @brief Calcula la máscara de los pines de una lista en cada puerto GPIO.
+ *
+ * @param pins   Arreglo con la ubicación de cada pin.
+ * @param count  Cantidad de pines en el arreglo.
+ * @param mask   Arreglo donde se guarda la máscara de cada puerto, con `DIGITAL_GPIO_PORTS` posiciones.
+ * @return `true` si todos los pines están en puertos válidos.
+ */
+static bool PortMasks(const digital_pin_location_t pins[], uint8_t count, uint32_t mask[]);
+
+/**
+ * @brief Guarda el nuevo estado de una salida y, si es diferida, lo anota en la copia de su puerto.
+ *
+ * @param output  Puntero a la instancia de la salida.
+ * @param active  Nuevo estado de la salida.
+ */
+static void OutputSetState(digital_output_t output, bool active);
+
+/**
+ * @brief Verifica las salidas de un grupo y calcula sus puertos y máscaras, sin tomar nada de la reserva.
+ *
+ * @param group    Estructura del grupo que se completa.
+ * @param outputs  Salidas del grupo.
+ * @param count    Cantidad de salidas.
+ * @return `true` si las salidas pueden formar un grupo; `false` si los parámetros no son válidos, alguna salida
+ *         pertenece a un expansor o es diferida, o las salidas abarcan más de `DIGITAL_GROUP_MAX_PORTS` puertos.
+ */
+static bool GroupBuild(struct digital_output_group_s * group, const digital_output_t outputs[], uint8_t count);
+
+/**
+ * @brief Busca la captura de un puerto dentro de un banco.
+ *
+ * @param bank  Puntero a la instancia del banco.
+ * @param gpio  Número del puerto GPIO.
+ * @return Puntero a la captura del puerto, o `NULL` si el banco no tiene entradas en ese puerto.
+ */
+static struct digital_port_snapshot_s * BankFindPort(digital_input_bank_t bank, uint8_t gpio);
+
+/**
+ * @brief Lee un puerto de un banco y lo expresa en lógica positiva.
+ *
+ * @param port  Puntero a la captura del puerto.
+ * @return Máscara con un `1` en el bit de cada entrada del banco que está activa en el puerto.
+ */
+static uint32_t BankSample(struct digital_port_snapshot_s * port);
+
+/**
+ * @brief Filtra una muestra de un puerto con un contador vertical.
+ *
+ * Cada bit del puerto tiene un contador de `DIGITAL_DEBOUNCE_BITS` bits repartido en planos, uno por bit de peso, de
+ * modo que los contadores de todas las entradas del puerto avanzan en paralelo con unas pocas operaciones lógicas. El
+ * contador de un bit se incrementa mientras la muestra difiere del estado filtrado, vuelve a cero cuando coinciden y,
+ * al llegar a `samples`, el estado filtrado del bit cambia.
+ *
+ * @param port     Puntero a la captura del puerto.
+ * @param sample   Muestra del puerto en lógica positiva.
+ * @param samples  Cantidad de muestras consecutivas necesarias para aceptar un cambio.
+ * @return Nuevo estado filtrado del puerto.
+ */
+static uint32_t BankDebounce(struct digital_port_snapshot_s * port, uint32_t sample, uint8_t samples);
+
+/**
+ * @brief Ejecuta las funciones registradas de las entradas de un puerto de un banco después de una exploración.
+ *
+ * @param port     Puntero a la captura del puerto.
+ * @param changed  Bits del puerto que cambiaron en la exploración.
+ */
+static void BankDispatch(struct digital_port_snapshot_s * port, uint32_t changed);
+
+/**
+ * @brief Registra un cambio de una entrada asociada a una interrupción.
+ *
+ * @param input      Puntero a la instancia de la entrada.
+ * @param level      Nivel eléctrico del pin después del cambio.
+ * @param timestamp  Marca de tiempo del cambio.
+ */
+static void EventPush(digital_input_t input, bool level, uint32_t timestamp);
+
+/**
+ * @brief Atiende la interrupción de un canal de interrupción de pin.
+ *
+ * @param channel  Canal de interrupción de pin.
+ */
+static void InputInterrupt(uint8_t channel);
+
 /* === Private variable definitions ================================================================================ */
 
+/** @brief Reserva estática para las instancias de salidas digitales */
+static struct digital_output_s outputPool[DIGITAL_OUTPUT_POOL_SIZE];
+
+/** @brief Cantidad de salidas digitales asignadas de la reserva */
+static uint8_t outputsUsed;
+
+/** @brief Copia en RAM de las salidas diferidas de cada puerto GPIO */
+static struct digital_port_shadow_s shadowPort[DIGITAL_GPIO_PORTS];
+
+/** @brief Bits de los puertos cuya copia cambió desde la última confirmación */
+static uint8_t shadowDirty;
+
+/** @brief Reserva estática para las instancias de grupos de salidas digitales */
+static struct digital_output_group_s groupPool[DIGITAL_GROUP_POOL_SIZE];
+
+/** @brief Cantidad de grupos de salidas digitales asignados de la reserva */
+static uint8_t groupsUsed;
+
+/** @brief Reserva estática para las instancias de entradas digitales */
+static struct digital_input_s inputPool[DIGITAL_INPUT_POOL_SIZE];
+
+/** @brief Cantidad de entradas digitales asignadas de la reserva */
+static uint8_t inputsUsed;
+
+/** @brief Reserva estática para las instancias de bancos de entradas digitales */
+static struct digital_input_bank_s bankPool[DIGITAL_BANK_POOL_SIZE];
+
+/** @brief Cantidad de bancos de entradas digitales asignados de la reserva */
+static uint8_t banksUsed;
+
+/** @brief Entrada asociada a cada canal de interrupción de pin */
+static digital_input_t channelInput[DIGITAL_INTERRUPT_CHANNELS];
+
+/** @brief Cola de eventos de las entradas asociadas a interrupciones */
+static digital_event_t eventQueue[DIGITAL_EVENT_QUEUE_SIZE];
+
+/** @brief Contador de eventos agregados a la cola, escrito solo por las interrupciones */
+static volatile uint32_t eventHead;
+
+/** @brief Contador de eventos retirados de la cola, escrito solo por el consumidor */
+static volatile uint32_t eventTail;
+
+/** @brief Cantidad de eventos descartados por cola llena */
+static volatile uint32_t eventsLost;
+
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
 
+static void PinInit(digital_pin_t * pin, uint8_t gpio, uint8_t bit, bool inverted) {
+    pin->set = &LPC_GPIO_PORT->SET[gpio];
+    pin->clear = &LPC_GPIO_PORT->CLR[gpio];
+    pin->toggle = &LPC_GPIO_PORT->NOT[gpio];
+    pin->level = &LPC_GPIO_PORT->PIN[gpio];
+    pin->mask = 1u << bit;
+    pin->invert = inverted ? pin->mask : 0;
+}
+
+static void OutputInit(digital_output_t output, uint8_t gpio, uint8_t bit) {
+    output->gpio = gpio;
+    output->bit = bit;
+    output->expander = NULL;
+    output->active = false;
+    output->deferred = false;
+    output->direct = false;
+    PinInit(&output->pin, gpio, bit, false);
+}
+
+static void InputInit(digital_input_t input, uint8_t gpio, uint8_t bit, bool inverted) {
+    input->gpio = gpio;
+    input->bit = bit;
+    input->inverted = inverted;
+    PinInit(&input->pin, gpio, bit, inverted);
+    input->bank = NULL;
+    input->slot = 0;
+    input->channel = -1;
+    input->edges = 0;
+    input->consumed = 0;
+    memset(&input->handlers, 0, sizeof(input->handlers));
+    input->handlerObject = NULL;
+    input->heldScans = 0;
+}
+
+static bool PortMasks(const digital_pin_location_t pins[], uint8_t count, uint32_t mask[]) {
+    memset(mask, 0, DIGITAL_GPIO_PORTS * sizeof(mask[0]));
+    for (uint8_t index = 0; index < count; index++) {
+        if ((pins[index].gpio >= DIGITAL_GPIO_PORTS) || (pins[index].bit >= 32)) {
+            return false;
+        }
+        mask[pins[index].gpio] |= 1u << pins[index].bit;
+    }
+    return true;
+}
+
+static void OutputSetState(digital_output_t output, bool active) {
+    output->active = active;
+    if (output->deferred) {
+        struct digital_port_shadow_s * port = &shadowPort[output->gpio];
+
+        port->state = active ? (port->state | output->pin.mask) : (port->state & ~output->pin.mask);
+        shadowDirty |= 1u << output->gpio;
+    }
+}
+
+static bool GroupBuild(struct digital_output_group_s * group, const digital_output_t outputs[], uint8_t count) {
+    if ((outputs == NULL) || (count == 0) || (count > DIGITAL_GROUP_MAX_OUTPUTS)) {
+        return false;
+    }
+
+    group->count = count;
+    group->ports = 0;
+    for (uint8_t index = 0; index < count; index++) {
+        uint8_t slot = 0;
+
+        if ((outputs[index] == NULL) || (outputs[index]->expander != NULL) || outputs[index]->deferred) {
+            return false;
+        }
+        while ((slot < group->ports) && (group->gpio[slot] != outputs[index]->gpio)) {
+            slot++;
+        }
+        if (slot == group->ports) {
+            if (group->ports == DIGITAL_GROUP_MAX_PORTS) {
+                return false;
+            }
+            group->gpio[slot] = outputs[index]->gpio;
+            group->mask[slot] = 0;
+            group->ports++;
+        }
+        group->slot[index] = slot;
+        group->bitMask[index] = 1u << outputs[index]->bit;
+        group->mask[slot] |= group->bitMask[index];
+    }
+    return true;
+}
+
+static struct digital_port_snapshot_s * BankFindPort(digital_input_bank_t bank, uint8_t gpio) {
+    for (uint8_t slot = 0; slot < bank->ports; slot++) {
+        if (bank->port[slot].gpio == gpio) {
+            return &bank->port[slot];
+        }
+    }
+    return NULL;
+}
+
+static uint32_t BankSample(struct digital_port_snapshot_s * port) {
+    return (Chip_GPIO_GetPortValue(LPC_GPIO_PORT, port->gpio) ^ port->invert) & port->mask;
+}
+
+static uint32_t BankDebounce(struct digital_port_snapshot_s * port, uint32_t sample, uint8_t samples) {
+    uint32_t delta = sample ^ port->state;
+    uint32_t carry = delta;
+    uint32_t done = delta;
+
+    for (uint8_t plane = 0; plane < DIGITAL_DEBOUNCE_BITS; plane++) {
+        /* Incremento con acarreo en los bits que difieren, y puesta a cero en los que coinciden */
+        port->counter[plane] ^= carry;
+        carry &= ~port->counter[plane];
+        port->counter[plane] &= delta;
+        /* Comparación de cada contador contra la cantidad de muestras configurada */
+        done &= (samples & (1u << plane)) ? port->counter[plane] : ~port->counter[plane];
+    }
+    for (uint8_t plane = 0; plane < DIGITAL_DEBOUNCE_BITS; plane++) {
+        port->counter[plane] &= ~done;
+    }
+    return port->state ^ done;
+}
+
+static void BankDispatch(struct digital_port_snapshot_s * port, uint32_t changed) {
+    /* Las pulsaciones prolongadas en curso suman una exploración, y la que completa su cuenta ejecuta la función */
+    for (uint32_t pending = port->holding & ~changed; pending != 0; pending &= pending - 1) {
+        digital_input_t input = &inputPool[port->input[__builtin_ctz(pending)]];
+
+        if (++input->heldScans >= input->handlers.holdScans) {
+            port->holding &= ~input->pin.mask;
+            input->handlers.hold(input, input->handlerObject);
+        }
+    }
+
+    for (changed &= port->handled; changed != 0; changed &= changed - 1) {
+        digital_input_t input = &inputPool[port->input[__builtin_ctz(changed)]];
+
+        if (port->state & input->pin.mask) {
+            if (input->handlers.hold != NULL) {
+                input->heldScans = 0;
+                port->holding |= input->pin.mask;
+            }
+            if (input->handlers.activated != NULL) {
+                input->handlers.activated(input, input->handlerObject);
+            }
+        } else {
+            port->holding &= ~input->pin.mask;
+            if (input->handlers.deactivated != NULL) {
+                input->handlers.deactivated(input, input->handlerObject);
+            }
+        }
+    }
+}
+
+static void EventPush(digital_input_t input, bool level, uint32_t timestamp) {
+    uint32_t head = eventHead;
+
+    input->edges++;
+    if ((head - eventTail) < DIGITAL_EVENT_QUEUE_SIZE) {
+        digital_event_t * event = &eventQueue[head & (DIGITAL_EVENT_QUEUE_SIZE - 1)];
+
+        event->timestamp = timestamp;
+        event->input = input;
+        event->edge = (level != input->inverted) ? DIGITAL_INPUT_WAS_ACTIVATED : DIGITAL_INPUT_WAS_DEACTIVATED;
+        TRACE((event->edge == DIGITAL_INPUT_WAS_ACTIVATED) ? TRACE_INPUT_ACTIVATED : TRACE_INPUT_DEACTIVATED,
+              TRACE_PIN(input->gpio, input->bit));
+        /* El evento tiene que estar completo en memoria antes de publicarlo al consumidor */
+        __DMB();
+        eventHead = head + 1;
+    } else {
+        eventsLost++;
+    }
+}
+
+static void InputInterrupt(uint8_t channel) {
+    digital_input_t input = channelInput[channel];
+    uint32_t pin = PININTCH(channel);
+    bool rise = (Chip_PININT_GetRiseStates(LPC_GPIO_PIN_INT) & pin) != 0;
+    bool fall = (Chip_PININT_GetFallStates(LPC_GPIO_PIN_INT) & pin) != 0;
+
+    Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, pin);
+    if (input != NULL) {
+        uint32_t timestamp = DWT->CYCCNT;
+
+        if (rise && fall) {
+            /* Los dos flancos ocurrieron antes de atender la interrupción: el nivel actual indica cuál fue último */
+            bool level = (CHIP_REG_READ(input->pin.level) & input->pin.mask) != 0;
+            EventPush(input, !level, timestamp);
+            EventPush(input, level, timestamp);
+        } else if (rise || fall) {
+            EventPush(input, rise, timestamp);
+        }
+    }
+}
+
 /* === Public function implementation ============================================================================== */
 
 digital_output_t DigitalOutputCreate(uint8_t gpio, uint8_t bit) {
-    digital_output_t self = malloc(sizeof(struct digital_output_s));
-    if (self != NULL) {
-        self->gpio = gpio;
-        self->bit = bit;
+    digital_output_t self = NULL;
+    if (outputsUsed < DIGITAL_OUTPUT_POOL_SIZE) {
+        self = &outputPool[outputsUsed++];
+        OutputInit(self, gpio, bit);
         DigitalOutputDeactivate(self);
         Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, self->gpio, self->bit, true);
     }
     return self;
 }
 
+bool DigitalOutputCreateMany(const digital_pin_location_t pins[], uint8_t count, digital_output_t outputs[]) {
+    uint32_t mask[DIGITAL_GPIO_PORTS];
+
+    if ((count == 0) || (count > DIGITAL_OUTPUT_POOL_SIZE - outputsUsed) || !PortMasks(pins, count, mask)) {
+        return false;
+    }
+
+    for (uint8_t index = 0; index < count; index++) {
+        outputs[index] = &outputPool[outputsUsed++];
+        OutputInit(outputs[index], pins[index].gpio, pins[index].bit);
+    }
+    /* Las salidas se apagan antes de habilitar los controladores de los pines, como en DigitalOutputCreate() */
+    for (uint8_t gpio = 0; gpio < DIGITAL_GPIO_PORTS; gpio++) {
+        if (mask[gpio] != 0) {
+            Chip_GPIO_ClearValue(LPC_GPIO_PORT, gpio, mask[gpio]);
+            Chip_GPIO_SetPortDIR(LPC_GPIO_PORT, gpio, mask[gpio], true);
+        }
+    }
+    return true;
+}
+
+digital_output_t DigitalOutputCreateOnExpander(expander_t expander, uint8_t bit) {
+    digital_output_t self = NULL;
+    if ((expander != NULL) && (outputsUsed < DIGITAL_OUTPUT_POOL_SIZE)) {
+        self = &outputPool[outputsUsed++];
+        self->gpio = DIGITAL_GPIO_NONE;
+        self->bit = bit;
+        self->expander = expander;
+        self->deferred = false;
+        self->direct = false;
+        memset(&self->pin, 0, sizeof(self->pin));
+        self->pin.mask = 1u << (bit % 8);
+        DigitalOutputDeactivate(self);
+    }
+    return self;
+}
+
 void DigitalOutputActivate(digital_output_t self) {
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->gpio, self->bit, true);
+    if (self->expander != NULL) {
+        ExpanderWrite(self->expander, self->bit / 8, self->pin.mask, self->pin.mask);
+    } else if (!self->deferred) {
+        DigitalPinActivate(&self->pin);
+    }
+    OutputSetState(self, true);
+    TRACE(TRACE_OUTPUT_ACTIVATE, OUTPUT_TRACE_PIN(self));
 }
 
 void DigitalOutputDeactivate(digital_output_t self) {
-    Chip_GPIO_SetPinState(LPC_GPIO_PORT, self->gpio, self->bit, false);
+    if (self->expander != NULL) {
+        ExpanderWrite(self->expander, self->bit / 8, self->pin.mask, 0);
+    } else if (!self->deferred) {
+        DigitalPinDeactivate(&self->pin);
+    }
+    OutputSetState(self, false);
+    TRACE(TRACE_OUTPUT_DEACTIVATE, OUTPUT_TRACE_PIN(self));
 }
 
 void DigitalOutputToggle(digital_output_t self) {
-    Chip_GPIO_SetPinToggle(LPC_GPIO_PORT, self->gpio, self->bit);
+    if (self->expander != NULL) {
+        ExpanderToggle(self->expander, self->bit / 8, self->pin.mask);
+    } else if (!self->deferred) {
+        DigitalPinToggle(&self->pin);
+    }
+    OutputSetState(self, !self->active);
+    TRACE(TRACE_OUTPUT_TOGGLE, OUTPUT_TRACE_PIN(self));
+}
+
+bool DigitalOutputGetState(digital_output_t self) {
+    return self->active;
+}
+
+bool DigitalOutputSetDeferred(digital_output_t self, bool deferred) {
+    struct digital_port_shadow_s * port;
+
+    if ((self->gpio == DIGITAL_GPIO_NONE) || self->direct || (self->gpio >= DIGITAL_GPIO_PORTS)) {
+        return false;
+    }
+    port = &shadowPort[self->gpio];
+    if (deferred && !self->deferred) {
+        /* El pin ya tiene el estado de la salida, así que la copia arranca sin cambios pendientes */
+        port->state = self->active ? (port->state | self->pin.mask) : (port->state & ~self->pin.mask);
+        port->written = self->active ? (port->written | self->pin.mask) : (port->written & ~self->pin.mask);
+    } else if (!deferred && self->deferred) {
+        /* Un cambio pendiente de la salida se escribe ahora y el bit deja de pertenecer a la copia */
+        if (((port->state ^ port->written) & self->pin.mask) != 0) {
+            if (self->active) {
+                DigitalPinActivate(&self->pin);
+            } else {
+                DigitalPinDeactivate(&self->pin);
+            }
+        }
+        port->state &= ~self->pin.mask;
+        port->written &= ~self->pin.mask;
+    }
+    self->deferred = deferred;
+    return true;
+}
+
+void DigitalOutputCommit(void) {
+    for (uint32_t pending = shadowDirty; pending != 0; pending &= pending - 1) {
+        uint8_t gpio = __builtin_ctz(pending);
+        struct digital_port_shadow_s * port = &shadowPort[gpio];
+        uint32_t changed = port->state ^ port->written;
+
+        if ((changed & port->state) != 0) {
+            Chip_GPIO_SetValue(LPC_GPIO_PORT, gpio, changed & port->state);
+        }
+        if ((changed & ~port->state) != 0) {
+            Chip_GPIO_ClearValue(LPC_GPIO_PORT, gpio, changed & ~port->state);
+        }
+        port->written = port->state;
+    }
+    shadowDirty = 0;
+}
+
+const digital_pin_t * DigitalOutputGetPin(digital_output_t self) {
+    if ((self->expander != NULL) || self->deferred) {
+        return NULL;
+    }
+    self->direct = true;
+    return &self->pin;
+}
+
+digital_output_group_t DigitalOutputGroupCreate(const digital_output_t outputs[], uint8_t count) {
+    digital_output_group_t self;
+
+    /* La instancia se toma de la reserva y solo se confirma cuando el grupo resulta válido */
+    if ((groupsUsed >= DIGITAL_GROUP_POOL_SIZE) || !GroupBuild(&groupPool[groupsUsed], outputs, count)) {
+        return NULL;
+    }
+
+    self = &groupPool[groupsUsed++];
+    for (uint8_t index = 0; index < count; index++) {
+        outputs[index]->direct = true;
+    }
+    return self;
+}
+
+bool DigitalOutputGroupIsValid(const digital_output_t outputs[], uint8_t count) {
+    struct digital_output_group_s group;
+
+    return GroupBuild(&group, outputs, count);
+}
+
+void DigitalOutputGroupActivate(digital_output_group_t self) {
+    for (uint8_t slot = 0; slot < self->ports; slot++) {
+        Chip_GPIO_SetValue(LPC_GPIO_PORT, self->gpio[slot], self->mask[slot]);
+    }
+}
+
+void DigitalOutputGroupDeactivate(digital_output_group_t self) {
+    for (uint8_t slot = 0; slot < self->ports; slot++) {
+        Chip_GPIO_ClearValue(LPC_GPIO_PORT, self->gpio[slot], self->mask[slot]);
+    }
+}
+
+void DigitalOutputGroupToggle(digital_output_group_t self) {
+    for (uint8_t slot = 0; slot < self->ports; slot++) {
+        Chip_GPIO_SetPortToggle(LPC_GPIO_PORT, self->gpio[slot], self->mask[slot]);
+    }
+}
+
+void DigitalOutputGroupWrite(digital_output_group_t self, uint32_t pattern) {
+    uint32_t value[DIGITAL_GROUP_MAX_PORTS] = {0};
+
+    /* Solo se recorren los bits activos del patrón */
+    pattern &= (self->count < 32) ? ((1u << self->count) - 1) : UINT32_MAX;
+    while (pattern != 0) {
+        uint8_t index = __builtin_ctz(pattern);
+        value[self->slot[index]] |= self->bitMask[index];
+        pattern &= pattern - 1;
+    }
+
+    /* Los registros CLR y SET solo afectan los bits escritos en uno, así que no hace falta el registro MASK, que es
+     * compartido por todo el puerto y podría cambiarlo una interrupción entre dos escrituras */
+    for (uint8_t slot = 0; slot < self->ports; slot++) {
+        Chip_GPIO_ClearValue(LPC_GPIO_PORT, self->gpio[slot], self->mask[slot] & ~value[slot]);
+        Chip_GPIO_SetValue(LPC_GPIO_PORT, self->gpio[slot], value[slot]);
+    }
 }
 
 digital_input_t DigitalInputCreate(uint8_t gpio, uint8_t bit, bool inverted) {
-    digital_input_t self = malloc(sizeof(struct digital_input_s));
-    if (self != NULL) {
-        self->gpio = gpio;
-        self->bit = bit;
-        self->inverted = inverted;
+    digital_input_t self = NULL;
+    if (inputsUsed < DIGITAL_INPUT_POOL_SIZE) {
+        self = &inputPool[inputsUsed++];
+        InputInit(self, gpio, bit, inverted);
         Chip_GPIO_SetPinDIR(LPC_GPIO_PORT, self->gpio, self->bit, false);
         self->lastState = DigitalInputGetIsActive(self);
     }
     return self;
 }
 
+bool DigitalInputCreateMany(const digital_pin_location_t pins[], uint8_t count, bool inverted,
+                            digital_input_t inputs[]) {
+    uint32_t mask[DIGITAL_GPIO_PORTS];
+    uint32_t level[DIGITAL_GPIO_PORTS];
+
+    if ((count == 0) || (count > DIGITAL_INPUT_POOL_SIZE - inputsUsed) || !PortMasks(pins, count, mask)) {
+        return false;
+    }
+
+    for (uint8_t gpio = 0; gpio < DIGITAL_GPIO_PORTS; gpio++) {
+        if (mask[gpio] != 0) {
+            Chip_GPIO_SetPortDIR(LPC_GPIO_PORT, gpio, mask[gpio], false);
+            level[gpio] = Chip_GPIO_GetPortValue(LPC_GPIO_PORT, gpio);
+        }
+    }
+    for (uint8_t index = 0; index < count; index++) {
+        digital_input_t self = &inputPool[inputsUsed++];
+
+        InputInit(self, pins[index].gpio, pins[index].bit, inverted);
+        self->lastState = ((level[self->gpio] ^ self->pin.invert) & self->pin.mask) != 0;
+        inputs[index] = self;
+    }
+    return true;
+}
+
 bool DigitalInputGetIsActive(digital_input_t self) {
-    bool state = Chip_GPIO_ReadPortBit(LPC_GPIO_PORT, self->gpio, self->bit) != 0;
-    if (self->inverted) {
-        state = !state;
+    if (self->bank != NULL) {
+        return (self->bank->port[self->slot].state & self->pin.mask) != 0;
     }
-    return state;
+    return DigitalPinGetIsActive(&self->pin);
+}
+
+const digital_pin_t * DigitalInputGetPin(digital_input_t self) {
+    return &self->pin;
 }
 
 digital_states_t DigitalInputWasChanged(digital_input_t self) {
     digital_states_t result = DIGITAL_INPUT_NO_CHANGE;
+
+    if (self->channel >= 0) {
+        /* Los cambios registrados por la interrupción alternan entre activación y desactivación */
+        if (self->edges != self->consumed) {
+            self->consumed++;
+            self->lastState = !self->lastState;
+            result = self->lastState ? DIGITAL_INPUT_WAS_ACTIVATED : DIGITAL_INPUT_WAS_DEACTIVATED;
+        }
+        return result;
+    }
+
+    if (self->bank != NULL) {
+        struct digital_port_snapshot_s * port = &self->bank->port[self->slot];
+        uint32_t bit = 1u << self->bit;
+
+        if ((port->state ^ port->reported) & bit) {
+            result = (port->state & bit) ? DIGITAL_INPUT_WAS_ACTIVATED : DIGITAL_INPUT_WAS_DEACTIVATED;
+            port->reported ^= bit;
+        }
+        return result;
+    }
+
     bool state = DigitalInputGetIsActive(self);
     if (state && !self->lastState) {
         result = DIGITAL_INPUT_WAS_ACTIVATED;
@@ -132,4 +784,203 @@ bool DigitalInputWasDeactivated(digital_input_t self) {
     return DIGITAL_INPUT_WAS_DEACTIVATED == DigitalInputWasChanged(self);
 }
 
+digital_input_bank_t DigitalInputBankCreate(const digital_input_t inputs[], uint8_t count) {
+    digital_input_bank_t self = NULL;
+
+    if ((inputs == NULL) || (count == 0)) {
+        return NULL;
+    }
+    for (uint8_t index = 0; index < count; index++) {
+        if ((inputs[index] == NULL) || (inputs[index]->bank != NULL) || (inputs[index]->channel >= 0)) {
+            return NULL;
+        }
+    }
+
+    /* La instancia se toma de la reserva y solo se confirma cuando el banco resulta válido */
+    if (banksUsed < DIGITAL_BANK_POOL_SIZE) {
+        self = &bankPool[banksUsed];
+        self->ports = 0;
+        for (uint8_t index = 0; index < count; index++) {
+            struct digital_port_snapshot_s * port = BankFindPort(self, inputs[index]->gpio);
+            uint32_t bit = 1u << inputs[index]->bit;
+
+            if (port == NULL) {
+                if (self->ports == DIGITAL_BANK_MAX_PORTS) {
+                    return NULL;
+                }
+                port = &self->port[self->ports++];
+                port->gpio = inputs[index]->gpio;
+                port->mask = 0;
+                port->invert = 0;
+            }
+            port->mask |= bit;
+            if (inputs[index]->inverted) {
+                port->invert |= bit;
+            }
+        }
+
+        self->samples = 1;
+        for (uint8_t slot = 0; slot < self->ports; slot++) {
+            struct digital_port_snapshot_s * port = &self->port[slot];
+
+            port->state = BankSample(port);
+            port->previous = port->state;
+            port->reported = port->state;
+            port->handled = 0;
+            port->holding = 0;
+            for (uint8_t plane = 0; plane < DIGITAL_DEBOUNCE_BITS; plane++) {
+                port->counter[plane] = 0;
+            }
+        }
+        for (uint8_t index = 0; index < count; index++) {
+            inputs[index]->slot = BankFindPort(self, inputs[index]->gpio) - self->port;
+            inputs[index]->bank = self;
+        }
+        banksUsed++;
+    }
+    return self;
+}
+
+void DigitalInputBankScan(digital_input_bank_t self) {
+    for (uint8_t slot = 0; slot < self->ports; slot++) {
+        struct digital_port_snapshot_s * port = &self->port[slot];
+
+        uint32_t changed;
+
+        port->previous = port->state;
+        port->state = BankDebounce(port, BankSample(port), self->samples);
+        changed = port->state ^ port->previous;
+#if TRACE_ENABLED
+        for (uint32_t pending = changed; pending != 0; pending &= pending - 1) {
+            uint8_t bit = __builtin_ctz(pending);
+            TRACE((port->state & (1u << bit)) ? TRACE_INPUT_ACTIVATED : TRACE_INPUT_DEACTIVATED,
+                  TRACE_PIN(port->gpio, bit));
+        }
+#endif
+        if ((changed & port->handled) | port->holding) {
+            BankDispatch(port, changed);
+        }
+    }
+}
+
+bool DigitalInputBankSetDebounce(digital_input_bank_t self, uint8_t samples) {
+    if ((samples == 0) || (samples >= (1u << DIGITAL_DEBOUNCE_BITS))) {
+        return false;
+    }
+    self->samples = samples;
+    return true;
+}
+
+uint32_t DigitalInputBankGetState(digital_input_bank_t self, uint8_t gpio) {
+    struct digital_port_snapshot_s * port = BankFindPort(self, gpio);
+    return (port != NULL) ? port->state : 0;
+}
+
+uint32_t DigitalInputBankGetActivated(digital_input_bank_t self, uint8_t gpio) {
+    struct digital_port_snapshot_s * port = BankFindPort(self, gpio);
+    return (port != NULL) ? (port->state & ~port->previous) : 0;
+}
+
+uint32_t DigitalInputBankGetDeactivated(digital_input_bank_t self, uint8_t gpio) {
+    struct digital_port_snapshot_s * port = BankFindPort(self, gpio);
+    return (port != NULL) ? (~port->state & port->previous) : 0;
+}
+
+bool DigitalInputSetHandlers(digital_input_t self, const digital_input_handlers_t * handlers, void * object) {
+    struct digital_port_snapshot_s * port;
+
+    if ((self->bank == NULL) || ((handlers != NULL) && (handlers->hold != NULL) && (handlers->holdScans == 0))) {
+        return false;
+    }
+
+    port = &self->bank->port[self->slot];
+    port->holding &= ~self->pin.mask;
+    if (handlers != NULL) {
+        self->handlers = *handlers;
+        self->handlerObject = object;
+        port->input[self->bit] = self - inputPool;
+        port->handled |= self->pin.mask;
+    } else {
+        memset(&self->handlers, 0, sizeof(self->handlers));
+        self->handlerObject = NULL;
+        port->handled &= ~self->pin.mask;
+    }
+    return true;
+}
+
+bool DigitalInputAttachInterrupt(digital_input_t self, uint8_t channel) {
+    uint32_t pin;
+
+    if ((channel >= DIGITAL_INTERRUPT_CHANNELS) || (channelInput[channel] != NULL) || (self->bank != NULL) ||
+        (self->channel >= 0)) {
+        return false;
+    }
+
+    pin = PININTCH(channel);
+    self->channel = channel;
+    self->edges = 0;
+    self->consumed = 0;
+    self->lastState = DigitalInputGetIsActive(self);
+    channelInput[channel] = self;
+
+    Chip_PININT_Init(LPC_GPIO_PIN_INT);
+    Chip_SCU_GPIOIntPinSel(channel, self->gpio, self->bit);
+    Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, pin);
+    Chip_PININT_SetPinModeEdge(LPC_GPIO_PIN_INT, pin);
+    Chip_PININT_EnableIntHigh(LPC_GPIO_PIN_INT, pin);
+    Chip_PININT_EnableIntLow(LPC_GPIO_PIN_INT, pin);
+    NVIC_ClearPendingIRQ((IRQn_Type)(PIN_INT0_IRQn + channel));
+    NVIC_EnableIRQ((IRQn_Type)(PIN_INT0_IRQn + channel));
+    return true;
+}
+
+bool DigitalInputGetEvent(digital_event_t * event) {
+    uint32_t tail = eventTail;
+
+    if (tail == eventHead) {
+        return false;
+    }
+    /* El contador de la interrupción se lee antes que el evento que publica */
+    __DMB();
+    *event = eventQueue[tail & (DIGITAL_EVENT_QUEUE_SIZE - 1)];
+    eventTail = tail + 1;
+    return true;
+}
+
+uint32_t DigitalInputGetLostEvents(void) {
+    return eventsLost;
+}
+
+void GPIO0_IRQHandler(void) {
+    InputInterrupt(0);
+}
+
+void GPIO1_IRQHandler(void) {
+    InputInterrupt(1);
+}
+
+void GPIO2_IRQHandler(void) {
+    InputInterrupt(2);
+}
+
+void GPIO3_IRQHandler(void) {
+    InputInterrupt(3);
+}
+
+void GPIO4_IRQHandler(void) {
+    InputInterrupt(4);
+}
+
+void GPIO5_IRQHandler(void) {
+    InputInterrupt(5);
+}
+
+void GPIO6_IRQHandler(void) {
+    InputInterrupt(6);
+}
+
+void GPIO7_IRQHandler(void) {
+    InputInterrupt(7);
+}
+
 /* === End of documentation ======================================================================================== */
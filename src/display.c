@@ -0,0 +1,266 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file display.c
+ ** @brief Código fuente del controlador de pantallas multiplexadas de siete segmentos
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include "display.h"
+#include "profile.h"
+#include "chip.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief Temporizador que genera la interrupción de refresco */
+#define DISPLAY_TIMER LPC_TIMER0
+
+/** @brief Interrupción del temporizador de refresco */
+#define DISPLAY_TIMER_IRQ TIMER0_IRQn
+
+/** @brief Reloj del temporizador de refresco */
+#define DISPLAY_TIMER_CLOCK CLK_MX_TIMER0
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Contenido completo de la pantalla, listo para mostrar.
+ */
+struct display_frame_s {
+    uint8_t segments[DISPLAY_MAX_DIGITS]; /**< Patrón de segmentos de cada dígito, incluido el punto decimal. */
+    uint8_t blink;                        /**< Máscara de los dígitos que parpadean. */
+    uint16_t blinkPeriod;                 /**< Barridos que dura cada mitad del parpadeo, o cero si no parpadea. */
+};
+
+/**
+ * @brief Estructura que representa una pantalla multiplexada.
+ *
+ * La interrupción solo lee el cuadro `frame[front]`. Las funciones de escritura modifican `draft` y lo copian en el
+ * otro cuadro; `pending` indica que ese cuadro está completo y la interrupción lo intercambia al comenzar un barrido.
+ */
+struct display_s {
+    uint8_t count;                                   /**< Cantidad de dígitos. */
+    const digital_pin_t * digit[DISPLAY_MAX_DIGITS]; /**< Acceso directo a la salida que enciende cada dígito. */
+    digital_output_group_t digits;                   /**< Grupo con las salidas de todos los dígitos. */
+    digital_output_group_t segments;                 /**< Grupo con las salidas de los segmentos. */
+    struct display_frame_s draft;                    /**< Cuadro en preparación, usado solo fuera de la interrupción. */
+    struct display_frame_s frame[2];                 /**< Cuadros publicados: el que se muestra y el próximo. */
+    volatile uint8_t front;                          /**< Índice del cuadro que se muestra. */
+    volatile bool pending;                           /**< Indica que el otro cuadro está listo para mostrarse. */
+    uint8_t current;                                 /**< Dígito que se enciende en el próximo refresco. */
+    uint16_t blinkCount;                             /**< Barridos transcurridos en la mitad actual del parpadeo. */
+    bool blinkOff;                                   /**< Indica que los dígitos que parpadean están apagados. */
+    uint32_t refreshCycles;                          /**< Mayor costo medido de un refresco desde la interrupción. */
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Publica el cuadro en preparación para que la interrupción lo muestre en el próximo barrido.
+ *
+ * @param self  Puntero a la instancia de la pantalla.
+ */
+static void DisplayPublish(display_t self);
+
+/* === Private variable definitions ================================================================================ */
+
+/** @brief Patrones de segmentos de los valores de 0 a 15 */
+static const uint8_t SEGMENTS[16] = {
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F,             /* 0 */
+    SEGMENT_B | SEGMENT_C,                                                             /* 1 */
+    SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G,                         /* 2 */
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G,                         /* 3 */
+    SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G,                                     /* 4 */
+    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,                         /* 5 */
+    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,             /* 6 */
+    SEGMENT_A | SEGMENT_B | SEGMENT_C,                                                 /* 7 */
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G, /* 8 */
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,             /* 9 */
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_E | SEGMENT_F | SEGMENT_G,             /* A */
+    SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,                         /* b */
+    SEGMENT_A | SEGMENT_D | SEGMENT_E | SEGMENT_F,                                     /* C */
+    SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_G,                         /* d */
+    SEGMENT_A | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,                         /* E */
+    SEGMENT_A | SEGMENT_E | SEGMENT_F | SEGMENT_G,                                     /* F */
+};
+
+/** @brief Reserva estática para las instancias de pantallas */
+static struct display_s displayPool[DISPLAY_POOL_SIZE];
+
+/** @brief Cantidad de pantallas asignadas de la reserva */
+static uint8_t displaysUsed;
+
+/** @brief Pantalla que refresca la interrupción del temporizador, o `NULL` si no hay ninguna */
+static display_t activeDisplay;
+
+/** @brief Sonda con los ciclos entre la coincidencia del temporizador y la atención de su interrupción */
+PROFILE_PROBE(displayLatency);
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void DisplayPublish(display_t self) {
+    /* Mientras no haya un cuadro pendiente la interrupción no cambia de cuadro, y el que no se muestra queda libre */
+    self->pending = false;
+    __DMB();
+    self->frame[self->front ^ 1] = self->draft;
+    __DMB();
+    self->pending = true;
+}
+
+/* === Public function implementation ============================================================================== */
+
+display_t DisplayCreate(const digital_output_t digits[], uint8_t count, const digital_output_t segments[8]) {
+    struct display_s * self;
+
+    if ((count == 0) || (count > DISPLAY_MAX_DIGITS) || (displaysUsed >= DISPLAY_POOL_SIZE)) {
+        return NULL;
+    }
+
+    /* Los grupos no se devuelven a su reserva, así que se validan los dos antes de crear el primero */
+    if (!DigitalOutputGroupIsValid(digits, count) || !DigitalOutputGroupIsValid(segments, 8)) {
+        return NULL;
+    }
+    self = &displayPool[displaysUsed];
+    self->digits = DigitalOutputGroupCreate(digits, count);
+    self->segments = DigitalOutputGroupCreate(segments, 8);
+    if ((self->digits == NULL) || (self->segments == NULL)) {
+        return NULL;
+    }
+
+    displaysUsed++;
+    self->count = count;
+    for (uint8_t index = 0; index < count; index++) {
+        self->digit[index] = DigitalOutputGetPin(digits[index]);
+    }
+    DigitalOutputGroupDeactivate(self->digits);
+    DigitalOutputGroupDeactivate(self->segments);
+    return self;
+}
+
+void DisplayWriteBcd(display_t self, const uint8_t number[], uint8_t size) {
+    for (uint8_t index = 0; index < self->count; index++) {
+        uint8_t segments = (index < size) ? SEGMENTS[number[index] & 0x0F] : 0;
+        self->draft.segments[index] = (self->draft.segments[index] & SEGMENT_P) | segments;
+    }
+    DisplayPublish(self);
+}
+
+void DisplaySetDot(display_t self, uint8_t digit, bool on) {
+    if (digit < self->count) {
+        if (on) {
+            self->draft.segments[digit] |= SEGMENT_P;
+        } else {
+            self->draft.segments[digit] &= ~SEGMENT_P;
+        }
+        DisplayPublish(self);
+    }
+}
+
+void DisplaySetBlink(display_t self, uint8_t digits, uint16_t period) {
+    self->draft.blink = digits;
+    self->draft.blinkPeriod = period;
+    DisplayPublish(self);
+}
+
+void DisplayRefresh(display_t self) {
+    const struct display_frame_s * frame;
+    uint8_t segments;
+
+    if (self->current == 0) {
+        if (self->pending) {
+            self->front ^= 1;
+            self->pending = false;
+        }
+        frame = &self->frame[self->front];
+        if (frame->blinkPeriod == 0) {
+            self->blinkOff = false;
+        } else if (++self->blinkCount >= frame->blinkPeriod) {
+            self->blinkCount = 0;
+            self->blinkOff = !self->blinkOff;
+        }
+    }
+
+    frame = &self->frame[self->front];
+    segments = frame->segments[self->current];
+    if (self->blinkOff && (frame->blink & (1 << self->current))) {
+        segments = 0;
+    }
+
+    /* Se apaga el dígito anterior antes de cambiar los segmentos para que no se vea el patrón del siguiente */
+    DigitalOutputGroupDeactivate(self->digits);
+    DigitalOutputGroupWrite(self->segments, segments);
+    DigitalPinActivate(self->digit[self->current]);
+
+    self->current = (self->current + 1 < self->count) ? self->current + 1 : 0;
+}
+
+bool DisplayStart(display_t self, uint32_t frequency) {
+    uint32_t rate = Chip_Clock_GetRate(DISPLAY_TIMER_CLOCK);
+
+    if ((frequency == 0) || (frequency > rate)) {
+        return false;
+    }
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    NVIC_DisableIRQ(DISPLAY_TIMER_IRQ);
+    activeDisplay = self;
+    PROFILE_INIT(displayLatency);
+
+    Chip_TIMER_Init(DISPLAY_TIMER);
+    Chip_TIMER_Reset(DISPLAY_TIMER);
+    Chip_TIMER_PrescaleSet(DISPLAY_TIMER, 0);
+    Chip_TIMER_SetMatch(DISPLAY_TIMER, 0, rate / frequency - 1);
+    Chip_TIMER_ResetOnMatchEnable(DISPLAY_TIMER, 0);
+    Chip_TIMER_MatchEnableInt(DISPLAY_TIMER, 0);
+    Chip_TIMER_Enable(DISPLAY_TIMER);
+
+    NVIC_ClearPendingIRQ(DISPLAY_TIMER_IRQ);
+    NVIC_EnableIRQ(DISPLAY_TIMER_IRQ);
+    return true;
+}
+
+uint32_t DisplayGetRefreshCycles(display_t self) {
+    return self->refreshCycles;
+}
+
+void TIMER0_IRQHandler(void) {
+    uint32_t start = DWT->CYCCNT;
+    uint32_t elapsed;
+
+    /* La cuenta se reinicia en cada coincidencia, así que su valor al entrar es la latencia de la interrupción */
+    PROFILE_RECORD(displayLatency, Chip_TIMER_ReadCount(DISPLAY_TIMER));
+    Chip_TIMER_ClearMatch(DISPLAY_TIMER, 0);
+    if (activeDisplay != NULL) {
+        DisplayRefresh(activeDisplay);
+        elapsed = DWT->CYCCNT - start;
+        if (elapsed > activeDisplay->refreshCycles) {
+            activeDisplay->refreshCycles = elapsed;
+        }
+    }
+}
+
+/* === End of documentation ======================================================================================== */
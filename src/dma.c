@@ -0,0 +1,92 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file dma.c
+ ** @brief Código fuente de la atención compartida de la interrupción del controlador de DMA
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "dma.h"
+#include "chipreg.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Función registrada para un canal de DMA.
+ */
+typedef struct dma_channel_s {
+    dma_handler_t handler; /**< Función que atiende las interrupciones del canal, o `NULL`. */
+    void * object;         /**< Objeto que recibe la función. */
+} dma_channel_t;
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+/** @brief Funciones registradas para cada canal */
+static dma_channel_t channels[GPDMA_NUMBER_CHANNELS];
+
+/** @brief La interrupción del controlador de DMA ya se habilitó */
+static bool enabled;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function implementation ============================================================================== */
+
+bool DmaSetHandler(uint8_t channel, dma_handler_t handler, void * object) {
+    if (channel >= GPDMA_NUMBER_CHANNELS) {
+        return false;
+    }
+    channels[channel].handler = handler;
+    channels[channel].object = object;
+    if ((handler != NULL) && !enabled) {
+        enabled = true;
+        NVIC_EnableIRQ(DMA_IRQn);
+    }
+    return true;
+}
+
+void DMA_IRQHandler(void) {
+    uint32_t completed = CHIP_REG_READ(&LPC_GPDMA->INTTCSTAT);
+    uint32_t failed = CHIP_REG_READ(&LPC_GPDMA->INTERRSTAT);
+    uint32_t pending = completed | failed;
+
+    /* Se reconocen todos los canales antes de ejecutar las funciones, que pueden comenzar otra transferencia */
+    if (completed != 0) {
+        CHIP_REG_WRITE(&LPC_GPDMA->INTTCCLEAR, completed);
+    }
+    if (failed != 0) {
+        CHIP_REG_WRITE(&LPC_GPDMA->INTERRCLR, failed);
+    }
+    for (uint8_t channel = 0; pending != 0; channel++, pending >>= 1) {
+        if ((pending & 1u) && (channels[channel].handler != NULL)) {
+            channels[channel].handler(channel, (completed & (1u << channel)) != 0, channels[channel].object);
+        }
+    }
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,219 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file expander.c
+ ** @brief Código fuente del expansor de salidas con registros de desplazamiento 74HC595
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include "expander.h"
+#include "digital.h"
+#include "dma.h"
+#include "chip.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief Controlador SSP conectado a la entrada serie de la cadena */
+#define EXPANDER_SSP LPC_SSP1
+
+/** @brief Conexión del controlador de DMA con la FIFO de transmisión del SSP */
+#define EXPANDER_DMA_TX GPDMA_CONN_SSP1_Tx
+
+/** @brief Conexión del controlador de DMA con la FIFO de recepción del SSP */
+#define EXPANDER_DMA_RX GPDMA_CONN_SSP1_Rx
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Estructura que representa un expansor de salidas.
+ *
+ * Las funciones de escritura solo modifican `frame` y marcan `dirty`. El refresco copia `frame` en `buffer` en el
+ * orden de transmisión, por lo que el DMA nunca lee datos que se están modificando.
+ */
+struct expander_s {
+    uint8_t chips;                        /**< Cantidad de registros encadenados. */
+    uint8_t transmit;                     /**< Canal de DMA que transmite la cadena. */
+    uint8_t receive;                      /**< Canal de DMA que descarta las tramas recibidas. */
+    bool dirty;                           /**< La copia tiene cambios que no se enviaron. */
+    const digital_pin_t * latch;          /**< Acceso directo al pin de carga de los registros. */
+    uint8_t frame[EXPANDER_MAX_CHIPS];    /**< Copia de las salidas de cada registro. */
+    uint8_t buffer[EXPANDER_MAX_CHIPS];   /**< Cadena en el orden de transmisión, que lee el DMA. */
+    uint8_t received[EXPANDER_MAX_CHIPS]; /**< Tramas recibidas durante la transmisión, que se descartan. */
+    uint32_t transfers;                   /**< Transferencias iniciadas. */
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Libera el canal de la transmisión, que termina cuando el último byte entra en la FIFO del SSP.
+ *
+ * @param channel    Canal de DMA de la transmisión.
+ * @param completed  `true` si la transferencia terminó; `false` si hubo un error.
+ * @param object     Puntero al expansor.
+ */
+static void ExpanderTransmitted(uint8_t channel, bool completed, void * object);
+
+/**
+ * @brief Libera el canal de la recepción, que termina con la última trama, y genera el pulso de carga.
+ *
+ * Si la transferencia terminó con un error no se genera el pulso y la cadena queda marcada para el próximo refresco.
+ *
+ * @param channel    Canal de DMA de la recepción.
+ * @param completed  `true` si la transferencia terminó; `false` si hubo un error.
+ * @param object     Puntero al expansor.
+ */
+static void ExpanderReceived(uint8_t channel, bool completed, void * object);
+
+/* === Private variable definitions ================================================================================ */
+
+/** @brief Reserva estática para las instancias de expansores */
+static struct expander_s expanderPool[EXPANDER_POOL_SIZE];
+
+/** @brief Cantidad de expansores asignados de la reserva */
+static uint8_t expandersUsed;
+
+/** @brief Expansor que ocupa el SSP con una transferencia, o `NULL` si está libre */
+static expander_t volatile active;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void ExpanderTransmitted(uint8_t channel, bool completed, void * object) {
+    (void)completed;
+    (void)object;
+    DmaSetHandler(channel, NULL, NULL);
+    Chip_GPDMA_Stop(LPC_GPDMA, channel);
+}
+
+static void ExpanderReceived(uint8_t channel, bool completed, void * object) {
+    struct expander_s * self = object;
+
+    DmaSetHandler(channel, NULL, NULL);
+    Chip_GPDMA_Stop(LPC_GPDMA, channel);
+    /* Todos los bits ya llegaron a los registros de desplazamiento */
+    if (completed) {
+        DigitalPinActivate(self->latch);
+        DigitalPinDeactivate(self->latch);
+    } else {
+        self->dirty = true;
+    }
+    active = NULL;
+}
+
+/* === Public function implementation ============================================================================== */
+
+expander_t ExpanderCreate(uint8_t chips, uint8_t latchGpio, uint8_t latchBit) {
+    struct expander_s * self;
+    digital_output_t latch;
+
+    if ((chips == 0) || (chips > EXPANDER_MAX_CHIPS) || (expandersUsed >= EXPANDER_POOL_SIZE)) {
+        return NULL;
+    }
+    latch = DigitalOutputCreate(latchGpio, latchBit);
+    if (latch == NULL) {
+        return NULL;
+    }
+
+    if (expandersUsed == 0) {
+        Chip_SSP_Init(EXPANDER_SSP);
+        Chip_SSP_SetFormat(EXPANDER_SSP, SSP_BITS_8, SSP_FRAMEFORMAT_SPI, SSP_CLOCK_MODE0);
+        Chip_SSP_SetBitRate(EXPANDER_SSP, EXPANDER_BITRATE);
+        Chip_SSP_Enable(EXPANDER_SSP);
+        Chip_SSP_DMA_Enable(EXPANDER_SSP);
+        Chip_GPDMA_Init(LPC_GPDMA);
+    }
+
+    self = &expanderPool[expandersUsed++];
+    self->chips = chips;
+    self->latch = DigitalOutputGetPin(latch);
+    for (uint8_t chip = 0; chip < chips; chip++) {
+        self->frame[chip] = 0;
+    }
+    self->dirty = true;
+    self->transfers = 0;
+    return self;
+}
+
+void ExpanderWrite(expander_t self, uint8_t chip, uint8_t mask, uint8_t value) {
+    if (chip < self->chips) {
+        self->frame[chip] = (self->frame[chip] & ~mask) | (value & mask);
+        self->dirty = true;
+    }
+}
+
+void ExpanderToggle(expander_t self, uint8_t chip, uint8_t mask) {
+    if (chip < self->chips) {
+        self->frame[chip] ^= mask;
+        self->dirty = true;
+    }
+}
+
+uint8_t ExpanderRead(expander_t self, uint8_t chip) {
+    return (chip < self->chips) ? self->frame[chip] : 0;
+}
+
+bool ExpanderRefresh(expander_t self) {
+    if (!self->dirty || (active != NULL)) {
+        return false;
+    }
+
+    /* La recepción se habilita primero para que cuente todas las tramas de la transmisión */
+    self->receive = Chip_GPDMA_GetFreeChannel(LPC_GPDMA, EXPANDER_DMA_RX);
+    if (!DmaSetHandler(self->receive, ExpanderReceived, self)) {
+        return false;
+    }
+    if (Chip_GPDMA_Transfer(LPC_GPDMA, self->receive, EXPANDER_DMA_RX, (uintptr_t)self->received,
+                            GPDMA_TRANSFERTYPE_P2M_CONTROLLER_DMA, self->chips) != SUCCESS) {
+        DmaSetHandler(self->receive, NULL, NULL);
+        return false;
+    }
+    self->transmit = Chip_GPDMA_GetFreeChannel(LPC_GPDMA, EXPANDER_DMA_TX);
+    if (!DmaSetHandler(self->transmit, ExpanderTransmitted, self)) {
+        DmaSetHandler(self->receive, NULL, NULL);
+        Chip_GPDMA_Stop(LPC_GPDMA, self->receive);
+        return false;
+    }
+
+    /* El primer byte que sale termina en el último registro de la cadena, y el bit más alto en la salida Q7 */
+    for (uint8_t index = 0; index < self->chips; index++) {
+        self->buffer[index] = self->frame[self->chips - 1 - index];
+    }
+    self->dirty = false;
+    self->transfers++;
+    active = self;
+    Chip_GPDMA_Transfer(LPC_GPDMA, self->transmit, (uintptr_t)self->buffer, EXPANDER_DMA_TX,
+                        GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA, self->chips);
+    return true;
+}
+
+bool ExpanderIsBusy(expander_t self) {
+    return active == self;
+}
+
+uint32_t ExpanderGetTransfers(expander_t self) {
+    return self->transfers;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,349 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file keypad.c
+ ** @brief Código fuente del controlador de un teclado matricial
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include "keypad.h"
+#include "chipreg.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief Temporizador que genera la interrupción de exploración */
+#define KEYPAD_TIMER LPC_TIMER3
+
+/** @brief Interrupción del temporizador de exploración */
+#define KEYPAD_TIMER_IRQ TIMER3_IRQn
+
+/** @brief Reloj del temporizador de exploración */
+#define KEYPAD_TIMER_CLOCK CLK_MX_TIMER3
+
+#if (KEYPAD_MAX_ROWS > 8) || (KEYPAD_MAX_COLUMNS > 8)
+#error "El estado del teclado se guarda en 64 bits: como máximo 8 filas de 8 columnas"
+#endif
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Estructura que representa un teclado matricial.
+ *
+ * Las palabras de 64 bits tienen un byte por fila: el bit `8 * fila + columna` corresponde a cada tecla. La
+ * interrupción escribe todas las palabras; las funciones de consulta las leen con las interrupciones enmascaradas
+ * porque el núcleo no las accede en una única operación.
+ */
+struct keypad_s {
+    uint8_t rows;                               /**< Cantidad de filas. */
+    bool activeLow;                             /**< Indica que las filas se seleccionan en nivel bajo. */
+    const digital_pin_t * row[KEYPAD_MAX_ROWS]; /**< Acceso directo a la salida de cada fila. */
+    volatile uint32_t * columnLevel;            /**< Registro PIN del puerto de las columnas. */
+    uint32_t columnMask;                        /**< Bits de las columnas en el puerto. */
+    uint32_t columnInvert;                      /**< Bits de las columnas con lógica invertida, aplicados con XOR. */
+    uint8_t columnBit[32];                      /**< Bit de columna que corresponde a cada bit del puerto. */
+    uint8_t current;                            /**< Fila seleccionada, que se lee en la próxima llamada. */
+    uint8_t samples;                            /**< Barridos consecutivos para aceptar un cambio. */
+    uint64_t sample;                            /**< Lectura del barrido en curso. */
+    uint64_t state;                             /**< Estado filtrado de las teclas. */
+    uint64_t ghosts;                            /**< Teclas con lectura ambigua en el último barrido. */
+    uint64_t pressed;                           /**< Teclas presionadas desde la última consulta. */
+    uint64_t released;                          /**< Teclas soltadas desde la última consulta. */
+    uint64_t counter[DIGITAL_DEBOUNCE_BITS];    /**< Planos del contador vertical de barridos estables. */
+    uint32_t scanCycles;                        /**< Mayor costo medido de un barrido completo desde la interrupción. */
+    uint32_t scanAccumulated;                   /**< Costo acumulado del barrido en curso desde la interrupción. */
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Selecciona o libera una fila del teclado.
+ *
+ * @param self    Puntero a la instancia del teclado.
+ * @param row     Número de fila.
+ * @param select  `true` para seleccionar la fila; `false` para liberarla.
+ */
+static void KeypadSelect(keypad_t self, uint8_t row, bool select);
+
+/**
+ * @brief Busca las teclas con lectura ambigua en la lectura de un barrido.
+ *
+ * @param sample  Lectura del barrido, con un byte por fila.
+ * @param rows    Cantidad de filas.
+ * @return Palabra con las cuatro esquinas de cada rectángulo de teclas presionadas.
+ */
+static uint64_t KeypadGhosts(uint64_t sample, uint8_t rows);
+
+/**
+ * @brief Filtra la lectura de un barrido con un contador vertical de 64 bits.
+ *
+ * Es el mismo filtro que aplican los bancos de entradas digitales a cada puerto: el contador de una tecla avanza
+ * mientras la lectura difiere del estado filtrado, vuelve a cero cuando coinciden y, al llegar a `samples`, el estado
+ * filtrado de la tecla cambia.
+ *
+ * @param self    Puntero a la instancia del teclado.
+ * @param sample  Lectura del barrido.
+ * @return Nuevo estado filtrado.
+ */
+static uint64_t KeypadDebounce(keypad_t self, uint64_t sample);
+
+/**
+ * @brief Actualiza el estado del teclado al completar un barrido.
+ *
+ * @param self  Puntero a la instancia del teclado.
+ */
+static void KeypadProcess(keypad_t self);
+
+/* === Private variable definitions ================================================================================ */
+
+/** @brief Reserva estática para las instancias de teclados */
+static struct keypad_s keypadPool[KEYPAD_POOL_SIZE];
+
+/** @brief Cantidad de teclados asignados de la reserva */
+static uint8_t keypadsUsed;
+
+/** @brief Teclado que explora la interrupción del temporizador, o `NULL` si no hay ninguno */
+static keypad_t activeKeypad;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void KeypadSelect(keypad_t self, uint8_t row, bool select) {
+    if (select != self->activeLow) {
+        DigitalPinActivate(self->row[row]);
+    } else {
+        DigitalPinDeactivate(self->row[row]);
+    }
+}
+
+static uint64_t KeypadGhosts(uint64_t sample, uint8_t rows) {
+    uint64_t ghosts = 0;
+
+    /* Solo las filas con dos o más teclas presionadas pueden formar un rectángulo */
+    for (uint8_t first = 0; first < rows; first++) {
+        uint8_t keys = sample >> (8 * first);
+
+        if ((keys & (keys - 1)) == 0) {
+            continue;
+        }
+        for (uint8_t second = first + 1; second < rows; second++) {
+            uint8_t common = keys & (uint8_t)(sample >> (8 * second));
+
+            if ((common & (common - 1)) != 0) {
+                ghosts |= ((uint64_t)common << (8 * first)) | ((uint64_t)common << (8 * second));
+            }
+        }
+    }
+    return ghosts;
+}
+
+static uint64_t KeypadDebounce(keypad_t self, uint64_t sample) {
+    uint64_t delta = sample ^ self->state;
+    uint64_t carry = delta;
+    uint64_t done = delta;
+
+    for (uint8_t plane = 0; plane < DIGITAL_DEBOUNCE_BITS; plane++) {
+        self->counter[plane] ^= carry;
+        carry &= ~self->counter[plane];
+        self->counter[plane] &= delta;
+        done &= (self->samples & (1u << plane)) ? self->counter[plane] : ~self->counter[plane];
+    }
+    for (uint8_t plane = 0; plane < DIGITAL_DEBOUNCE_BITS; plane++) {
+        self->counter[plane] &= ~done;
+    }
+    return self->state ^ done;
+}
+
+static void KeypadProcess(keypad_t self) {
+    uint64_t previous = self->state;
+    uint64_t sample = self->sample;
+
+    /* Las teclas ambiguas conservan su estado y no hacen avanzar su filtro */
+    self->ghosts = KeypadGhosts(sample, self->rows);
+    sample = (sample & ~self->ghosts) | (previous & self->ghosts);
+    self->state = KeypadDebounce(self, sample);
+    self->pressed |= self->state & ~previous;
+    self->released |= previous & ~self->state;
+    self->sample = 0;
+}
+
+/* === Public function implementation ============================================================================== */
+
+keypad_t KeypadCreate(const digital_output_t rows[], uint8_t rowCount, const digital_input_t columns[],
+                      uint8_t columnCount, bool activeLow) {
+    struct keypad_s * self;
+
+    if ((rows == NULL) || (columns == NULL) || (rowCount == 0) || (rowCount > KEYPAD_MAX_ROWS) ||
+        (columnCount == 0) || (columnCount > KEYPAD_MAX_COLUMNS) || (keypadsUsed >= KEYPAD_POOL_SIZE)) {
+        return NULL;
+    }
+
+    /* La instancia se toma de la reserva y solo se confirma cuando las columnas resultan válidas */
+    self = &keypadPool[keypadsUsed];
+    self->columnLevel = NULL;
+    self->columnMask = 0;
+    self->columnInvert = 0;
+    for (uint8_t column = 0; column < columnCount; column++) {
+        const digital_pin_t * pin = (columns[column] != NULL) ? DigitalInputGetPin(columns[column]) : NULL;
+
+        if ((pin == NULL) || ((self->columnLevel != NULL) && (pin->level != self->columnLevel)) ||
+            (self->columnMask & pin->mask)) {
+            return NULL;
+        }
+        self->columnLevel = pin->level;
+        self->columnMask |= pin->mask;
+        self->columnInvert |= pin->invert;
+        self->columnBit[__builtin_ctz(pin->mask)] = 1u << column;
+    }
+    for (uint8_t row = 0; row < rowCount; row++) {
+        self->row[row] = (rows[row] != NULL) ? DigitalOutputGetPin(rows[row]) : NULL;
+        if (self->row[row] == NULL) {
+            return NULL;
+        }
+    }
+
+    keypadsUsed++;
+    self->rows = rowCount;
+    self->activeLow = activeLow;
+    self->samples = 1;
+    for (uint8_t row = 0; row < rowCount; row++) {
+        KeypadSelect(self, row, row == 0);
+    }
+    return self;
+}
+
+bool KeypadSetDebounce(keypad_t self, uint8_t samples) {
+    if ((samples == 0) || (samples >= (1u << DIGITAL_DEBOUNCE_BITS))) {
+        return false;
+    }
+    self->samples = samples;
+    return true;
+}
+
+void KeypadScanRow(keypad_t self) {
+    uint32_t active = (CHIP_REG_READ(self->columnLevel) ^ self->columnInvert) & self->columnMask;
+    uint8_t columns = 0;
+    uint8_t next = (self->current + 1 < self->rows) ? self->current + 1 : 0;
+
+    /* Solo se recorren las columnas activas, como mucho tantas como columnas tiene el teclado */
+    for (; active != 0; active &= active - 1) {
+        columns |= self->columnBit[__builtin_ctz(active)];
+    }
+    self->sample |= (uint64_t)columns << (8 * self->current);
+
+    KeypadSelect(self, self->current, false);
+    KeypadSelect(self, next, true);
+    self->current = next;
+    if (next == 0) {
+        KeypadProcess(self);
+    }
+}
+
+bool KeypadStart(keypad_t self, uint32_t frequency) {
+    uint32_t rate = Chip_Clock_GetRate(KEYPAD_TIMER_CLOCK);
+
+    if ((frequency == 0) || (frequency > rate)) {
+        return false;
+    }
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    NVIC_DisableIRQ(KEYPAD_TIMER_IRQ);
+    activeKeypad = self;
+    self->scanAccumulated = 0;
+
+    Chip_TIMER_Init(KEYPAD_TIMER);
+    Chip_TIMER_Reset(KEYPAD_TIMER);
+    Chip_TIMER_PrescaleSet(KEYPAD_TIMER, 0);
+    Chip_TIMER_SetMatch(KEYPAD_TIMER, 0, rate / frequency - 1);
+    Chip_TIMER_ResetOnMatchEnable(KEYPAD_TIMER, 0);
+    Chip_TIMER_MatchEnableInt(KEYPAD_TIMER, 0);
+    Chip_TIMER_Enable(KEYPAD_TIMER);
+
+    NVIC_ClearPendingIRQ(KEYPAD_TIMER_IRQ);
+    NVIC_EnableIRQ(KEYPAD_TIMER_IRQ);
+    return true;
+}
+
+uint64_t KeypadGetState(keypad_t self) {
+    uint64_t state;
+
+    __disable_irq();
+    state = self->state;
+    __enable_irq();
+    return state;
+}
+
+uint64_t KeypadGetPressed(keypad_t self) {
+    uint64_t pressed;
+
+    __disable_irq();
+    pressed = self->pressed;
+    self->pressed = 0;
+    __enable_irq();
+    return pressed;
+}
+
+uint64_t KeypadGetReleased(keypad_t self) {
+    uint64_t released;
+
+    __disable_irq();
+    released = self->released;
+    self->released = 0;
+    __enable_irq();
+    return released;
+}
+
+uint64_t KeypadGetGhosts(keypad_t self) {
+    uint64_t ghosts;
+
+    __disable_irq();
+    ghosts = self->ghosts;
+    __enable_irq();
+    return ghosts;
+}
+
+uint32_t KeypadGetScanCycles(keypad_t self) {
+    return self->scanCycles;
+}
+
+void TIMER3_IRQHandler(void) {
+    uint32_t start = DWT->CYCCNT;
+
+    Chip_TIMER_ClearMatch(KEYPAD_TIMER, 0);
+    if (activeKeypad != NULL) {
+        KeypadScanRow(activeKeypad);
+        activeKeypad->scanAccumulated += DWT->CYCCNT - start;
+        /* Al volver a la primera fila terminó un barrido completo */
+        if (activeKeypad->current == 0) {
+            if (activeKeypad->scanAccumulated > activeKeypad->scanCycles) {
+                activeKeypad->scanCycles = activeKeypad->scanAccumulated;
+            }
+            activeKeypad->scanAccumulated = 0;
+        }
+    }
+}
+
+/* === End of documentation ======================================================================================== */
@@ -42,59 +42,579 @@
 
 #include "chip.h"
 #include <stdbool.h>
+#include "config.h"
 #include "digital.h"
 #include "bsp.h"
+#include "scheduler.h"
+#include "clock.h"
+#include "settings.h"
+#include "softtimer.h"
+#include "display.h"
+#include "pwm.h"
+#include "profile.h"
+#include "trace.h"
+#include "console.h"
+#include <stdlib.h>
 
 /* === Macros definitions ====================================================================== */
 
+/** @brief Período de la exploración de las teclas en ticks del planificador */
+#define KEYS_PERIOD 5
+
+/** @brief Período de los ticks del reloj en ticks del planificador */
+#define CLOCK_PERIOD 10
+
+/** @brief Período de los cambios de brillo del LED verde en ticks del planificador */
+#define BREATHE_PERIOD 4
+
+/** @brief Período de actualización de la hora en la pantalla en ticks del planificador */
+#define VIEW_PERIOD 100
+
+/** @brief Período con que se guardan los ajustes del reloj en ticks de los temporizadores de software */
+#define SETTINGS_PERIOD 10
+
+/** @brief Período del servicio de temporizadores de software en ticks del planificador, que fija su resolución */
+#define SOFT_TIMER_PERIOD 10
+
+/** @brief Período de atención de la consola en ticks del planificador */
+#define CONSOLE_PERIOD 10
+
+/** @brief Primera página de la EEPROM asignada a los ajustes del reloj */
+#define SETTINGS_FIRST_PAGE 0
+
+/** @brief Páginas de la EEPROM asignadas a los ajustes del reloj, con ocho registros cada una */
+#define SETTINGS_PAGES 16
+
+/** @brief Versión del formato de los ajustes del reloj, que cambia cuando cambia `clock_settings_t` */
+#define SETTINGS_VERSION 1
+
+/** @brief Bit de `flags` en los ajustes del reloj que indica que la alarma está habilitada */
+#define SETTINGS_ALARM_ENABLED (1u << 0)
+
+/** @brief Período del informe de mediciones en el backend simulado, en ticks del planificador */
+#ifndef REPORT_PERIOD
+#define REPORT_PERIOD 10000
+#endif
+
 /* === Private data type declarations ========================================================== */
 
+/**
+ * @brief Objetos que usa la tarea que muestra la hora.
+ */
+typedef struct clock_view_s {
+    clk_t clock;       /**< Reloj que se muestra */
+    display_t display; /**< Pantalla en la que se muestra */
+} clock_view_t;
+
+/**
+ * @brief Ajustes del reloj que se conservan sin alimentación.
+ *
+ * Todos los campos son palabras completas, para que la estructura no tenga relleno y se pueda comparar byte a byte.
+ */
+typedef struct clock_settings_s {
+    uint32_t alarm; /**< Hora de la alarma con el formato `0x00HHMMSS` */
+    uint32_t flags; /**< Indicadores, como `SETTINGS_ALARM_ENABLED` */
+} clock_settings_t;
+
+/**
+ * @brief Objetos que usa el temporizador que guarda los ajustes del reloj.
+ */
+typedef struct settings_task_s {
+    clk_t clock;         /**< Reloj cuyos ajustes se guardan */
+    settings_t settings; /**< Almacenamiento de los ajustes */
+} settings_task_t;
+
 /* === Private variable declarations =========================================================== */
 
 /* === Private function declarations =========================================================== */
 
+/**
+ * @brief Tarea que explora las teclas. Los LEDs que dependen de ellas se actualizan en las funciones que el banco de
+ * teclas ejecuta ante cada cambio.
+ *
+ * @param object  Puntero a la estructura de la placa.
+ */
+static void KeysTask(void * object);
+
+/**
+ * @brief Enciende un LED cuando cambia una tecla.
+ *
+ * @param input   Tecla que cambió.
+ * @param object  Salida digital del LED.
+ */
+static void LedOnHandler(digital_input_t input, void * object);
+
+/**
+ * @brief Apaga un LED cuando cambia una tecla.
+ *
+ * @param input   Tecla que cambió.
+ * @param object  Salida digital del LED.
+ */
+static void LedOffHandler(digital_input_t input, void * object);
+
+/**
+ * @brief Cambia el estado del LED amarillo cuando cambia una tecla.
+ *
+ * El pin se conoce en tiempo de compilación, así que el cambio es una única escritura en el registro NOT de su puerto.
+ *
+ * @param input   Tecla que cambió.
+ * @param object  No se usa.
+ */
+static void LedToggleHandler(digital_input_t input, void * object);
+
+/**
+ * @brief Tarea que avanza un tick el servicio de temporizadores de software, que atiende las tareas poco frecuentes sin
+ * ocupar un lugar del planificador.
+ *
+ * @param object  No se usa.
+ */
+static void SoftTimerTask(void * object);
+
+/**
+ * @brief Tarea que hace avanzar el reloj.
+ *
+ * @param object  Puntero a la instancia del reloj.
+ */
+static void ClockTask(void * object);
+
+/**
+ * @brief Tarea que aumenta y disminuye gradualmente el brillo del LED verde.
+ *
+ * @param object  Puntero a la instancia de modulación del LED verde.
+ */
+static void BreatheTask(void * object);
+
+/**
+ * @brief Tarea que muestra las horas y los minutos del reloj en la pantalla.
+ *
+ * El punto del segundo dígito se enciende en los segundos pares. Mientras la hora no es válida los dígitos parpadean.
+ *
+ * @param object  Puntero a la estructura con el reloj y la pantalla.
+ */
+static void ViewTask(void * object);
+
+/**
+ * @brief Restaura los ajustes del reloj guardados en la EEPROM.
+ *
+ * @param clock     Reloj que recibe los ajustes.
+ * @param settings  Almacenamiento de los ajustes.
+ */
+static void SettingsRestore(clk_t clock, settings_t settings);
+
+/**
+ * @brief Función del temporizador periódico que copia los ajustes del reloj en su almacenamiento y atiende las
+ * grabaciones pendientes.
+ *
+ * Los ajustes solo se graban cuando cambian, y una serie de cambios seguidos se graba una única vez.
+ *
+ * @param timer   Temporizador que venció.
+ * @param object  Puntero a la estructura con el reloj y el almacenamiento.
+ */
+static void SettingsTimer(soft_timer_t timer, void * object);
+
+/**
+ * @brief Marca el primer tick del planificador como fin del arranque y envía por las trazas el instante en que terminó
+ * cada etapa, en microsegundos desde el origen del contador de ciclos.
+ */
+static void BootReport(void);
+
+/**
+ * @brief Tarea que ejecuta los comandos recibidos por la consola y continúa la transmisión de las respuestas.
+ *
+ * @param object  Puntero a la consola.
+ */
+static void ConsoleTask(void * object);
+
+/**
+ * @brief Interpreta una palabra de la consola con el formato `HH:MM` o `HH:MM:SS` como una hora en BCD.
+ *
+ * Solo se verifica que haya dígitos en las posiciones esperadas; el rango de cada campo lo verifica el reloj.
+ *
+ * @param line   Línea recibida.
+ * @param index  Número de la palabra con la hora.
+ * @param time   Estructura donde se guarda la hora.
+ * @return `true` si la palabra tiene el formato esperado; `false` en caso contrario.
+ */
+static bool ConsoleParseTime(const console_line_t * line, uint8_t index, clock_time_t * time);
+
+/**
+ * @brief Comando `hora`: muestra la hora del reloj o la ajusta.
+ *
+ * @param console  Consola que recibió el comando.
+ * @param line     Línea recibida.
+ * @param object   Puntero a la instancia del reloj.
+ */
+static void TimeCommand(console_t console, const console_line_t * line, void * object);
+
+/**
+ * @brief Comando `alarma`: muestra la alarma, la ajusta, la habilita o la deshabilita.
+ *
+ * @param console  Consola que recibió el comando.
+ * @param line     Línea recibida.
+ * @param object   Puntero a la instancia del reloj.
+ */
+static void AlarmCommand(console_t console, const console_line_t * line, void * object);
+
+/**
+ * @brief Escribe una línea del informe de las sondas de medición en la consola.
+ *
+ * @param object  Consola de salida.
+ * @param text    Línea a escribir.
+ */
+static void ConsoleWriter(void * object, const char * text);
+
+/**
+ * @brief Comando `perfil`: muestra las estadísticas de las sondas de medición y la duración de las etapas del arranque.
+ *
+ * @param console  Consola que recibió el comando.
+ * @param line     Línea recibida.
+ * @param object   No se usa.
+ */
+static void ProfileCommand(console_t console, const console_line_t * line, void * object);
+
+/**
+ * @brief Comando `trazas`: muestra los contadores del registro de trazas.
+ *
+ * @param console  Consola que recibió el comando.
+ * @param line     Línea recibida.
+ * @param object   No se usa.
+ */
+static void TraceCommand(console_t console, const console_line_t * line, void * object);
+
+#ifdef CHIP_SIMULATED
+/**
+ * @brief Escribe una línea del informe de las sondas de medición en el informe de la simulación.
+ *
+ * @param object  No se usa.
+ * @param text    Línea a escribir.
+ */
+static void ReportWriter(void * object, const char * text);
+
+/**
+ * @brief Tarea que informa en la salida estándar las estadísticas de las sondas de medición, la duración de las etapas
+ * del arranque y la fracción del tiempo en que el núcleo estuvo en reposo.
+ *
+ * @param object  No se usa.
+ */
+static void ReportTask(void * object);
+#endif
+
 /* === Public variable definitions ============================================================= */
 
 /* === Private variable definitions ============================================================ */
 
+/** @brief Sonda con el costo de cada iteración del lazo principal */
+PROFILE_PROBE(mainLoop);
+
+/** @brief Sonda con el costo de explorar las teclas y ejecutar las funciones de sus cambios */
+PROFILE_PROBE(keysScan);
+
+/** @brief Sonda con el costo de cambiar el estado de un LED */
+PROFILE_PROBE(outputToggle);
+
+/** @brief Comandos de la consola, que reciben el reloj como objeto */
+static const console_command_t commands[] = {
+    {.name = "hora", .help = "[HH:MM[:SS]] muestra o ajusta la hora", .handler = TimeCommand},
+    {.name = "alarma", .help = "[HH:MM[:SS] | habilitar | deshabilitar] muestra o ajusta la alarma",
+     .handler = AlarmCommand},
+    {.name = "perfil", .help = "muestra las mediciones de las sondas y del arranque", .handler = ProfileCommand},
+    {.name = "trazas", .help = "muestra los contadores de las trazas", .handler = TraceCommand},
+};
+
 /* === Private function implementation ========================================================= */
 
+static void KeysTask(void * object) {
+    board_t board = object;
+
+    PROFILE_BEGIN(keysScan);
+    DigitalInputBankScan(board->keys);
+    PROFILE_END(keysScan);
+}
+
+static void LedOnHandler(digital_input_t input, void * object) {
+    (void)input;
+    DigitalOutputActivate(object);
+}
+
+static void LedOffHandler(digital_input_t input, void * object) {
+    (void)input;
+    DigitalOutputDeactivate(object);
+}
+
+static void LedToggleHandler(digital_input_t input, void * object) {
+    (void)input;
+    (void)object;
+    PROFILE_BEGIN(outputToggle);
+    BOARD_PIN_TOGGLE(LED_1);
+    PROFILE_END(outputToggle);
+    TRACE(TRACE_OUTPUT_TOGGLE, TRACE_PIN(LED_1_GPIO, LED_1_BIT));
+}
+
+static void SoftTimerTask(void * object) {
+    (void)object;
+    SoftTimerTick();
+}
+
+static void ClockTask(void * object) {
+    ClockTick(object);
+}
+
+static void BreatheTask(void * object) {
+    static bool rising = true;
+    pwm_t pwm = object;
+    uint8_t level = PwmGetLevel(pwm, 0);
+
+    if ((rising && (level == UINT8_MAX)) || (!rising && (level == 0))) {
+        rising = !rising;
+    }
+    PwmSetLevel(pwm, 0, rising ? level + 1 : level - 1);
+}
+
+static void ViewTask(void * object) {
+    const clock_view_t * view = object;
+    clock_time_t now;
+    bool valid = ClockGetTime(view->clock, &now);
+    uint8_t digits[] = {
+        now.time.hours >> 4,
+        now.time.hours & 0x0F,
+        now.time.minutes >> 4,
+        now.time.minutes & 0x0F,
+    };
+
+    DisplaySetBlink(view->display, valid ? 0 : 0x0F, DISPLAY_BLINK_PERIOD);
+    DisplaySetDot(view->display, 1, (now.time.seconds & 0x01) == 0);
+    DisplayWriteBcd(view->display, digits, sizeof(digits));
+}
+
+static void SettingsRestore(clk_t clock, settings_t settings) {
+    clock_settings_t saved;
+    clock_time_t alarm;
+
+    if (SettingsLoad(settings, &saved)) {
+        alarm.bcd = saved.alarm;
+        ClockSetAlarm(clock, &alarm);
+        ClockEnableAlarm(clock, (saved.flags & SETTINGS_ALARM_ENABLED) != 0);
+    }
+}
+
+static void SettingsTimer(soft_timer_t timer, void * object) {
+    const settings_task_t * task = object;
+    clock_settings_t current;
+    clock_time_t alarm;
+
+    (void)timer;
+    current.flags = ClockGetAlarm(task->clock, &alarm) ? SETTINGS_ALARM_ENABLED : 0;
+    current.alarm = alarm.bcd;
+    SettingsSave(task->settings, &current);
+    SettingsService(task->settings);
+}
+
+static void BootReport(void) {
+    profile_boot_phase_t phases[PROFILE_BOOT_PHASES];
+    uint8_t count;
+
+    PROFILE_BOOT("tick");
+    count = ProfileBootGetPhases(phases);
+    for (uint8_t index = 0; index < count; index++) {
+        TRACE(TRACE_BOOT_PHASE, phases[index].cycles / (SystemCoreClock / 1000000));
+    }
+}
+
+static void ConsoleTask(void * object) {
+    ConsoleService(object);
+}
+
+static bool ConsoleParseTime(const console_line_t * line, uint8_t index, clock_time_t * time) {
+    uint8_t length = ConsoleArgLength(line, index);
+
+    if (((length != 5) && (length != 8)) || (ConsoleArgChar(line, index, 2) != ':') ||
+        ((length == 8) && (ConsoleArgChar(line, index, 5) != ':'))) {
+        return false;
+    }
+    time->bcd = 0;
+    for (uint8_t offset = 0; offset < 8; offset++) {
+        char digit = (offset < length) ? ConsoleArgChar(line, index, offset) : '0';
+
+        if ((offset % 3) == 2) {
+            continue;
+        }
+        if ((digit < '0') || (digit > '9')) {
+            return false;
+        }
+        time->bcd = (time->bcd << 4) | (uint32_t)(digit - '0');
+    }
+    return true;
+}
+
+static void TimeCommand(console_t console, const console_line_t * line, void * object) {
+    clock_time_t time;
+
+    if (ConsoleArgCount(line) == 1) {
+        bool valid = ClockGetTime(object, &time);
+        ConsolePrintf(console, "hora %02X:%02X:%02X%s\n", time.time.hours, time.time.minutes, time.time.seconds,
+                      valid ? "" : " (no válida)");
+    } else if ((ConsoleArgCount(line) == 2) && ConsoleParseTime(line, 1, &time)) {
+        ConsoleWrite(console, ClockSetTime(object, &time) ? "ok\n" : "error: hora no válida\n");
+    } else {
+        ConsoleWrite(console, "uso: hora [HH:MM[:SS]]\n");
+    }
+}
+
+static void AlarmCommand(console_t console, const console_line_t * line, void * object) {
+    clock_time_t alarm;
+
+    if (ConsoleArgCount(line) == 1) {
+        bool enabled = ClockGetAlarm(object, &alarm);
+        ConsolePrintf(console, "alarma %02X:%02X:%02X %s\n", alarm.time.hours, alarm.time.minutes, alarm.time.seconds,
+                      enabled ? "habilitada" : "deshabilitada");
+    } else if (ConsoleArgCount(line) != 2) {
+        ConsoleWrite(console, "uso: alarma [HH:MM[:SS] | habilitar | deshabilitar]\n");
+    } else if (ConsoleArgIs(line, 1, "habilitar") || ConsoleArgIs(line, 1, "deshabilitar")) {
+        ClockEnableAlarm(object, ConsoleArgIs(line, 1, "habilitar"));
+        ConsoleWrite(console, "ok\n");
+    } else if (ConsoleParseTime(line, 1, &alarm)) {
+        ConsoleWrite(console, ClockSetAlarm(object, &alarm) ? "ok\n" : "error: hora no válida\n");
+    } else {
+        ConsoleWrite(console, "uso: alarma [HH:MM[:SS] | habilitar | deshabilitar]\n");
+    }
+}
+
+static void ConsoleWriter(void * object, const char * text) {
+    ConsoleWrite(object, text);
+}
+
+static void ProfileCommand(console_t console, const console_line_t * line, void * object) {
+    (void)line;
+    (void)object;
+    ProfileDump(ConsoleWriter, console);
+    ProfileBootDump(ConsoleWriter, console);
+}
+
+static void TraceCommand(console_t console, const console_line_t * line, void * object) {
+    (void)line;
+    (void)object;
+#if TRACE_ENABLED
+    trace_stats_t trace;
+    TraceGetStats(&trace);
+    ConsolePrintf(console, "trazas: %lu registradas, %lu enviadas, %lu perdidas\n", (unsigned long)trace.recorded,
+                  (unsigned long)trace.sent, (unsigned long)trace.lost);
+#else
+    ConsoleWrite(console, "trazas deshabilitadas\n");
+#endif
+}
+
+#ifdef CHIP_SIMULATED
+static void ReportWriter(void * object, const char * text) {
+    (void)object;
+    SimReportPrintf("%s", text);
+}
+
+static void ReportTask(void * object) {
+    scheduler_idle_stats_t idle;
+    sim_eeprom_stats_t eeprom;
+
+    (void)object;
+    ProfileDump(ReportWriter, NULL);
+    ProfileBootDump(ReportWriter, NULL);
+    SchedulerGetIdleStats(&idle);
+    SimReportPrintf("reposo: %.2f %% del tiempo en %lu entradas a WFI (simulador: %.2f %%)\n",
+                    100.0 * idle.sleepCycles / idle.totalCycles, (unsigned long)idle.sleeps,
+                    100.0 * SimGetSleepCycles() / SimGetCycles());
+    SimEepromGetStats(&eeprom);
+    SimReportPrintf("eeprom: %lu programaciones, %lu palabras\n", (unsigned long)eeprom.programs,
+                    (unsigned long)eeprom.words);
+#if TRACE_ENABLED
+    trace_stats_t trace;
+    TraceGetStats(&trace);
+    SimReportPrintf("trazas: %lu registradas, %lu enviadas, %lu perdidas\n", (unsigned long)trace.recorded,
+                    (unsigned long)trace.sent, (unsigned long)trace.lost);
+#endif
+}
+#endif
+
 /* === Public function implementation ========================================================= */
 
 int main(void) {
+    /* Las etapas del arranque se marcan hasta el primer tick, cuando la pantalla ya muestra la hora */
+    PROFILE_BOOT("inicio");
     board_t board = BoardCreate();
-    int divisor = 0;
+    PROFILE_BOOT("pines");
+    /* Sin los pines de la placa no hay nada que hacer; las reservas de config.h no alcanzan */
+    if (board == NULL) {
+        return EXIT_FAILURE;
+    }
+    clk_t clock = ClockCreate(SCHEDULER_TICK_HZ / CLOCK_PERIOD);
+    static clock_view_t view;
+    static settings_task_t store;
+    const digital_output_t leds[] = {board->led_green};
+    pwm_t pwm = PwmCreate(leds, sizeof(leds) / sizeof(leds[0]));
 
-    while (true) {
-        if (DigitalInputGetIsActive(board->tec_1)) {
-            DigitalOutputActivate(board->led_blue);
-        } else {
-            DigitalOutputDeactivate(board->led_blue);
-        }
+    static const digital_input_handlers_t follow = {.activated = LedOnHandler, .deactivated = LedOffHandler};
+    static const digital_input_handlers_t toggle = {.activated = LedToggleHandler};
+    static const digital_input_handlers_t turnOn = {.activated = LedOnHandler};
+    static const digital_input_handlers_t turnOff = {.activated = LedOffHandler};
 
-        if (DigitalInputWasActivated(board->tec_2)) {
-            DigitalOutputToggle(board->led_yellow);
-        }
+    /* Los cambios de estos LEDs se acumulan durante cada ciclo y se escriben juntos al final, solo si cambiaron */
+    DigitalOutputSetDeferred(board->led_blue, true);
+    DigitalOutputSetDeferred(board->led_red, true);
 
-        if (DigitalInputGetIsActive(board->tec_3)) {
-            DigitalOutputActivate(board->led_red);
-        }
+    /* El LED azul sigue a la tecla 1, la tecla 2 conmuta el amarillo y las teclas 3 y 4 encienden y apagan el rojo */
+    DigitalInputSetHandlers(board->tec_1, &follow, board->led_blue);
+    DigitalInputSetHandlers(board->tec_2, &toggle, NULL);
+    DigitalInputSetHandlers(board->tec_3, &turnOn, board->led_red);
+    DigitalInputSetHandlers(board->tec_4, &turnOff, board->led_red);
 
-        if (DigitalInputGetIsActive(board->tec_4)) {
-            DigitalOutputDeactivate(board->led_red);
-        }
+    view.clock = clock;
+    view.display = board->display;
+    DisplayStart(board->display, DISPLAY_REFRESH_HZ);
+    PwmStart(pwm, PWM_FREQUENCY_HZ);
 
-        divisor++;
-        if (divisor == 5) {
-            divisor = 0;
-            DigitalOutputToggle(board->led_green);
-        }
+    PROFILE_INIT(mainLoop);
+    PROFILE_INIT(keysScan);
+    PROFILE_INIT(outputToggle);
 
-        for (int index = 0; index < 100; index++) {
-            for (int delay = 0; delay < 25000; delay++) {
-                __asm("NOP");
-            }
+#ifdef CHIP_SIMULATED
+    /* El backend simulado conecta las trazas, la consola y la EEPROM a lo que indican las variables de entorno */
+    SimConfigureFromEnvironment(LPC_USART3, LPC_USART2);
+#endif
+    TRACE_START();
+
+    store.clock = clock;
+    store.settings = SettingsCreate(SETTINGS_FIRST_PAGE, SETTINGS_PAGES, SETTINGS_VERSION, sizeof(clock_settings_t));
+    SettingsRestore(clock, store.settings);
+    PROFILE_BOOT("ajustes");
+    console_t console = ConsoleCreate(commands, sizeof(commands) / sizeof(commands[0]), clock);
+    soft_timer_t saver = SoftTimerCreate(SettingsTimer, &store);
+    if (saver != NULL) {
+        SoftTimerStart(saver, SETTINGS_PERIOD, SETTINGS_PERIOD);
+    }
+
+    SchedulerInit(SCHEDULER_TICK_HZ);
+    SchedulerTaskCreate(ClockTask, clock, CLOCK_PERIOD, 0);
+    SchedulerTaskCreate(SoftTimerTask, NULL, SOFT_TIMER_PERIOD, 0);
+    SchedulerTaskCreate(KeysTask, (void *)board, KEYS_PERIOD, 0);
+    SchedulerTaskCreate(BreatheTask, pwm, BREATHE_PERIOD, 0);
+    SchedulerTaskCreate(ViewTask, &view, VIEW_PERIOD, 0);
+    if (console != NULL) {
+        SchedulerTaskCreate(ConsoleTask, console, CONSOLE_PERIOD, 0);
+    }
+#ifdef CHIP_SIMULATED
+    SchedulerTaskCreate(ReportTask, NULL, REPORT_PERIOD, REPORT_PERIOD - 1);
+#endif
+    PROFILE_BOOT("tareas");
+
+    bool booted = false;
+    while (true) {
+        if (!booted && (SchedulerGetTicks() != 0)) {
+            booted = true;
+            BootReport();
         }
+        PROFILE_BEGIN(mainLoop);
+        SchedulerDispatch();
+        DigitalOutputCommit();
+        PROFILE_END(mainLoop);
+        TRACE_FLUSH();
+        SchedulerIdle();
     }
 }
 
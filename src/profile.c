@@ -0,0 +1,227 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file profile.c
+ ** @brief Código fuente de la medición de tiempos de ejecución con el contador de ciclos del DWT
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include "profile.h"
+#include "chip.h"
+#include <stddef.h>
+#include <stdio.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief Longitud máxima de una línea del informe, incluido el terminador */
+#define PROFILE_LINE_SIZE 256
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Estructura que representa una sonda de medición.
+ */
+struct profile_probe_s {
+    const char * name;                             /**< Nombre de la sonda. */
+    uint32_t count;                                /**< Cantidad de mediciones. */
+    uint32_t min;                                  /**< Menor medición, en ciclos. */
+    uint32_t max;                                  /**< Mayor medición, en ciclos. */
+    uint64_t total;                                /**< Suma de las mediciones, para calcular el promedio. */
+    uint32_t histogram[PROFILE_HISTOGRAM_BUCKETS]; /**< Cantidad de mediciones en cada intervalo. */
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Calcula el intervalo del histograma que corresponde a una medición.
+ *
+ * @param cycles  Duración medida, en ciclos.
+ * @return Posición del intervalo en el histograma.
+ */
+static uint8_t ProfileBucket(uint32_t cycles);
+
+/**
+ * @brief Habilita el contador de ciclos del DWT si aún no está habilitado.
+ */
+static void ProfileCounterStart(void);
+
+/* === Private variable definitions ================================================================================ */
+
+/** @brief Reserva estática para las instancias de sondas */
+static struct profile_probe_s probePool[PROFILE_POOL_SIZE];
+
+/** @brief Cantidad de sondas asignadas de la reserva */
+static uint8_t probesUsed;
+
+/** @brief Ciclos que insume una medición vacía, que se descuentan de cada medición */
+static uint32_t overhead;
+
+/** @brief Marcas de las etapas del arranque */
+static profile_boot_phase_t bootPhases[PROFILE_BOOT_PHASES];
+
+/** @brief Cantidad de etapas del arranque marcadas */
+static uint8_t bootPhasesUsed;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint8_t ProfileBucket(uint32_t cycles) {
+    uint8_t bucket = (cycles == 0) ? 0 : 32 - __builtin_clz(cycles);
+
+    return (bucket < PROFILE_HISTOGRAM_BUCKETS) ? bucket : PROFILE_HISTOGRAM_BUCKETS - 1;
+}
+
+static void ProfileCounterStart(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/* === Public function implementation ============================================================================== */
+
+profile_probe_t ProfileProbeCreate(const char * name) {
+    struct profile_probe_s * self;
+
+    if (probesUsed >= PROFILE_POOL_SIZE) {
+        return NULL;
+    }
+
+    if (probesUsed == 0) {
+        uint32_t start;
+
+        ProfileCounterStart();
+        start = DWT->CYCCNT;
+        overhead = DWT->CYCCNT - start;
+    }
+
+    self = &probePool[probesUsed++];
+    self->name = name;
+    ProfileReset(self);
+    return self;
+}
+
+void ProfileRecord(profile_probe_t self, uint32_t cycles) {
+    if (self == NULL) {
+        return;
+    }
+
+    cycles = (cycles > overhead) ? cycles - overhead : 0;
+    if ((self->count == 0) || (cycles < self->min)) {
+        self->min = cycles;
+    }
+    if (cycles > self->max) {
+        self->max = cycles;
+    }
+    self->count++;
+    self->total += cycles;
+    self->histogram[ProfileBucket(cycles)]++;
+}
+
+void ProfileGetStats(profile_probe_t self, profile_stats_t * stats) {
+    stats->name = self->name;
+    stats->count = self->count;
+    stats->min = self->min;
+    stats->max = self->max;
+    stats->mean = (self->count != 0) ? self->total / self->count : 0;
+    for (uint8_t bucket = 0; bucket < PROFILE_HISTOGRAM_BUCKETS; bucket++) {
+        stats->histogram[bucket] = self->histogram[bucket];
+    }
+}
+
+void ProfileReset(profile_probe_t self) {
+    self->count = 0;
+    self->min = 0;
+    self->max = 0;
+    self->total = 0;
+    for (uint8_t bucket = 0; bucket < PROFILE_HISTOGRAM_BUCKETS; bucket++) {
+        self->histogram[bucket] = 0;
+    }
+}
+
+void ProfileDump(profile_writer_t writer, void * object) {
+    char line[PROFILE_LINE_SIZE];
+    profile_stats_t stats;
+
+    for (uint8_t index = 0; index < probesUsed; index++) {
+        int length;
+
+        ProfileGetStats(&probePool[index], &stats);
+        snprintf(line, sizeof(line), "%-16s n=%lu min=%lu max=%lu mean=%lu\n", stats.name, (unsigned long)stats.count,
+                 (unsigned long)stats.min, (unsigned long)stats.max, (unsigned long)stats.mean);
+        writer(object, line);
+        if (stats.count == 0) {
+            continue;
+        }
+
+        /* Cada intervalo no vacío se informa con su cota superior */
+        length = snprintf(line, sizeof(line), "%-16s", "");
+        for (uint8_t bucket = 0; bucket < PROFILE_HISTOGRAM_BUCKETS; bucket++) {
+            if ((stats.histogram[bucket] != 0) && (length < (int)sizeof(line))) {
+                const char * format = (bucket < PROFILE_HISTOGRAM_BUCKETS - 1) ? " <%lu:%lu" : " >=%lu:%lu";
+                unsigned long bound = (bucket < PROFILE_HISTOGRAM_BUCKETS - 1) ? 1ul << bucket : 1ul << (bucket - 1);
+                length += snprintf(line + length, sizeof(line) - length, format, bound,
+                                   (unsigned long)stats.histogram[bucket]);
+            }
+        }
+        if (length < (int)sizeof(line) - 1) {
+            line[length] = '\n';
+            line[length + 1] = '\0';
+        }
+        writer(object, line);
+    }
+}
+
+void ProfileBootMark(const char * name) {
+    if (bootPhasesUsed == 0) {
+        ProfileCounterStart();
+    }
+    if (bootPhasesUsed < PROFILE_BOOT_PHASES) {
+        bootPhases[bootPhasesUsed].cycles = DWT->CYCCNT;
+        bootPhases[bootPhasesUsed].name = name;
+        bootPhasesUsed++;
+    }
+}
+
+uint8_t ProfileBootGetPhases(profile_boot_phase_t phases[]) {
+    for (uint8_t index = 0; index < bootPhasesUsed; index++) {
+        phases[index] = bootPhases[index];
+    }
+    return bootPhasesUsed;
+}
+
+void ProfileBootDump(profile_writer_t writer, void * object) {
+    char line[PROFILE_LINE_SIZE];
+    uint32_t cyclesPerUs = SystemCoreClock / 1000000;
+    uint32_t previous = 0;
+
+    for (uint8_t index = 0; index < bootPhasesUsed; index++) {
+        uint32_t cycles = bootPhases[index].cycles;
+
+        snprintf(line, sizeof(line), "arranque %-12s en %10lu ciclos %8lu us, etapa de %8lu us\n",
+                 bootPhases[index].name, (unsigned long)cycles, (unsigned long)(cycles / cyclesPerUs),
+                 (unsigned long)((cycles - previous) / cyclesPerUs));
+        writer(object, line);
+        previous = cycles;
+    }
+}
+
+/* === End of documentation ======================================================================================== */
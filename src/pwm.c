@@ -0,0 +1,261 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file pwm.c
+ ** @brief Código fuente de la modulación por ancho de pulso por software
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include "pwm.h"
+#include "chip.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief Temporizador que genera las interrupciones de los flancos */
+#define PWM_TIMER LPC_TIMER1
+
+/** @brief Interrupción del temporizador de los flancos */
+#define PWM_TIMER_IRQ TIMER1_IRQn
+
+/** @brief Reloj del temporizador de los flancos */
+#define PWM_TIMER_CLOCK CLK_MX_TIMER1
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Lista de flancos de un período, ordenada por instante.
+ *
+ * El primer flanco está siempre en el instante cero y activa los canales con nivel distinto de cero. Cada flanco
+ * siguiente desactiva los canales cuyo pulso termina en ese instante.
+ */
+struct pwm_schedule_s {
+    uint8_t edges;                          /**< Cantidad de flancos del período. */
+    uint16_t time[PWM_MAX_CHANNELS + 1];    /**< Instante de cada flanco, en pasos desde el comienzo del período. */
+    uint32_t pattern[PWM_MAX_CHANNELS + 1]; /**< Estado de todos los canales a partir de cada flanco. */
+};
+
+/**
+ * @brief Estructura que representa un conjunto de canales de modulación por ancho de pulso.
+ *
+ * La interrupción solo lee la lista `schedule[front]`. PwmSetLevel() arma la otra lista y marca `pending`; la
+ * interrupción las intercambia al terminar el último flanco de un período.
+ */
+struct pwm_s {
+    uint8_t count;                     /**< Cantidad de canales. */
+    digital_output_group_t group;      /**< Grupo con las salidas de todos los canales. */
+    uint8_t level[PWM_MAX_CHANNELS];   /**< Nivel configurado en cada canal, antes de la corrección de gamma. */
+    struct pwm_schedule_s schedule[2]; /**< Listas de flancos: la que se usa y la próxima. */
+    volatile uint8_t front;            /**< Índice de la lista de flancos en uso. */
+    volatile bool pending;             /**< Indica que la otra lista está lista para usarse. */
+    uint8_t edge;                      /**< Flanco que corresponde a la próxima coincidencia del temporizador. */
+    uint32_t base;                     /**< Cuenta del temporizador al comienzo del período en curso. */
+    uint32_t stepTicks;                /**< Cuentas del temporizador por paso. */
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Ordena los niveles de los canales y arma la lista de flancos de un período.
+ *
+ * @param self      Puntero a la instancia.
+ * @param schedule  Lista de flancos que se completa.
+ */
+static void PwmBuild(pwm_t self, struct pwm_schedule_s * schedule);
+
+/**
+ * @brief Aplica el flanco actual y programa la coincidencia del siguiente.
+ *
+ * Si el siguiente flanco ya pasó, porque la interrupción se atendió tarde, se aplica en la misma llamada.
+ *
+ * @param self  Puntero a la instancia.
+ */
+static void PwmEdge(pwm_t self);
+
+/* === Private variable definitions ================================================================================ */
+
+/** @brief Fracción del período, en 1/65536, que se enciende cada nivel con una corrección de gamma de 2,2 */
+static const uint16_t GAMMA[256] = {
+    0, 0, 2, 4, 7, 11, 17, 24, 32, 42, 53, 65, 79, 94, 111, 129, 148, 169, 192, 216, 242, 270, 299, 330, 362, 396, 432,
+    469, 508, 549, 591, 635, 681, 729, 779, 830, 883, 938, 995, 1053, 1113, 1175, 1239, 1305, 1373, 1443, 1514, 1587,
+    1663, 1740, 1819, 1900, 1983, 2068, 2155, 2243, 2334, 2427, 2521, 2618, 2717, 2817, 2920, 3024, 3131, 3240, 3350,
+    3463, 3578, 3694, 3813, 3934, 4057, 4182, 4309, 4438, 4570, 4703, 4838, 4976, 5115, 5257, 5401, 5547, 5695, 5845,
+    5998, 6152, 6309, 6468, 6629, 6792, 6957, 7124, 7294, 7466, 7640, 7816, 7994, 8175, 8358, 8543, 8730, 8919, 9111,
+    9305, 9501, 9699, 9900, 10102, 10307, 10515, 10724, 10936, 11150, 11366, 11585, 11806, 12029, 12254, 12482, 12712,
+    12944, 13179, 13416, 13655, 13896, 14140, 14386, 14635, 14885, 15138, 15394, 15652, 15912, 16174, 16439, 16706,
+    16975, 17247, 17521, 17798, 18077, 18358, 18642, 18928, 19216, 19507, 19800, 20095, 20393, 20694, 20996, 21301,
+    21609, 21919, 22231, 22546, 22863, 23182, 23504, 23829, 24156, 24485, 24817, 25151, 25487, 25826, 26168, 26512,
+    26858, 27207, 27558, 27912, 28268, 28627, 28988, 29351, 29717, 30086, 30457, 30830, 31206, 31585, 31966, 32349,
+    32735, 33124, 33514, 33908, 34304, 34702, 35103, 35507, 35913, 36321, 36732, 37146, 37562, 37981, 38402, 38825,
+    39252, 39680, 40112, 40546, 40982, 41421, 41862, 42306, 42753, 43202, 43654, 44108, 44565, 45025, 45487, 45951,
+    46418, 46888, 47360, 47835, 48313, 48793, 49275, 49761, 50249, 50739, 51232, 51728, 52226, 52727, 53230, 53736,
+    54245, 54756, 55270, 55787, 56306, 56828, 57352, 57879, 58409, 58941, 59476, 60014, 60554, 61097, 61642, 62190,
+    62741, 63295, 63851, 64410, 64971, 65535,
+};
+
+/** @brief Reserva estática para las instancias de modulación */
+static struct pwm_s pwmPool[PWM_POOL_SIZE];
+
+/** @brief Cantidad de instancias asignadas de la reserva */
+static uint8_t pwmsUsed;
+
+/** @brief Instancia que modula la interrupción del temporizador, o `NULL` si no hay ninguna */
+static pwm_t activePwm;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void PwmBuild(pwm_t self, struct pwm_schedule_s * schedule) {
+    uint16_t duty[PWM_MAX_CHANNELS];
+    uint8_t order[PWM_MAX_CHANNELS];
+    uint32_t pattern = 0;
+
+    /* Ordenamiento por inserción de los canales por duración del pulso */
+    for (uint8_t channel = 0; channel < self->count; channel++) {
+        uint8_t index = channel;
+
+        duty[channel] = ((uint32_t)GAMMA[self->level[channel]] * PWM_STEPS + 0x8000) >> 16;
+        if (duty[channel] != 0) {
+            pattern |= 1u << channel;
+        }
+        while ((index > 0) && (duty[order[index - 1]] > duty[channel])) {
+            order[index] = order[index - 1];
+            index--;
+        }
+        order[index] = channel;
+    }
+
+    schedule->edges = 1;
+    schedule->time[0] = 0;
+    schedule->pattern[0] = pattern;
+    for (uint8_t index = 0; index < self->count; index++) {
+        uint16_t time = duty[order[index]];
+
+        /* Los canales apagados no tienen flanco de bajada y los encendidos todo el período tampoco */
+        if ((time == 0) || (time >= PWM_STEPS)) {
+            continue;
+        }
+        pattern &= ~(1u << order[index]);
+        if (schedule->time[schedule->edges - 1] != time) {
+            schedule->time[schedule->edges] = time;
+            schedule->edges++;
+        }
+        schedule->pattern[schedule->edges - 1] = pattern;
+    }
+}
+
+static void PwmEdge(pwm_t self) {
+    const struct pwm_schedule_s * schedule = &self->schedule[self->front];
+    uint32_t match;
+
+    do {
+        DigitalOutputGroupWrite(self->group, schedule->pattern[self->edge]);
+        if (++self->edge >= schedule->edges) {
+            self->edge = 0;
+            self->base += self->stepTicks * PWM_STEPS;
+            if (self->pending) {
+                self->front ^= 1;
+                self->pending = false;
+                schedule = &self->schedule[self->front];
+            }
+        }
+        match = self->base + schedule->time[self->edge] * self->stepTicks;
+        Chip_TIMER_SetMatch(PWM_TIMER, 0, match);
+    } while ((int32_t)(match - Chip_TIMER_ReadCount(PWM_TIMER)) <= 0);
+}
+
+/* === Public function implementation ============================================================================== */
+
+pwm_t PwmCreate(const digital_output_t outputs[], uint8_t count) {
+    struct pwm_s * self;
+
+    if ((count == 0) || (count > PWM_MAX_CHANNELS) || (pwmsUsed >= PWM_POOL_SIZE)) {
+        return NULL;
+    }
+
+    self = &pwmPool[pwmsUsed];
+    self->group = DigitalOutputGroupCreate(outputs, count);
+    if (self->group == NULL) {
+        return NULL;
+    }
+
+    pwmsUsed++;
+    self->count = count;
+    PwmBuild(self, &self->schedule[0]);
+    DigitalOutputGroupDeactivate(self->group);
+    return self;
+}
+
+void PwmSetLevel(pwm_t self, uint8_t channel, uint8_t level) {
+    if ((channel >= self->count) || (self->level[channel] == level)) {
+        return;
+    }
+    self->level[channel] = level;
+
+    /* Mientras no haya una lista pendiente la interrupción no cambia de lista, y la que no se usa queda libre */
+    self->pending = false;
+    __DMB();
+    PwmBuild(self, &self->schedule[self->front ^ 1]);
+    __DMB();
+    self->pending = true;
+}
+
+uint8_t PwmGetLevel(pwm_t self, uint8_t channel) {
+    return (channel < self->count) ? self->level[channel] : 0;
+}
+
+bool PwmStart(pwm_t self, uint32_t frequency) {
+    uint32_t rate = Chip_Clock_GetRate(PWM_TIMER_CLOCK);
+
+    if ((frequency == 0) || (rate / frequency < PWM_STEPS)) {
+        return false;
+    }
+
+    NVIC_DisableIRQ(PWM_TIMER_IRQ);
+    activePwm = self;
+    self->stepTicks = rate / frequency / PWM_STEPS;
+    self->edge = 0;
+
+    Chip_TIMER_Init(PWM_TIMER);
+    Chip_TIMER_Reset(PWM_TIMER);
+    Chip_TIMER_PrescaleSet(PWM_TIMER, 0);
+    Chip_TIMER_MatchEnableInt(PWM_TIMER, 0);
+    Chip_TIMER_Enable(PWM_TIMER);
+
+    /* El primer período comienza un paso después de iniciar la cuenta */
+    self->base = Chip_TIMER_ReadCount(PWM_TIMER) + self->stepTicks;
+    Chip_TIMER_SetMatch(PWM_TIMER, 0, self->base);
+
+    NVIC_ClearPendingIRQ(PWM_TIMER_IRQ);
+    NVIC_EnableIRQ(PWM_TIMER_IRQ);
+    return true;
+}
+
+void TIMER1_IRQHandler(void) {
+    Chip_TIMER_ClearMatch(PWM_TIMER, 0);
+    if (activePwm != NULL) {
+        PwmEdge(activePwm);
+    }
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,259 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file scheduler.c
+ ** @brief Código fuente del planificador cooperativo de tareas periódicas
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include "scheduler.h"
+#include "chip.h"
+#include "trace.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief Temporizador que cuenta los ticks */
+#define SCHEDULER_TIMER LPC_TIMER2
+
+/** @brief Interrupción del temporizador de los ticks */
+#define SCHEDULER_TIMER_IRQ TIMER2_IRQn
+
+/** @brief Reloj del temporizador de los ticks */
+#define SCHEDULER_TIMER_CLOCK CLK_MX_TIMER2
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Estructura que representa una tarea del planificador.
+ */
+struct scheduler_task_s {
+    scheduler_entry_t entry;      /**< Función que implementa la tarea. */
+    void * object;                /**< Puntero que se entrega a la función. */
+    uint32_t period;              /**< Período de la tarea en ticks. */
+    uint32_t release;             /**< Tick de la próxima activación. */
+    scheduler_task_stats_t stats; /**< Estadísticas de ejecución. */
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Suma a los ticks los períodos completos transcurridos según la cuenta del temporizador.
+ */
+static void SchedulerCatchUp(void);
+
+/**
+ * @brief Programa la comparación del temporizador en un tick futuro.
+ *
+ * Si el tick ya pasó, o pasa mientras se programa, se contabiliza y se programa el siguiente.
+ *
+ * @param release  Tick en el que debe ocurrir la comparación.
+ */
+static void SchedulerArm(uint32_t release);
+
+/* === Private variable definitions ================================================================================ */
+
+/** @brief Reserva estática para las instancias de tareas */
+static struct scheduler_task_s taskPool[SCHEDULER_TASK_POOL_SIZE];
+
+/** @brief Cantidad de tareas asignadas de la reserva */
+static uint8_t tasksUsed;
+
+/** @brief Ticks transcurridos desde la inicialización, contabilizados por la interrupción del temporizador */
+static volatile uint32_t ticks;
+
+/** @brief Cuentas del temporizador por tick */
+static uint32_t tickCycles;
+
+/** @brief Cuenta del temporizador en el último tick contabilizado */
+static uint32_t tickCount;
+
+/** @brief Tiempo de reposo acumulado */
+static scheduler_idle_stats_t idleStats;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void SchedulerCatchUp(void) {
+    uint32_t elapsed = (Chip_TIMER_ReadCount(SCHEDULER_TIMER) - tickCount) / tickCycles;
+
+    ticks += elapsed;
+    tickCount += elapsed * tickCycles;
+    idleStats.totalCycles += (uint64_t)elapsed * tickCycles;
+}
+
+static void SchedulerArm(uint32_t release) {
+    uint32_t match;
+
+    do {
+        int32_t wait;
+
+        SchedulerCatchUp();
+        wait = release - ticks;
+        match = tickCount + ((wait > 0) ? (uint32_t)wait : 1) * tickCycles;
+        Chip_TIMER_SetMatch(SCHEDULER_TIMER, 0, match);
+    } while ((int32_t)(match - Chip_TIMER_ReadCount(SCHEDULER_TIMER)) <= 0);
+}
+
+/* === Public function implementation ============================================================================== */
+
+bool SchedulerInit(uint32_t frequency) {
+    uint32_t rate;
+
+    SystemCoreClockUpdate();
+    rate = Chip_Clock_GetRate(SCHEDULER_TIMER_CLOCK);
+    if ((frequency == 0) || (frequency > rate)) {
+        return false;
+    }
+
+    ticks = 0;
+    tickCycles = rate / frequency;
+    idleStats = (scheduler_idle_stats_t){0};
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    NVIC_DisableIRQ(SCHEDULER_TIMER_IRQ);
+    Chip_TIMER_Init(SCHEDULER_TIMER);
+    Chip_TIMER_Reset(SCHEDULER_TIMER);
+    Chip_TIMER_PrescaleSet(SCHEDULER_TIMER, 0);
+    Chip_TIMER_MatchEnableInt(SCHEDULER_TIMER, 0);
+    Chip_TIMER_Enable(SCHEDULER_TIMER);
+
+    tickCount = Chip_TIMER_ReadCount(SCHEDULER_TIMER);
+    SchedulerArm(ticks + 1);
+
+    NVIC_ClearPendingIRQ(SCHEDULER_TIMER_IRQ);
+    NVIC_EnableIRQ(SCHEDULER_TIMER_IRQ);
+    return true;
+}
+
+scheduler_task_t SchedulerTaskCreate(scheduler_entry_t entry, void * object, uint32_t period, uint32_t phase) {
+    scheduler_task_t self = NULL;
+
+    if ((entry != NULL) && (period != 0) && (tasksUsed < SCHEDULER_TASK_POOL_SIZE)) {
+        self = &taskPool[tasksUsed];
+        self->entry = entry;
+        self->object = object;
+        self->period = period;
+        self->release = ticks + phase;
+        self->stats = (scheduler_task_stats_t){0};
+        tasksUsed++;
+    }
+    return self;
+}
+
+uint32_t SchedulerDispatch(void) {
+    uint32_t executed = 0;
+
+    for (uint8_t index = 0; index < tasksUsed; index++) {
+        scheduler_task_t task = &taskPool[index];
+        uint32_t late = ticks - task->release;
+
+        if ((int32_t)late >= 0) {
+            uint32_t missed = late / task->period;
+            uint32_t start;
+
+            task->stats.overruns += missed;
+            task->release += (missed + 1) * task->period;
+
+            TRACE(TRACE_TASK_BEGIN, index);
+            start = DWT->CYCCNT;
+            task->entry(task->object);
+            task->stats.last = DWT->CYCCNT - start;
+            TRACE(TRACE_TASK_END, index);
+
+            task->stats.runs++;
+            if (task->stats.last > task->stats.wcet) {
+                task->stats.wcet = task->stats.last;
+            }
+            executed++;
+        }
+    }
+    return executed;
+}
+
+void SchedulerIdle(void) {
+    uint32_t wait = INT32_MAX / tickCycles;
+
+    /* Con las interrupciones enmascaradas ninguna puede colarse entre la decisión de dormir y el WFI; una interrupción
+     * pendiente igual despierta al núcleo y se atiende al volver a habilitarlas */
+    __disable_irq();
+    SchedulerCatchUp();
+    for (uint8_t index = 0; index < tasksUsed; index++) {
+        int32_t remaining = taskPool[index].release - ticks;
+
+        if (remaining <= 0) {
+            wait = 0;
+        } else if ((uint32_t)remaining < wait) {
+            wait = remaining;
+        }
+    }
+
+    if (wait != 0) {
+        uint32_t release = ticks + wait;
+
+        if (wait > 1) {
+            SchedulerArm(release);
+        }
+        TRACE(TRACE_IDLE_ENTER, (wait > UINT16_MAX) ? UINT16_MAX : wait);
+        do {
+            uint32_t start = Chip_TIMER_ReadCount(SCHEDULER_TIMER);
+            __WFI();
+            uint32_t end = Chip_TIMER_ReadCount(SCHEDULER_TIMER);
+
+            /* La interrupción que despertó al núcleo se atiende antes de contabilizar el reposo */
+            __enable_irq();
+            __disable_irq();
+            idleStats.sleepCycles += end - start;
+            idleStats.sleeps++;
+            SchedulerCatchUp();
+        } while ((int32_t)(release - ticks) > 0);
+        TRACE(TRACE_IDLE_EXIT, 0);
+        SchedulerArm(ticks + 1);
+    }
+    __enable_irq();
+}
+
+void SchedulerGetIdleStats(scheduler_idle_stats_t * stats) {
+    __disable_irq();
+    SchedulerCatchUp();
+    *stats = idleStats;
+    stats->totalCycles += Chip_TIMER_ReadCount(SCHEDULER_TIMER) - tickCount;
+    __enable_irq();
+}
+
+uint32_t SchedulerGetTicks(void) {
+    return ticks;
+}
+
+void SchedulerTaskGetStats(scheduler_task_t self, scheduler_task_stats_t * stats) {
+    *stats = self->stats;
+}
+
+void TIMER2_IRQHandler(void) {
+    Chip_TIMER_ClearMatch(SCHEDULER_TIMER, 0);
+    SchedulerArm(ticks + 1);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,264 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file settings.c
+ ** @brief Código fuente del almacenamiento de ajustes en la EEPROM interna con nivelación del desgaste
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include "settings.h"
+#include "chipreg.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief Cantidad de palabras de 32 bits de un registro */
+#define SETTINGS_RECORD_WORDS 4
+
+/** @brief Cantidad de bytes de un registro */
+#define SETTINGS_RECORD_SIZE (SETTINGS_RECORD_WORDS * sizeof(uint32_t))
+
+/** @brief Cantidad de registros que entran en una página de la EEPROM */
+#define SETTINGS_RECORDS_PER_PAGE (EEPROM_PAGE_SIZE / SETTINGS_RECORD_SIZE)
+
+/** @brief Polinomio del CRC-32 en su forma reflejada */
+#define SETTINGS_CRC_POLYNOMIAL 0xEDB88320u
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Registro de ajustes tal como se guarda en la EEPROM.
+ *
+ * El CRC cubre todas las palabras anteriores, incluidos el número de secuencia y la versión.
+ */
+typedef union settings_record_u {
+    struct {
+        uint16_t sequence;                /**< Número de secuencia, que aumenta en uno con cada grabación. */
+        uint8_t version;                  /**< Versión del formato de los datos. */
+        uint8_t size;                     /**< Cantidad de bytes de datos. */
+        uint8_t data[SETTINGS_MAX_SIZE];  /**< Datos, completados con ceros. */
+        uint32_t crc;                     /**< CRC-32 de las palabras anteriores. */
+    } fields;                             /**< Campos del registro. */
+    uint32_t word[SETTINGS_RECORD_WORDS]; /**< Palabras que se leen y escriben en la EEPROM. */
+} settings_record_t;
+
+/**
+ * @brief Estructura que representa un almacenamiento de ajustes.
+ *
+ * Las posiciones de los registros se numeran de forma que posiciones consecutivas caen en páginas consecutivas: la
+ * posición `n` está en la página `firstPage + n % pages`, en el lugar `n / pages` dentro de ella.
+ */
+struct settings_s {
+    uint8_t firstPage;               /**< Primera página asignada. */
+    uint8_t pages;                   /**< Cantidad de páginas asignadas. */
+    uint8_t version;                 /**< Versión del formato de los datos. */
+    uint8_t size;                    /**< Cantidad de bytes de datos. */
+    uint16_t slots;                  /**< Cantidad de posiciones para registros. */
+    uint16_t next;                   /**< Posición del próximo registro. */
+    uint16_t sequence;               /**< Número de secuencia del próximo registro. */
+    bool valid;                      /**< Los datos se restauraron o se guardaron después. */
+    bool dirty;                      /**< Los datos cambiaron desde el último registro. */
+    bool programming;                /**< Hay una programación en curso de un registro. */
+    uint8_t delay;                   /**< Llamadas al servicio que faltan para grabar los cambios. */
+    uint8_t data[SETTINGS_MAX_SIZE]; /**< Copia en RAM de los datos. */
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Calcula el CRC-32 de las palabras de un registro anteriores a la del CRC.
+ *
+ * @param record  Registro.
+ * @return CRC-32 del registro.
+ */
+static uint32_t RecordCrc(const settings_record_t * record);
+
+/**
+ * @brief Calcula la dirección en la EEPROM de una palabra de una posición del almacenamiento.
+ *
+ * @param self  Puntero a la instancia del almacenamiento.
+ * @param slot  Posición del registro.
+ * @param word  Número de palabra dentro del registro.
+ * @return Puntero a la palabra en el mapa de memoria de la EEPROM.
+ */
+static volatile uint32_t * RecordAddress(settings_t self, uint16_t slot, uint8_t word);
+
+/**
+ * @brief Lee el registro de una posición y verifica su CRC.
+ *
+ * @param self    Puntero a la instancia del almacenamiento.
+ * @param slot    Posición del registro.
+ * @param record  Estructura donde se copia el registro.
+ * @return `true` si el CRC es correcto; `false` en caso contrario.
+ */
+static bool RecordRead(settings_t self, uint16_t slot, settings_record_t * record);
+
+/**
+ * @brief Escribe los datos en un nuevo registro e inicia su programación.
+ *
+ * @param self  Puntero a la instancia del almacenamiento.
+ */
+static void RecordWrite(settings_t self);
+
+/* === Private variable definitions ================================================================================ */
+
+/** @brief Reserva estática para las instancias de almacenamientos de ajustes */
+static struct settings_s settingsPool[SETTINGS_POOL_SIZE];
+
+/** @brief Cantidad de almacenamientos asignados de la reserva */
+static uint8_t settingsUsed;
+
+/** @brief Almacenamiento con una programación en curso, o `NULL` si la EEPROM está libre */
+static settings_t eepromOwner;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t RecordCrc(const settings_record_t * record) {
+    const uint8_t * bytes = (const uint8_t *)record->word;
+    uint32_t crc = UINT32_MAX;
+
+    for (size_t index = 0; index < offsetof(settings_record_t, fields.crc); index++) {
+        crc ^= bytes[index];
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ ((crc & 1) ? SETTINGS_CRC_POLYNOMIAL : 0);
+        }
+    }
+    return ~crc;
+}
+
+static volatile uint32_t * RecordAddress(settings_t self, uint16_t slot, uint8_t word) {
+    uint32_t page = self->firstPage + slot % self->pages;
+    uint32_t offset = (slot / self->pages) * SETTINGS_RECORD_SIZE + word * sizeof(uint32_t);
+
+    return (volatile uint32_t *)EEPROM_ADDRESS(page, offset);
+}
+
+static bool RecordRead(settings_t self, uint16_t slot, settings_record_t * record) {
+    for (uint8_t word = 0; word < SETTINGS_RECORD_WORDS; word++) {
+        record->word[word] = CHIP_REG_READ(RecordAddress(self, slot, word));
+    }
+    return record->fields.crc == RecordCrc(record);
+}
+
+static void RecordWrite(settings_t self) {
+    settings_record_t record = {0};
+
+    record.fields.sequence = self->sequence;
+    record.fields.version = self->version;
+    record.fields.size = self->size;
+    memcpy(record.fields.data, self->data, self->size);
+    record.fields.crc = RecordCrc(&record);
+
+    /* Las palabras se cargan en el registro de página y el comando programa solo esas palabras */
+    Chip_EEPROM_ClearIntStatus(LPC_EEPROM, EEPROM_INT_ENDOFPROG);
+    for (uint8_t word = 0; word < SETTINGS_RECORD_WORDS; word++) {
+        CHIP_REG_WRITE(RecordAddress(self, self->next, word), record.word[word]);
+    }
+    Chip_EEPROM_SetCmd(LPC_EEPROM, EEPROM_CMD_ERASE_PRG_PAGE);
+
+    eepromOwner = self;
+    self->programming = true;
+    self->dirty = false;
+    self->next = (self->next + 1) % self->slots;
+    self->sequence++;
+}
+
+/* === Public function implementation ============================================================================== */
+
+settings_t SettingsCreate(uint8_t firstPage, uint8_t pages, uint8_t version, uint8_t size) {
+    struct settings_s * self;
+    settings_record_t record;
+    bool found = false;
+
+    if ((pages == 0) || (firstPage + pages > EEPROM_PAGE_NUM) || (size == 0) || (size > SETTINGS_MAX_SIZE) ||
+        (settingsUsed >= SETTINGS_POOL_SIZE)) {
+        return NULL;
+    }
+    if (settingsUsed == 0) {
+        Chip_EEPROM_Init(LPC_EEPROM);
+    }
+
+    self = &settingsPool[settingsUsed++];
+    memset(self, 0, sizeof(*self));
+    self->firstPage = firstPage;
+    self->pages = pages;
+    self->version = version;
+    self->size = size;
+    self->slots = pages * SETTINGS_RECORDS_PER_PAGE;
+
+    /* Los números de secuencia se comparan con aritmética circular, válida porque hay menos de 32768 posiciones */
+    for (uint16_t slot = 0; slot < self->slots; slot++) {
+        if (RecordRead(self, slot, &record) && (!found || (int16_t)(record.fields.sequence - self->sequence) >= 0)) {
+            found = true;
+            self->next = (slot + 1) % self->slots;
+            self->sequence = record.fields.sequence + 1;
+            self->valid = (record.fields.version == version) && (record.fields.size == size);
+            if (self->valid) {
+                memcpy(self->data, record.fields.data, size);
+            }
+        }
+    }
+    return self;
+}
+
+bool SettingsLoad(settings_t self, void * data) {
+    if (self->valid) {
+        memcpy(data, self->data, self->size);
+    }
+    return self->valid;
+}
+
+void SettingsSave(settings_t self, const void * data) {
+    if (!self->valid || (memcmp(self->data, data, self->size) != 0)) {
+        memcpy(self->data, data, self->size);
+        self->valid = true;
+        self->dirty = true;
+        self->delay = SETTINGS_WRITE_DELAY;
+    }
+}
+
+void SettingsService(settings_t self) {
+    if (self->programming) {
+        if ((Chip_EEPROM_GetIntStatus(LPC_EEPROM) & EEPROM_INT_ENDOFPROG) == 0) {
+            return;
+        }
+        Chip_EEPROM_ClearIntStatus(LPC_EEPROM, EEPROM_INT_ENDOFPROG);
+        self->programming = false;
+        eepromOwner = NULL;
+    }
+    if (self->dirty && (self->delay > 0)) {
+        self->delay--;
+    }
+    if (self->dirty && (self->delay == 0) && (eepromOwner == NULL)) {
+        RecordWrite(self);
+    }
+}
+
+bool SettingsIsPending(settings_t self) {
+    return self->dirty || self->programming;
+}
+
+/* === End of documentation ======================================================================================== */
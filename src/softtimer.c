@@ -0,0 +1,231 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file softtimer.c
+ ** @brief Código fuente del servicio de temporizadores de software sobre una rueda de tiempos jerárquica
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include "softtimer.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief Bits del índice de ranura de cada rueda */
+#define WHEEL_BITS 6
+
+/** @brief Cantidad de ranuras de cada rueda */
+#define WHEEL_SLOTS (1u << WHEEL_BITS)
+
+/** @brief Máscara del índice de ranura de cada rueda */
+#define WHEEL_MASK (WHEEL_SLOTS - 1)
+
+/** @brief Cantidad de ruedas, que con 64 ranuras cada una ubican en forma exacta vencimientos de hasta 2^24 ticks */
+#define WHEEL_LEVELS 4
+
+/** @brief Mayor distancia al vencimiento que abarcan las ruedas. Los más lejanos esperan en la última y se reubican */
+#define WHEEL_SPAN ((1ul << (WHEEL_BITS * WHEEL_LEVELS)) - 1)
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Estructura que representa un temporizador de software.
+ *
+ * Los temporizadores de una misma ranura forman una lista simplemente enlazada en la que cada uno guarda además la
+ * dirección del puntero que lo apunta, de modo que se quitan de la lista sin recorrerla.
+ */
+struct soft_timer_s {
+    soft_timer_t next;              /**< Siguiente temporizador de la misma ranura. */
+    soft_timer_t * link;            /**< Puntero que apunta a este temporizador, o `NULL` si está detenido. */
+    uint32_t expires;               /**< Tick en que vence. */
+    uint32_t period;                /**< Ticks entre vencimientos, o cero si es de un disparo. */
+    soft_timer_callback_t callback; /**< Función que se ejecuta al vencer. */
+    void * object;                  /**< Puntero que se entrega a la función. */
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Agrega un temporizador a la ranura que corresponde a su vencimiento.
+ *
+ * La rueda es la menor que abarca la distancia entre el tick actual y el vencimiento, y la ranura es la que ocupa el
+ * vencimiento en esa rueda.
+ *
+ * @param timer  Puntero a la instancia del temporizador, que no debe estar en ninguna ranura.
+ */
+static void TimerInsert(soft_timer_t timer);
+
+/**
+ * @brief Quita un temporizador de la ranura en la que está.
+ *
+ * @param timer  Puntero a la instancia del temporizador, que debe estar en una ranura.
+ */
+static void TimerUnlink(soft_timer_t timer);
+
+/**
+ * @brief Redistribuye en las ruedas inferiores los temporizadores de la ranura actual de una rueda.
+ *
+ * @param level  Número de rueda, mayor que cero.
+ * @return Índice de la ranura redistribuida. Si es cero la rueda completó una vuelta y corresponde seguir con la
+ *         rueda superior.
+ */
+static uint8_t TimerCascade(uint8_t level);
+
+/* === Private variable definitions ================================================================================ */
+
+/** @brief Reserva estática para las instancias de temporizadores */
+static struct soft_timer_s timerPool[SOFT_TIMER_POOL_SIZE];
+
+/** @brief Cantidad de temporizadores asignados de la reserva */
+static uint8_t timersUsed;
+
+/** @brief Primer temporizador de cada ranura de cada rueda */
+static soft_timer_t wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+
+/** @brief Próximo tick que procesa SoftTimerTick() */
+static uint32_t now;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void TimerInsert(soft_timer_t self) {
+    uint32_t distance = self->expires - now;
+    uint32_t expires = self->expires;
+    uint8_t level = 0;
+    soft_timer_t * slot;
+
+    if (distance > WHEEL_SPAN) {
+        distance = WHEEL_SPAN;
+        expires = now + WHEEL_SPAN;
+    }
+    while ((distance >> (WHEEL_BITS * (level + 1))) != 0) {
+        level++;
+    }
+
+    slot = &wheel[level][(expires >> (WHEEL_BITS * level)) & WHEEL_MASK];
+    self->next = *slot;
+    if (self->next != NULL) {
+        self->next->link = &self->next;
+    }
+    self->link = slot;
+    *slot = self;
+}
+
+static void TimerUnlink(soft_timer_t self) {
+    *self->link = self->next;
+    if (self->next != NULL) {
+        self->next->link = self->link;
+    }
+    self->link = NULL;
+}
+
+static uint8_t TimerCascade(uint8_t level) {
+    uint8_t index = (now >> (WHEEL_BITS * level)) & WHEEL_MASK;
+    soft_timer_t pending = wheel[level][index];
+
+    wheel[level][index] = NULL;
+    while (pending != NULL) {
+        soft_timer_t self = pending;
+
+        pending = self->next;
+        TimerInsert(self);
+    }
+    return index;
+}
+
+/* === Public function implementation ============================================================================== */
+
+soft_timer_t SoftTimerCreate(soft_timer_callback_t callback, void * object) {
+    soft_timer_t self = NULL;
+
+    if ((callback != NULL) && (timersUsed < SOFT_TIMER_POOL_SIZE)) {
+        self = &timerPool[timersUsed++];
+        self->next = NULL;
+        self->link = NULL;
+        self->callback = callback;
+        self->object = object;
+    }
+    return self;
+}
+
+bool SoftTimerStart(soft_timer_t self, uint32_t delay, uint32_t period) {
+    if (delay == 0) {
+        return false;
+    }
+
+    SoftTimerStop(self);
+    self->expires = now + delay - 1;
+    self->period = period;
+    TimerInsert(self);
+    return true;
+}
+
+void SoftTimerStop(soft_timer_t self) {
+    if (self->link != NULL) {
+        TimerUnlink(self);
+    }
+}
+
+bool SoftTimerIsRunning(soft_timer_t self) {
+    return self->link != NULL;
+}
+
+uint32_t SoftTimerGetRemaining(soft_timer_t self) {
+    return (self->link != NULL) ? self->expires - now + 1 : 0;
+}
+
+void SoftTimerTick(void) {
+    uint8_t index = now & WHEEL_MASK;
+    soft_timer_t expired;
+
+    /* Al completar una vuelta de la primera rueda bajan los temporizadores de la ranura siguiente de las superiores */
+    if (index == 0) {
+        uint8_t level = 1;
+
+        while ((level < WHEEL_LEVELS) && (TimerCascade(level) == 0)) {
+            level++;
+        }
+    }
+
+    /* La ranura vencida pasa a una lista local, así las funciones pueden detener temporizadores que aún no corrieron */
+    expired = wheel[0][index];
+    wheel[0][index] = NULL;
+    if (expired != NULL) {
+        expired->link = &expired;
+    }
+    now++;
+
+    while (expired != NULL) {
+        soft_timer_t self = expired;
+
+        TimerUnlink(self);
+        if (self->period != 0) {
+            self->expires += self->period;
+            TimerInsert(self);
+        }
+        self->callback(self, self->object);
+    }
+}
+
+/* === End of documentation ======================================================================================== */
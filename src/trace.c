@@ -0,0 +1,351 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file trace.c
+ ** @brief Código fuente del registro binario de eventos con vaciado en segundo plano por UART
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include "trace.h"
+#include "chip.h"
+#include <stddef.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief UART por el que se envían las trazas, conectado al conector RS-232 de la placa. El adaptador USB de
+ * depuración lo ocupa la consola */
+#define TRACE_UART LPC_USART3
+
+/** @brief Interrupción del UART de las trazas */
+#define TRACE_UART_IRQ USART3_IRQn
+
+/** @brief Caracteres que se pueden escribir en la FIFO de transmisión vacía */
+#define TRACE_UART_FIFO 16
+
+#if (TRACE_BUFFER_SIZE & (TRACE_BUFFER_SIZE - 1)) != 0
+#error "TRACE_BUFFER_SIZE debe ser potencia de dos"
+#endif
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Registro de un evento en el buffer circular.
+ *
+ * El campo `lap` identifica la vuelta del buffer en la que se escribió el registro. El productor lo pone en cero antes
+ * de escribir el resto de los campos y le asigna la vuelta al terminar, de modo que el consumidor reconoce tanto un
+ * registro que todavía no se publicó como uno que se sobrescribió mientras lo copiaba.
+ */
+struct trace_record_s {
+    uint32_t stamp;       /**< Valor del contador de ciclos del DWT. */
+    uint16_t arg;         /**< Argumento del evento. */
+    uint8_t event;        /**< Tipo de evento. */
+    volatile uint8_t lap; /**< Vuelta del buffer, entre 1 y 127, o cero mientras se escribe. */
+};
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Calcula la vuelta del buffer que corresponde a una posición del flujo de registros.
+ *
+ * @param index  Posición del registro desde el inicio.
+ * @return Vuelta del buffer, entre 1 y 127.
+ */
+static uint8_t TraceLap(uint32_t index);
+
+/**
+ * @brief Retira el registro más antiguo publicado del buffer.
+ *
+ * Solo la llama la rutina de servicio del UART, que es el único consumidor. Los registros sobrescritos antes de
+ * retirarse se cuentan como perdidos.
+ *
+ * @param record  Estructura donde se copia el registro.
+ * @return `true` si había un registro publicado; `false` en caso contrario.
+ */
+static bool TraceFetch(struct trace_record_s * record);
+
+/**
+ * @brief Arma la próxima trama a enviar: el aviso de registros perdidos si los hay, o el registro más antiguo.
+ *
+ * @return `true` si quedó una trama lista; `false` si el buffer está vacío.
+ */
+static bool TraceNextFrame(void);
+
+/* === Private variable definitions ================================================================================ */
+
+/** @brief Reserva estática del buffer circular de registros */
+static struct trace_record_s recordPool[TRACE_BUFFER_SIZE];
+
+/** @brief Registros reservados desde el inicio, incrementado en forma atómica por los productores */
+static volatile uint32_t recordHead;
+
+/** @brief Registros retirados del buffer, escrito solo por el consumidor */
+static volatile uint32_t recordTail;
+
+/** @brief Registros perdidos, escrito solo por el consumidor */
+static uint32_t recordsLost;
+
+/** @brief Registros perdidos ya informados con un evento `TRACE_LOST` */
+static uint32_t lostReported;
+
+/** @brief Registros enviados */
+static uint32_t recordsSent;
+
+/** @brief Marca de tiempo del último registro enviado, desde la que se mide la diferencia del siguiente */
+static uint32_t lastStamp;
+
+/** @brief Trama que se está enviando */
+static uint8_t frame[TRACE_FRAME_SIZE];
+
+/** @brief Longitud de la trama que se está enviando */
+static uint8_t frameLength;
+
+/** @brief Bytes de la trama ya escritos en la FIFO del UART */
+static uint8_t frameSent;
+
+/** @brief Nombre de cada tipo de evento */
+static const char * const EVENT_NAMES[] = {
+#define TRACE_EVENT_NAME(id, name, format) [id] = name,
+    TRACE_EVENTS(TRACE_EVENT_NAME)
+#undef TRACE_EVENT_NAME
+};
+
+/** @brief Formato del argumento de cada tipo de evento */
+static const uint8_t EVENT_FORMATS[] = {
+#define TRACE_EVENT_FORMAT(id, name, format) [id] = format,
+    TRACE_EVENTS(TRACE_EVENT_FORMAT)
+#undef TRACE_EVENT_FORMAT
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint8_t TraceLap(uint32_t index) {
+    return (index / TRACE_BUFFER_SIZE) % 127 + 1;
+}
+
+static bool TraceFetch(struct trace_record_s * record) {
+    while (true) {
+        uint32_t head = recordHead;
+        uint32_t tail = recordTail;
+        struct trace_record_s * slot = &recordPool[tail & (TRACE_BUFFER_SIZE - 1)];
+        uint8_t lap = TraceLap(tail);
+
+        if (head - tail > TRACE_BUFFER_SIZE) {
+            /* Los productores dieron la vuelta: los registros más antiguos ya fueron sobrescritos */
+            recordsLost += head - tail - TRACE_BUFFER_SIZE;
+            recordTail = head - TRACE_BUFFER_SIZE;
+            continue;
+        }
+        if ((tail == head) || (slot->lap != lap)) {
+            /* Vacío, o el registro reservado todavía no se publicó */
+            return false;
+        }
+
+        __DMB();
+        *record = *slot;
+        __DMB();
+        recordTail = tail + 1;
+        if (slot->lap == lap) {
+            return true;
+        }
+        recordsLost++;
+    }
+}
+
+static bool TraceNextFrame(void) {
+    struct trace_record_s record;
+
+    if (recordsLost != lostReported) {
+        uint32_t lost = recordsLost - lostReported;
+
+        if (lost > UINT16_MAX) {
+            lost = UINT16_MAX;
+        }
+        lostReported += lost;
+        frameLength = TraceEncode(frame, TRACE_LOST, lost, 0);
+    } else if (TraceFetch(&record)) {
+        frameLength = TraceEncode(frame, record.event, record.arg, (int32_t)(record.stamp - lastStamp));
+        lastStamp = record.stamp;
+        recordsSent++;
+    } else {
+        return false;
+    }
+    frameSent = 0;
+    return true;
+}
+
+/* === Public function implementation ============================================================================== */
+
+bool TraceStart(uint32_t baudrate) {
+    if (baudrate == 0) {
+        return false;
+    }
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    NVIC_DisableIRQ(TRACE_UART_IRQ);
+    Chip_UART_Init(TRACE_UART);
+    Chip_UART_SetBaud(TRACE_UART, baudrate);
+    Chip_UART_ConfigData(TRACE_UART, UART_LCR_WLEN8 | UART_LCR_SBS_1BIT | UART_LCR_PARITY_DIS);
+    Chip_UART_SetupFIFOS(TRACE_UART, UART_FCR_FIFO_EN | UART_FCR_TX_RS | UART_FCR_RX_RS | UART_FCR_TRG_LEV0);
+    Chip_UART_TXEnable(TRACE_UART);
+
+    /* Los registros anteriores al inicio, como los de la creación de la placa, se miden desde el primero */
+    lastStamp = recordPool[recordTail & (TRACE_BUFFER_SIZE - 1)].stamp;
+    TraceRecord(TRACE_START, SystemCoreClock / 1000000);
+
+    NVIC_ClearPendingIRQ(TRACE_UART_IRQ);
+    NVIC_EnableIRQ(TRACE_UART_IRQ);
+    return true;
+}
+
+void TraceRecord(trace_event_t event, uint16_t arg) {
+    uint32_t stamp = DWT->CYCCNT;
+    uint32_t index = __atomic_fetch_add(&recordHead, 1, __ATOMIC_RELAXED);
+    struct trace_record_s * record = &recordPool[index & (TRACE_BUFFER_SIZE - 1)];
+
+    record->lap = 0;
+    __DMB();
+    record->stamp = stamp;
+    record->arg = arg;
+    record->event = event;
+    /* Los campos tienen que estar completos en memoria antes de publicar el registro al consumidor */
+    __DMB();
+    record->lap = TraceLap(index);
+}
+
+void TraceFlush(void) {
+    if (recordHead != recordTail) {
+        Chip_UART_IntEnable(TRACE_UART, UART_IER_THREINT);
+    }
+}
+
+void TraceGetStats(trace_stats_t * stats) {
+    stats->recorded = recordHead;
+    stats->sent = recordsSent;
+    stats->lost = recordsLost;
+}
+
+uint8_t TraceEncode(uint8_t frame[], trace_event_t event, uint16_t arg, int32_t delta) {
+    uint8_t payload[TRACE_FRAME_SIZE - 2];
+    uint8_t length = 0;
+    /* Zigzag: los valores pequeños, positivos o negativos, ocupan pocos bytes */
+    uint32_t value = ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31);
+    uint8_t code = 0;
+    uint8_t out = 1;
+
+    payload[length++] = event;
+    payload[length++] = arg & 0xFF;
+    payload[length++] = arg >> 8;
+    do {
+        payload[length] = value & 0x7F;
+        value >>= 7;
+        if (value != 0) {
+            payload[length] |= 0x80;
+        }
+        length++;
+    } while (value != 0);
+
+    /* COBS: cada byte de código indica la distancia al próximo cero, y la trama termina con el único cero */
+    for (uint8_t index = 0; index < length; index++) {
+        if (payload[index] == 0) {
+            frame[code] = out - code;
+            code = out++;
+        } else {
+            frame[out++] = payload[index];
+        }
+    }
+    frame[code] = out - code;
+    frame[out++] = 0;
+    return out;
+}
+
+bool TraceDecode(const uint8_t frame[], uint8_t length, trace_event_t * event, uint16_t * arg, int32_t * delta) {
+    uint8_t payload[TRACE_FRAME_SIZE];
+    uint8_t size = 0;
+    uint8_t index = 0;
+    uint32_t value = 0;
+    uint8_t shift = 0;
+
+    while (index < length) {
+        uint8_t code = frame[index++];
+
+        if ((code == 0) || (index + code - 1 > length)) {
+            return false;
+        }
+        for (uint8_t copy = 1; copy < code; copy++) {
+            if (size == sizeof(payload)) {
+                return false;
+            }
+            payload[size++] = frame[index++];
+        }
+        if ((index < length) && (size < sizeof(payload))) {
+            payload[size++] = 0;
+        }
+    }
+
+    if ((size < 4) || (payload[0] >= TRACE_EVENT_COUNT)) {
+        return false;
+    }
+    for (index = 3; index < size; index++) {
+        value |= (uint32_t)(payload[index] & 0x7F) << shift;
+        shift += 7;
+        if (!(payload[index] & 0x80)) {
+            break;
+        }
+    }
+    if ((index >= size) || (shift > 35)) {
+        return false;
+    }
+
+    *event = payload[0];
+    *arg = payload[1] | (payload[2] << 8);
+    *delta = (int32_t)((value >> 1) ^ -(value & 1));
+    return true;
+}
+
+const char * TraceEventName(trace_event_t event) {
+    return (event < TRACE_EVENT_COUNT) ? EVENT_NAMES[event] : NULL;
+}
+
+trace_arg_t TraceEventFormat(trace_event_t event) {
+    return (event < TRACE_EVENT_COUNT) ? EVENT_FORMATS[event] : TRACE_ARG_NUMBER;
+}
+
+void UART3_IRQHandler(void) {
+    uint8_t room = TRACE_UART_FIFO;
+
+    /* La lectura de IIR reconoce la interrupción por FIFO de transmisión vacía */
+    Chip_UART_ReadIntIDReg(TRACE_UART);
+    while (room > 0) {
+        if ((frameSent == frameLength) && !TraceNextFrame()) {
+            Chip_UART_IntDisable(TRACE_UART, UART_IER_THREINT);
+            break;
+        }
+        Chip_UART_SendByte(TRACE_UART, frame[frameSent++]);
+        room--;
+    }
+}
+
+/* === End of documentation ======================================================================================== */
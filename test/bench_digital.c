@@ -0,0 +1,511 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file bench_digital.c
+ ** @brief Mediciones de rendimiento del módulo de entradas y salidas digitales sobre el chip simulado
+ **
+ ** Cada medición llama repetidamente a una función del módulo e informa los accesos a registros simulados por llamada,
+ ** que no dependen de la máquina, y las llamadas por segundo, tomando la mejor de varias repeticiones para reducir el
+ ** efecto de la carga del sistema. Con una línea de base guardada el programa termina con error si alguna medición
+ ** hace más accesos por llamada que la base, o si es más lenta que la base en más de la tolerancia indicada.
+ **
+ ** Uso: bench_digital [-b línea_base] [-w línea_base] [-t tolerancia_%] [-n llamadas]
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include "digital.h"
+#include "chip.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief Llamadas de cada repetición de una medición, salvo que se indique otra cantidad con `-n` */
+#define BENCH_CALLS 200000
+
+/** @brief Repeticiones de cada medición, de las que se informa la más rápida */
+#define BENCH_REPEATS 5
+
+/** @brief Tolerancia predeterminada, en porcentaje, de la caída de llamadas por segundo respecto de la base */
+#define BENCH_TOLERANCE 50
+
+/** @brief Diferencia de accesos por llamada que se considera igual a la base, por el redondeo del archivo */
+#define BENCH_ACCESS_EPSILON 0.005
+
+/** @brief Longitud máxima del nombre de una medición */
+#define BENCH_NAME_SIZE 24
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Medición de una función del módulo.
+ */
+typedef struct bench_s {
+    const char * name;               /**< Nombre de la medición, usado como clave en la línea de base. */
+    void (*run)(uint32_t iteration); /**< Llamada medida, que recibe el número de iteración para variar los datos. */
+} bench_t;
+
+/**
+ * @brief Resultado de una medición.
+ */
+typedef struct bench_result_s {
+    char name[BENCH_NAME_SIZE]; /**< Nombre de la medición. */
+    double accesses;            /**< Accesos a registros simulados por llamada. */
+    double rate;                /**< Llamadas por segundo de la repetición más rápida. */
+} bench_result_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Crea las salidas, entradas, grupos y bancos que usan las mediciones.
+ */
+static void Setup(void);
+
+/**
+ * @brief Ejecuta una medición.
+ *
+ * @param bench   Medición a ejecutar.
+ * @param calls   Llamadas de cada repetición.
+ * @param result  Estructura donde se guarda el resultado.
+ */
+static void Measure(const bench_t * bench, uint32_t calls, bench_result_t * result);
+
+/**
+ * @brief Devuelve el tiempo de un reloj monótono en segundos.
+ *
+ * @return Tiempo en segundos.
+ */
+static double Now(void);
+
+/**
+ * @brief Lee una línea de base.
+ *
+ * @param path     Archivo de la línea de base.
+ * @param results  Arreglo donde se guardan las mediciones leídas.
+ * @param size     Capacidad del arreglo.
+ * @return Cantidad de mediciones leídas, o -1 si no se pudo abrir el archivo.
+ */
+static int LoadBaseline(const char * path, bench_result_t results[], size_t size);
+
+/**
+ * @brief Escribe una línea de base con los resultados de las mediciones.
+ *
+ * @param path     Archivo de la línea de base.
+ * @param results  Resultados de las mediciones.
+ * @param count    Cantidad de resultados.
+ * @return `true` si se pudo escribir el archivo; `false` en caso contrario.
+ */
+static bool SaveBaseline(const char * path, const bench_result_t results[], size_t count);
+
+/**
+ * @brief Mide DigitalOutputActivate().
+ *
+ * @param iteration  Número de iteración.
+ */
+static void BenchOutputActivate(uint32_t iteration);
+
+/**
+ * @brief Mide DigitalOutputToggle().
+ *
+ * @param iteration  Número de iteración.
+ */
+static void BenchOutputToggle(uint32_t iteration);
+
+/**
+ * @brief Mide DigitalOutputActivate() de una salida diferida ya activa seguida de DigitalOutputCommit().
+ *
+ * @param iteration  Número de iteración.
+ */
+static void BenchOutputCommit(uint32_t iteration);
+
+/**
+ * @brief Mide DigitalPinToggle().
+ *
+ * @param iteration  Número de iteración.
+ */
+static void BenchPinToggle(uint32_t iteration);
+
+/**
+ * @brief Mide DigitalOutputGroupWrite() con un patrón distinto en cada llamada.
+ *
+ * @param iteration  Número de iteración.
+ */
+static void BenchGroupWrite(uint32_t iteration);
+
+/**
+ * @brief Mide DigitalOutputGroupToggle().
+ *
+ * @param iteration  Número de iteración.
+ */
+static void BenchGroupToggle(uint32_t iteration);
+
+/**
+ * @brief Mide DigitalInputGetIsActive() de una entrada leída en forma directa.
+ *
+ * @param iteration  Número de iteración.
+ */
+static void BenchInputGetIsActive(uint32_t iteration);
+
+/**
+ * @brief Mide DigitalInputWasChanged() de una entrada leída en forma directa.
+ *
+ * @param iteration  Número de iteración.
+ */
+static void BenchInputWasChanged(uint32_t iteration);
+
+/**
+ * @brief Mide DigitalPinGetIsActive().
+ *
+ * @param iteration  Número de iteración.
+ */
+static void BenchPinGetIsActive(uint32_t iteration);
+
+/**
+ * @brief Mide DigitalInputBankScan() con el filtro antirrebote de las teclas.
+ *
+ * @param iteration  Número de iteración.
+ */
+static void BenchBankScan(uint32_t iteration);
+
+/**
+ * @brief Mide DigitalInputWasChanged() de una entrada de un banco.
+ *
+ * @param iteration  Número de iteración.
+ */
+static void BenchBankWasChanged(uint32_t iteration);
+
+/**
+ * @brief Mide la atención de un flanco por interrupción y el retiro del evento de la cola.
+ *
+ * @param iteration  Número de iteración.
+ */
+static void BenchInterruptEdge(uint32_t iteration);
+
+/* === Private variable definitions ================================================================================ */
+
+/** @brief Mediciones, en el orden en que se ejecutan e informan */
+static const bench_t BENCHES[] = {
+    {"salida-activar", BenchOutputActivate},
+    {"salida-conmutar", BenchOutputToggle},
+    {"salida-confirmar", BenchOutputCommit},
+    {"pin-conmutar", BenchPinToggle},
+    {"grupo-escribir", BenchGroupWrite},
+    {"grupo-conmutar", BenchGroupToggle},
+    {"entrada-leer", BenchInputGetIsActive},
+    {"entrada-cambio", BenchInputWasChanged},
+    {"pin-leer", BenchPinGetIsActive},
+    {"banco-explorar", BenchBankScan},
+    {"banco-cambio", BenchBankWasChanged},
+    {"interrupcion-flanco", BenchInterruptEdge},
+};
+
+/** @brief Cantidad de mediciones */
+#define BENCH_COUNT (sizeof(BENCHES) / sizeof(BENCHES[0]))
+
+/** @brief Salida usada por las mediciones de salidas individuales */
+static digital_output_t output;
+
+/** @brief Salida diferida, activada en cada ciclo como un LED que sigue a una tecla */
+static digital_output_t deferredOutput;
+
+/** @brief Acceso directo al pin de la salida */
+static const digital_pin_t * outputPin;
+
+/** @brief Grupo de ocho salidas repartidas en dos puertos, como los segmentos de la pantalla */
+static digital_output_group_t group;
+
+/** @brief Entrada leída en forma directa */
+static digital_input_t input;
+
+/** @brief Acceso directo al pin de la entrada */
+static const digital_pin_t * inputPin;
+
+/** @brief Banco de cuatro entradas en dos puertos, como las teclas de la placa */
+static digital_input_bank_t bank;
+
+/** @brief Primera entrada del banco */
+static digital_input_t bankInput;
+
+/** @brief Entrada asociada a una interrupción de pin */
+static digital_input_t interruptInput;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void Setup(void) {
+    digital_output_t segments[8];
+    digital_input_t keys[4];
+
+    output = DigitalOutputCreate(5, 0);
+    outputPin = DigitalOutputGetPin(output);
+    deferredOutput = DigitalOutputCreate(5, 1);
+    DigitalOutputSetDeferred(deferredOutput, true);
+    for (uint8_t index = 0; index < 8; index++) {
+        segments[index] = DigitalOutputCreate((index < 4) ? 2 : 3, 8 + index);
+    }
+    group = DigitalOutputGroupCreate(segments, 8);
+
+    input = DigitalInputCreate(0, 4, true);
+    inputPin = DigitalInputGetPin(input);
+    for (uint8_t index = 0; index < 4; index++) {
+        keys[index] = DigitalInputCreate((index < 2) ? 0 : 1, 8 + index, true);
+    }
+    bank = DigitalInputBankCreate(keys, 4);
+    DigitalInputBankSetDebounce(bank, BOARD_KEYS_DEBOUNCE_SAMPLES);
+    bankInput = keys[0];
+
+    interruptInput = DigitalInputCreate(1, 2, false);
+    DigitalInputAttachInterrupt(interruptInput, 0);
+
+    if ((output == NULL) || (deferredOutput == NULL) || (group == NULL) || (input == NULL) || (bank == NULL) ||
+        (interruptInput == NULL)) {
+        fprintf(stderr, "bench_digital: no se pudieron crear las instancias de las mediciones\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void BenchOutputActivate(uint32_t iteration) {
+    (void)iteration;
+    DigitalOutputActivate(output);
+}
+
+static void BenchOutputToggle(uint32_t iteration) {
+    (void)iteration;
+    DigitalOutputToggle(output);
+}
+
+static void BenchOutputCommit(uint32_t iteration) {
+    (void)iteration;
+    DigitalOutputActivate(deferredOutput);
+    DigitalOutputCommit();
+}
+
+static void BenchPinToggle(uint32_t iteration) {
+    (void)iteration;
+    DigitalPinToggle(outputPin);
+}
+
+static void BenchGroupWrite(uint32_t iteration) {
+    DigitalOutputGroupWrite(group, iteration & 0xFF);
+}
+
+static void BenchGroupToggle(uint32_t iteration) {
+    (void)iteration;
+    DigitalOutputGroupToggle(group);
+}
+
+static void BenchInputGetIsActive(uint32_t iteration) {
+    (void)iteration;
+    DigitalInputGetIsActive(input);
+}
+
+static void BenchInputWasChanged(uint32_t iteration) {
+    (void)iteration;
+    DigitalInputWasChanged(input);
+}
+
+static void BenchPinGetIsActive(uint32_t iteration) {
+    (void)iteration;
+    DigitalPinGetIsActive(inputPin);
+}
+
+static void BenchBankScan(uint32_t iteration) {
+    (void)iteration;
+    DigitalInputBankScan(bank);
+}
+
+static void BenchBankWasChanged(uint32_t iteration) {
+    (void)iteration;
+    DigitalInputWasChanged(bankInput);
+}
+
+static void BenchInterruptEdge(uint32_t iteration) {
+    digital_event_t event;
+
+    /* Cada llamada produce un flanco, que atiende la interrupción, y retira el evento de la cola */
+    SimGpioSetInput(1, 2, (iteration & 1) == 0);
+    DigitalInputWasChanged(interruptInput);
+    DigitalInputGetEvent(&event);
+}
+
+static double Now(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+static void Measure(const bench_t * bench, uint32_t calls, bench_result_t * result) {
+    sim_chip_stats_t before;
+    sim_chip_stats_t after;
+    double best = 0;
+
+    snprintf(result->name, sizeof(result->name), "%s", bench->name);
+    for (uint8_t repeat = 0; repeat < BENCH_REPEATS; repeat++) {
+        double start;
+        double elapsed;
+
+        SimGetStats(&before);
+        start = Now();
+        for (uint32_t iteration = 0; iteration < calls; iteration++) {
+            bench->run(iteration);
+        }
+        elapsed = Now() - start;
+        SimGetStats(&after);
+
+        if ((repeat == 0) || (elapsed < best)) {
+            best = elapsed;
+        }
+        /* Los accesos de todas las repeticiones son iguales porque el simulador es determinista */
+        result->accesses = (double)((after.reads - before.reads) + (after.writes - before.writes)) / calls;
+    }
+    result->rate = (best > 0) ? calls / best : 0;
+}
+
+static int LoadBaseline(const char * path, bench_result_t results[], size_t size) {
+    FILE * file = fopen(path, "r");
+    char line[128];
+    int count = 0;
+
+    if (file == NULL) {
+        return -1;
+    }
+    while ((fgets(line, sizeof(line), file) != NULL) && ((size_t)count < size)) {
+        bench_result_t * result = &results[count];
+
+        if ((line[0] == '#') || (line[0] == '\n')) {
+            continue;
+        }
+        if (sscanf(line, "%23s %lf %lf", result->name, &result->accesses, &result->rate) == 3) {
+            count++;
+        }
+    }
+    fclose(file);
+    return count;
+}
+
+static bool SaveBaseline(const char * path, const bench_result_t results[], size_t count) {
+    FILE * file = fopen(path, "w");
+
+    if (file == NULL) {
+        return false;
+    }
+    fprintf(file, "# Línea de base de bench_digital, generada con make BOARD=host bench-baseline\n");
+    fprintf(file, "# medición             accesos/llamada  llamadas/s\n");
+    for (size_t index = 0; index < count; index++) {
+        fprintf(file, "%-22s %15.2f %11.0f\n", results[index].name, results[index].accesses, results[index].rate);
+    }
+    return fclose(file) == 0;
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(int argc, char * argv[]) {
+    static bench_result_t results[BENCH_COUNT];
+    static bench_result_t baseline[BENCH_COUNT];
+    const char * compare = NULL;
+    const char * update = NULL;
+    double tolerance = BENCH_TOLERANCE;
+    uint32_t calls = BENCH_CALLS;
+    int loaded = 0;
+    int regressions = 0;
+    int option;
+
+    while ((option = getopt(argc, argv, "b:w:t:n:")) != -1) {
+        switch (option) {
+        case 'b':
+            compare = optarg;
+            break;
+        case 'w':
+            update = optarg;
+            break;
+        case 't':
+            tolerance = atof(optarg);
+            break;
+        case 'n':
+            calls = strtoul(optarg, NULL, 0);
+            break;
+        default:
+            fprintf(stderr, "Uso: %s [-b línea_base] [-w línea_base] [-t tolerancia_%%] [-n llamadas]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if ((calls == 0) || (tolerance < 0) || (tolerance >= 100)) {
+        fprintf(stderr, "bench_digital: la cantidad de llamadas y la tolerancia no son válidas\n");
+        return EXIT_FAILURE;
+    }
+    if (compare != NULL) {
+        loaded = LoadBaseline(compare, baseline, BENCH_COUNT);
+        if (loaded < 0) {
+            fprintf(stderr, "bench_digital: no se pudo leer la línea de base %s\n", compare);
+            return EXIT_FAILURE;
+        }
+    }
+
+    Setup();
+    printf("%-23s %15s %13s %9s  %s\n", "medición", "accesos/llamada", "llamadas/s", "vs. base", "resultado");
+    for (size_t index = 0; index < BENCH_COUNT; index++) {
+        bench_result_t * result = &results[index];
+        const bench_result_t * base = NULL;
+        const char * verdict = "";
+        char change[16] = "-";
+
+        Measure(&BENCHES[index], calls, result);
+        for (int entry = 0; entry < loaded; entry++) {
+            if (strcmp(baseline[entry].name, result->name) == 0) {
+                base = &baseline[entry];
+            }
+        }
+        if (base != NULL) {
+            snprintf(change, sizeof(change), "%+.0f%%", 100.0 * (result->rate / base->rate - 1.0));
+            verdict = "ok";
+            if (result->accesses > base->accesses + BENCH_ACCESS_EPSILON) {
+                verdict = "REGRESIÓN: más accesos";
+                regressions++;
+            } else if (result->rate < base->rate * (1.0 - tolerance / 100.0)) {
+                verdict = "REGRESIÓN: más lenta";
+                regressions++;
+            }
+        } else if (compare != NULL) {
+            verdict = "sin base";
+        }
+        printf("%-22s %15.2f %13.0f %9s  %s\n", result->name, result->accesses, result->rate, change, verdict);
+    }
+
+    if ((update != NULL) && !SaveBaseline(update, results, BENCH_COUNT)) {
+        fprintf(stderr, "bench_digital: no se pudo escribir la línea de base %s\n", update);
+        return EXIT_FAILURE;
+    }
+    if (regressions > 0) {
+        printf("bench_digital: %d mediciones empeoraron respecto de %s (tolerancia %.0f%%)\n", regressions, compare,
+               tolerance);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,282 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_clock.c
+ ** @brief Pruebas unitarias del reloj con alarma, que cuenta la hora en BCD empaquetado
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include "clock.h"
+#include "unit.h"
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief Ticks por segundo de los relojes de las pruebas */
+#define TICKS 10
+
+/** @brief Segundos de un día */
+#define DAY_SECONDS (24ul * 60 * 60)
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Crea el reloj de las pruebas con una hora inicial.
+ *
+ * @param bcd  Hora inicial con el formato `0x00HHMMSS`.
+ * @return Instancia del reloj.
+ */
+static clk_t CreateClock(uint32_t bcd);
+
+/**
+ * @brief Hace avanzar el reloj una cantidad de segundos completos.
+ *
+ * @param clock    Instancia del reloj.
+ * @param seconds  Segundos a avanzar.
+ */
+static void Advance(clk_t clock, uint32_t seconds);
+
+/**
+ * @brief Devuelve la hora del reloj en BCD.
+ *
+ * @param clock  Instancia del reloj.
+ * @return Hora con el formato `0x00HHMMSS`.
+ */
+static uint32_t Now(clk_t clock);
+
+/**
+ * @brief Convierte un valor de 0 a 99 en dos dígitos BCD.
+ *
+ * @param value  Valor a convertir.
+ * @return Valor en BCD.
+ */
+static uint32_t Bcd(uint32_t value);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static clk_t CreateClock(uint32_t bcd) {
+    clk_t clock = ClockCreate(TICKS);
+    clock_time_t time = {.bcd = bcd};
+
+    UNIT_ASSERT_NOT_NULL(clock);
+    UNIT_ASSERT(ClockSetTime(clock, &time));
+    return clock;
+}
+
+static void Advance(clk_t clock, uint32_t seconds) {
+    for (uint32_t tick = 0; tick < seconds * TICKS; tick++) {
+        ClockTick(clock);
+    }
+}
+
+static uint32_t Now(clk_t clock) {
+    clock_time_t time;
+
+    UNIT_ASSERT(ClockGetTime(clock, &time));
+    return time.bcd;
+}
+
+static uint32_t Bcd(uint32_t value) {
+    return ((value / 10) << 4) | (value % 10);
+}
+
+static void TestNewClockHasNoValidTime(void) {
+    clk_t clock;
+    clock_time_t time;
+
+    UNIT_ASSERT_NULL(ClockCreate(0));
+    clock = ClockCreate(TICKS);
+    UNIT_ASSERT_NOT_NULL(clock);
+    UNIT_ASSERT(!ClockGetTime(clock, &time));
+    UNIT_ASSERT_BITS(0, time.bcd);
+    UNIT_ASSERT(!ClockGetAlarm(clock, &time));
+    UNIT_ASSERT_NULL(ClockCreate(TICKS));
+}
+
+static void TestSecondAdvancesAfterAllTicks(void) {
+    clk_t clock = CreateClock(0x000009);
+
+    for (uint8_t tick = 1; tick < TICKS; tick++) {
+        ClockTick(clock);
+    }
+    UNIT_ASSERT_BITS(0x000009, Now(clock));
+    ClockTick(clock);
+    UNIT_ASSERT_BITS(0x000010, Now(clock));
+}
+
+static void TestCarriesBetweenDigits(void) {
+    static const uint32_t cases[][2] = {
+        {0x000019, 0x000020}, {0x000059, 0x000100}, {0x000959, 0x001000}, {0x005959, 0x010000},
+        {0x095959, 0x100000}, {0x125959, 0x130000}, {0x195959, 0x200000}, {0x235959, 0x000000},
+    };
+    clk_t clock = CreateClock(0);
+
+    for (uint8_t index = 0; index < UNIT_COUNT(cases); index++) {
+        clock_time_t time = {.bcd = cases[index][0]};
+
+        UNIT_ASSERT(ClockSetTime(clock, &time));
+        Advance(clock, 1);
+        UNIT_ASSERT_BITS(cases[index][1], Now(clock));
+    }
+}
+
+static void TestFullDayMatchesBinaryCount(void) {
+    clk_t clock = CreateClock(0);
+
+    for (uint32_t second = 1; second <= DAY_SECONDS; second++) {
+        uint32_t elapsed = second % DAY_SECONDS;
+
+        Advance(clock, 1);
+        UNIT_ASSERT_BITS((Bcd(elapsed / 3600) << 16) | (Bcd(elapsed / 60 % 60) << 8) | Bcd(elapsed % 60), Now(clock));
+    }
+}
+
+static void TestSetTimeRejectsInvalidBcd(void) {
+    static const uint32_t invalid[] = {
+        0x00000A, 0x000060, 0x000A00, 0x006000, 0x0A0000, 0x1A0000, 0x240000, 0x01000000,
+    };
+    clk_t clock = ClockCreate(TICKS);
+    clock_time_t time;
+
+    for (uint8_t index = 0; index < UNIT_COUNT(invalid); index++) {
+        time.bcd = invalid[index];
+        UNIT_ASSERT(!ClockSetTime(clock, &time));
+        UNIT_ASSERT(!ClockSetAlarm(clock, &time));
+    }
+    UNIT_ASSERT(!ClockGetTime(clock, &time));
+    UNIT_ASSERT(!ClockGetAlarm(clock, &time));
+    time.bcd = 0x235959;
+    UNIT_ASSERT(ClockSetTime(clock, &time));
+}
+
+static void TestAlarmRingsOncePerDay(void) {
+    clk_t clock = CreateClock(0x065958);
+    clock_time_t alarm = {.bcd = 0x070000};
+    uint8_t rings = 0;
+    bool previous = false;
+
+    UNIT_ASSERT(ClockSetAlarm(clock, &alarm));
+    Advance(clock, 1);
+    UNIT_ASSERT(!ClockIsAlarmRinging(clock));
+    Advance(clock, 1);
+    UNIT_ASSERT(ClockIsAlarmRinging(clock));
+    ClockStopAlarm(clock);
+
+    /* Un día completo después de silenciarla vuelve a sonar una sola vez, a la misma hora */
+    for (uint32_t second = 0; second < DAY_SECONDS; second++) {
+        Advance(clock, 1);
+        if (ClockIsAlarmRinging(clock) && !previous) {
+            rings++;
+            UNIT_ASSERT_BITS(0x070000, Now(clock));
+        }
+        previous = ClockIsAlarmRinging(clock);
+    }
+    UNIT_ASSERT_EQUAL(1, rings);
+}
+
+static void TestAlarmWaitsForValidTime(void) {
+    clk_t clock = ClockCreate(TICKS);
+    clock_time_t alarm = {.bcd = 0x000005};
+
+    UNIT_ASSERT_NOT_NULL(clock);
+    UNIT_ASSERT(ClockSetAlarm(clock, &alarm));
+    Advance(clock, 10);
+    UNIT_ASSERT(!ClockIsAlarmRinging(clock));
+}
+
+static void TestSnoozeRearmsAlarm(void) {
+    clk_t clock = CreateClock(0x235800);
+    clock_time_t alarm = {.bcd = 0x235800};
+
+    UNIT_ASSERT(!ClockSnooze(clock, 5));
+    UNIT_ASSERT(ClockSetAlarm(clock, &alarm));
+    Advance(clock, DAY_SECONDS);
+    UNIT_ASSERT(ClockIsAlarmRinging(clock));
+    UNIT_ASSERT(!ClockSnooze(clock, 0));
+    UNIT_ASSERT(!ClockSnooze(clock, 60));
+
+    /* La posposición cruza la medianoche */
+    UNIT_ASSERT(ClockSnooze(clock, 5));
+    UNIT_ASSERT(!ClockIsAlarmRinging(clock));
+    Advance(clock, 5 * 60 - 1);
+    UNIT_ASSERT_BITS(0x000259, Now(clock));
+    UNIT_ASSERT(!ClockIsAlarmRinging(clock));
+    Advance(clock, 1);
+    UNIT_ASSERT(ClockIsAlarmRinging(clock));
+
+    /* Después de la posposición la alarma vuelve a su hora */
+    ClockStopAlarm(clock);
+    Advance(clock, DAY_SECONDS - 5 * 60 - 1);
+    UNIT_ASSERT(!ClockIsAlarmRinging(clock));
+    Advance(clock, 1);
+    UNIT_ASSERT(ClockIsAlarmRinging(clock));
+}
+
+static void TestStopAndDisableDiscardSnooze(void) {
+    clk_t clock = CreateClock(0x070000);
+    clock_time_t alarm = {.bcd = 0x070001};
+
+    UNIT_ASSERT(ClockSetAlarm(clock, &alarm));
+    Advance(clock, 1);
+    UNIT_ASSERT(ClockSnooze(clock, 1));
+    ClockStopAlarm(clock);
+    Advance(clock, 60);
+    UNIT_ASSERT(!ClockIsAlarmRinging(clock));
+
+    ClockEnableAlarm(clock, false);
+    UNIT_ASSERT(!ClockGetAlarm(clock, &alarm));
+    UNIT_ASSERT_BITS(0x070001, alarm.bcd);
+    Advance(clock, DAY_SECONDS);
+    UNIT_ASSERT(!ClockIsAlarmRinging(clock));
+
+    ClockEnableAlarm(clock, true);
+    Advance(clock, DAY_SECONDS);
+    UNIT_ASSERT(ClockIsAlarmRinging(clock));
+    ClockEnableAlarm(clock, false);
+    UNIT_ASSERT(!ClockIsAlarmRinging(clock));
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    static const unit_case_t cases[] = {
+        UNIT_CASE(TestNewClockHasNoValidTime, "un reloj nuevo no tiene hora válida ni alarma"),
+        UNIT_CASE(TestSecondAdvancesAfterAllTicks, "el segundo avanza al completar sus ticks"),
+        UNIT_CASE(TestCarriesBetweenDigits, "los acarreos de 9 a 10 y de 59 a 00 llegan hasta la medianoche"),
+        UNIT_CASE(TestFullDayMatchesBinaryCount, "un día completo coincide con la cuenta en binario"),
+        UNIT_CASE(TestSetTimeRejectsInvalidBcd, "la hora y la alarma rechazan valores BCD inválidos"),
+        UNIT_CASE(TestAlarmRingsOncePerDay, "la alarma suena una sola vez por día"),
+        UNIT_CASE(TestAlarmWaitsForValidTime, "la alarma no suena mientras el reloj no tiene hora válida"),
+        UNIT_CASE(TestSnoozeRearmsAlarm, "la posposición vuelve a activar la alarma"),
+        UNIT_CASE(TestStopAndDisableDiscardSnooze, "silenciar o deshabilitar la alarma descarta la posposición"),
+    };
+
+    return UnitRun("clock", cases, UNIT_COUNT(cases));
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,370 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_console.c
+ ** @brief Pruebas unitarias de la consola de comandos sobre el UART y el DMA simulados
+ **
+ ** Los bytes recibidos entran por la línea de recepción del UART simulado, al ritmo de la velocidad configurada, y lo
+ ** que la consola transmite se captura en un buffer en memoria para compararlo con la respuesta esperada.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include "console.h"
+#include "chip.h"
+#include "unit.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief Ciclos que tarda en llegar un carácter de diez bits, redondeados hacia arriba */
+#define CHARACTER_CYCLES (SystemCoreClock * 10 / CONSOLE_BAUDRATE + 1)
+
+/** @brief Ciclos entre dos atenciones de la consola, como en la tarea del programa */
+#define SERVICE_CYCLES (SystemCoreClock / 100)
+
+/** @brief Atenciones de la consola que alcanzan para transmitir la cola de transmisión completa */
+#define SETTLE_CALLS 50
+
+/** @brief Mayor cantidad de palabras que guarda el comando de prueba */
+#define ECHO_ARGS CONSOLE_MAX_ARGS
+
+/** @brief Mayor largo de las palabras que guarda el comando de prueba */
+#define ECHO_LENGTH 16
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Registro de las ejecuciones del comando de prueba.
+ */
+typedef struct echo_s {
+    uint32_t calls;                        /**< Cantidad de ejecuciones. */
+    void * object;                         /**< Objeto recibido en la última ejecución. */
+    uint8_t count;                         /**< Palabras de la última ejecución. */
+    char args[ECHO_ARGS][ECHO_LENGTH + 1]; /**< Copia de las palabras de la última ejecución. */
+} echo_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Comando de prueba que copia las palabras de la línea en el registro de ejecuciones.
+ *
+ * @param console  Consola que recibió el comando.
+ * @param line     Línea recibida.
+ * @param object   Objeto indicado al crear la consola.
+ */
+static void EchoCommand(console_t console, const console_line_t * line, void * object);
+
+/**
+ * @brief Crea la consola de las pruebas con el comando `eco` y captura lo que transmite.
+ *
+ * @return Instancia de la consola.
+ */
+static console_t CreateConsole(void);
+
+/**
+ * @brief Envía un texto a la consola y espera el tiempo que tardan en llegar sus caracteres, sin atenderla.
+ *
+ * @param text  Texto terminado en cero.
+ */
+static void Receive(const char * text);
+
+/**
+ * @brief Atiende la consola periódicamente hasta que tuvo tiempo de transmitir la cola de transmisión completa.
+ *
+ * @param console  Instancia de la consola.
+ */
+static void Settle(console_t console);
+
+/**
+ * @brief Devuelve lo que la consola transmitió desde la última llamada y lo descarta.
+ *
+ * @return Texto transmitido, terminado en cero.
+ */
+static const char * Transmitted(void);
+
+/* === Private variable definitions ================================================================================ */
+
+/** @brief Registro de las ejecuciones del comando de prueba */
+static echo_t echo;
+
+/** @brief Objeto que la consola entrega a los comandos */
+static int target;
+
+/** @brief Comandos de la consola de las pruebas */
+static const console_command_t commands[] = {
+    {.name = "eco", .help = "repite las palabras", .handler = EchoCommand},
+};
+
+/** @brief Archivo en memoria que recibe lo que transmite el UART de la consola */
+static FILE * output;
+
+/** @brief Buffer del archivo en memoria */
+static char * captured;
+
+/** @brief Cantidad de bytes del buffer del archivo en memoria */
+static size_t capturedSize;
+
+/** @brief Cantidad de bytes del buffer que ya se entregaron */
+static size_t capturedRead;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void EchoCommand(console_t console, const console_line_t * line, void * object) {
+    echo.calls++;
+    echo.object = object;
+    echo.count = ConsoleArgCount(line);
+    memset(echo.args, 0, sizeof(echo.args));
+    for (uint8_t index = 0; index < echo.count; index++) {
+        for (uint8_t offset = 0; (offset < ConsoleArgLength(line, index)) && (offset < ECHO_LENGTH); offset++) {
+            echo.args[index][offset] = ConsoleArgChar(line, index, offset);
+        }
+    }
+    ConsoleWrite(console, "ok\n");
+}
+
+static console_t CreateConsole(void) {
+    console_t console;
+
+    output = open_memstream(&captured, &capturedSize);
+    UNIT_ASSERT_NOT_NULL(output);
+    SimUartSetOutput(LPC_USART2, output);
+    console = ConsoleCreate(commands, UNIT_COUNT(commands), &target);
+    UNIT_ASSERT_NOT_NULL(console);
+    return console;
+}
+
+static void Receive(const char * text) {
+    size_t size = strlen(text);
+
+    UNIT_ASSERT_EQUAL(size, SimUartReceive(LPC_USART2, (const uint8_t *)text, size));
+    SimAddCycles(CHARACTER_CYCLES * (size + 1));
+}
+
+static void Settle(console_t console) {
+    for (uint8_t call = 0; call < SETTLE_CALLS; call++) {
+        ConsoleService(console);
+        SimAddCycles(SERVICE_CYCLES);
+    }
+}
+
+static const char * Transmitted(void) {
+    static char text[CONSOLE_TX_SIZE + 1];
+    size_t size;
+
+    fflush(output);
+    size = capturedSize - capturedRead;
+    UNIT_ASSERT(size < sizeof(text));
+    memcpy(text, captured + capturedRead, size);
+    text[size] = '\0';
+    capturedRead = capturedSize;
+    return text;
+}
+
+static void TestCommandReceivesWords(void) {
+    console_t console = CreateConsole();
+
+    Receive("eco  uno\tdos\n");
+    UNIT_ASSERT_EQUAL(0, echo.calls);
+    ConsoleService(console);
+    UNIT_ASSERT_EQUAL(1, echo.calls);
+    UNIT_ASSERT(echo.object == &target);
+    UNIT_ASSERT_EQUAL(3, echo.count);
+    UNIT_ASSERT(strcmp(echo.args[1], "uno") == 0);
+    UNIT_ASSERT(strcmp(echo.args[2], "dos") == 0);
+    Settle(console);
+    UNIT_ASSERT(strcmp(Transmitted(), "ok\r\n") == 0);
+}
+
+static void TestWordHelpers(void) {
+    console_t console = CreateConsole();
+    static const console_command_t check[] = {{.name = "eco", .help = "", .handler = EchoCommand}};
+
+    /* La segunda consola se rechaza aunque tenga otra tabla */
+    UNIT_ASSERT_NULL(ConsoleCreate(check, UNIT_COUNT(check), NULL));
+    Receive("eco abc\n");
+    ConsoleService(console);
+    UNIT_ASSERT_EQUAL(2, echo.count);
+    UNIT_ASSERT(strcmp(echo.args[1], "abc") == 0);
+    UNIT_ASSERT_EQUAL('\0', echo.args[2][0]);
+}
+
+static void TestCarriageReturnAndLineFeedRunOnce(void) {
+    console_t console = CreateConsole();
+    console_stats_t stats;
+
+    Receive("eco\r\n\r\neco\r");
+    ConsoleService(console);
+    ConsoleGetStats(console, &stats);
+    UNIT_ASSERT_EQUAL(2, echo.calls);
+    UNIT_ASSERT_EQUAL(2, stats.lines);
+}
+
+static void TestLineAcrossBufferEnd(void) {
+    console_t console = CreateConsole();
+    char spaces[CONSOLE_RX_SIZE];
+    console_stats_t stats;
+
+    /* Líneas de espacios, que no ejecutan nada, dejan el nombre del comando partido por el final del buffer */
+    memset(spaces, ' ', sizeof(spaces));
+    spaces[100] = '\n';
+    spaces[101] = '\0';
+    Receive(spaces);
+    ConsoleService(console);
+    Receive(spaces);
+    ConsoleService(console);
+    spaces[100] = ' ';
+    spaces[CONSOLE_RX_SIZE - 2 * 101 - 3] = '\n';
+    spaces[CONSOLE_RX_SIZE - 2 * 101 - 2] = '\0';
+    Receive(spaces);
+    Receive("eco ida vuelta\n");
+    ConsoleService(console);
+    ConsoleGetStats(console, &stats);
+    UNIT_ASSERT_EQUAL(1, stats.lines);
+    UNIT_ASSERT_EQUAL(1, echo.calls);
+    UNIT_ASSERT_EQUAL(3, echo.count);
+    UNIT_ASSERT(strcmp(echo.args[1], "ida") == 0);
+    UNIT_ASSERT(strcmp(echo.args[2], "vuelta") == 0);
+}
+
+static void TestReceptionDoesNotUseTheProcessor(void) {
+    console_t console = CreateConsole();
+    sim_chip_stats_t before;
+    sim_chip_stats_t after;
+
+    ConsoleService(console);
+    SimGetStats(&before);
+    Receive("eco uno dos tres\neco cuatro\n");
+    SimGetStats(&after);
+    UNIT_ASSERT_EQUAL(before.reads, after.reads);
+    UNIT_ASSERT_EQUAL(before.writes, after.writes);
+    UNIT_ASSERT_EQUAL(0, echo.calls);
+    ConsoleService(console);
+    UNIT_ASSERT_EQUAL(2, echo.calls);
+    UNIT_ASSERT(strcmp(echo.args[1], "cuatro") == 0);
+}
+
+static void TestUnknownCommandAndHelp(void) {
+    console_t console = CreateConsole();
+
+    Receive("nada\n");
+    Settle(console);
+    UNIT_ASSERT(strcmp(Transmitted(), "error: comando desconocido\r\n") == 0);
+    Receive("ayuda\n");
+    Settle(console);
+    UNIT_ASSERT(strstr(Transmitted(), "eco      repite las palabras\r\nayuda") != NULL);
+}
+
+static void TestTooManyWordsIsRejected(void) {
+    console_t console = CreateConsole();
+
+    Receive("eco 1 2 3 4\n");
+    Settle(console);
+    UNIT_ASSERT_EQUAL(0, echo.calls);
+    UNIT_ASSERT(strcmp(Transmitted(), "error: demasiadas palabras\r\n") == 0);
+}
+
+static void TestLongLineIsDiscarded(void) {
+    console_t console = CreateConsole();
+    char line[CONSOLE_RX_SIZE];
+    console_stats_t stats;
+
+    /* La línea larga llega en dos partes, como si la consola se atendiera mientras se recibe */
+    memset(line, 'x', sizeof(line));
+    line[CONSOLE_RX_SIZE / 2] = '\0';
+    Receive(line);
+    ConsoleService(console);
+    line[CONSOLE_RX_SIZE / 4] = '\0';
+    Receive(line);
+    Receive(" eco\neco\n");
+    Settle(console);
+    ConsoleGetStats(console, &stats);
+    UNIT_ASSERT_EQUAL(1, stats.discarded);
+    UNIT_ASSERT_EQUAL(1, echo.calls);
+    UNIT_ASSERT_EQUAL(1, echo.count);
+    UNIT_ASSERT(strcmp(Transmitted(), "error: línea demasiado larga\r\nok\r\n") == 0);
+}
+
+static void TestResponseWrapsTransmitQueue(void) {
+    console_t console = CreateConsole();
+    char text[CONSOLE_TX_SIZE];
+    console_stats_t stats;
+
+    /* El segundo texto empieza cerca del final de la cola y sigue desde el principio, en dos transferencias */
+    memset(text, 'a', sizeof(text));
+    text[CONSOLE_TX_SIZE - 100] = '\0';
+    UNIT_ASSERT(ConsoleWrite(console, text));
+    Settle(console);
+    UNIT_ASSERT_EQUAL(CONSOLE_TX_SIZE - 100, strlen(Transmitted()));
+    memset(text, 'b', sizeof(text));
+    text[CONSOLE_TX_SIZE / 2] = '\0';
+    UNIT_ASSERT(ConsoleWrite(console, text));
+    Settle(console);
+    ConsoleGetStats(console, &stats);
+    UNIT_ASSERT_EQUAL(3, stats.transfers);
+    UNIT_ASSERT_EQUAL(0, stats.dropped);
+    UNIT_ASSERT(strcmp(Transmitted(), text) == 0);
+}
+
+static void TestFullQueueDropsBytes(void) {
+    console_t console = CreateConsole();
+    char text[CONSOLE_TX_SIZE + 101];
+    console_stats_t stats;
+
+    memset(text, 'c', sizeof(text));
+    text[sizeof(text) - 1] = '\0';
+    UNIT_ASSERT(!ConsoleWrite(console, text));
+    Settle(console);
+    ConsoleGetStats(console, &stats);
+    UNIT_ASSERT_EQUAL(100, stats.dropped);
+    UNIT_ASSERT_EQUAL(CONSOLE_TX_SIZE, strlen(Transmitted()));
+
+    /* Con la cola vacía se vuelve a aceptar texto */
+    UNIT_ASSERT(ConsoleWrite(console, "fin\n"));
+    Settle(console);
+    UNIT_ASSERT(strcmp(Transmitted(), "fin\r\n") == 0);
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    static const unit_case_t cases[] = {
+        UNIT_CASE(TestCommandReceivesWords, "un comando recibe sus palabras y el objeto de la consola"),
+        UNIT_CASE(TestWordHelpers, "hay una única consola y las palabras inexistentes están vacías"),
+        UNIT_CASE(TestCarriageReturnAndLineFeedRunOnce, "retorno de carro y salto de línea terminan una sola línea"),
+        UNIT_CASE(TestLineAcrossBufferEnd, "una línea partida por el final del buffer se ejecuta sin copiarla"),
+        UNIT_CASE(TestReceptionDoesNotUseTheProcessor, "la recepción no accede a registros ni pide interrupciones"),
+        UNIT_CASE(TestUnknownCommandAndHelp, "un comando desconocido informa un error y ayuda lista los comandos"),
+        UNIT_CASE(TestTooManyWordsIsRejected, "una línea con demasiadas palabras se rechaza"),
+        UNIT_CASE(TestLongLineIsDiscarded, "una línea demasiado larga se descarta una sola vez"),
+        UNIT_CASE(TestResponseWrapsTransmitQueue, "una respuesta que da la vuelta a la cola se transmite completa"),
+        UNIT_CASE(TestFullQueueDropsBytes, "con la cola de transmisión llena se descartan y cuentan los bytes"),
+    };
+
+    return UnitRun("console", cases, UNIT_COUNT(cases));
+}
+
+/* === End of documentation ======================================================================================== */
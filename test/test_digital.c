@@ -0,0 +1,665 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_digital.c
+ ** @brief Pruebas unitarias del módulo de entradas y salidas digitales sobre el chip simulado
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include "digital.h"
+#include "chip.h"
+#include "unit.h"
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief Puerto GPIO de las salidas de las pruebas */
+#define OUTPUT_GPIO 5
+
+/** @brief Segundo puerto GPIO de las salidas de las pruebas, para los grupos que abarcan varios puertos */
+#define OUTPUT_GPIO_ALT 2
+
+/** @brief Puerto GPIO de las entradas de las pruebas */
+#define INPUT_GPIO 0
+
+/** @brief Segundo puerto GPIO de las entradas de las pruebas, para los bancos que abarcan varios puertos */
+#define INPUT_GPIO_ALT 1
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Registro de las funciones ejecutadas por un banco ante los cambios de una entrada.
+ */
+typedef struct handler_log_s {
+    digital_input_t input; /**< Última entrada que recibieron las funciones. */
+    uint8_t activated;     /**< Ejecuciones de la función de activación. */
+    uint8_t deactivated;   /**< Ejecuciones de la función de desactivación. */
+    uint8_t hold;          /**< Ejecuciones de la función de pulsación prolongada. */
+} handler_log_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Cuenta una activación en el registro de funciones ejecutadas.
+ *
+ * @param input   Entrada que cambió.
+ * @param object  Registro de funciones ejecutadas.
+ */
+static void LogActivated(digital_input_t input, void * object);
+
+/**
+ * @brief Cuenta una desactivación en el registro de funciones ejecutadas.
+ *
+ * @param input   Entrada que cambió.
+ * @param object  Registro de funciones ejecutadas.
+ */
+static void LogDeactivated(digital_input_t input, void * object);
+
+/**
+ * @brief Cuenta una pulsación prolongada en el registro de funciones ejecutadas.
+ *
+ * @param input   Entrada que sigue activa.
+ * @param object  Registro de funciones ejecutadas.
+ */
+static void LogHold(digital_input_t input, void * object);
+
+/* === Private variable definitions ================================================================================ */
+
+/** @brief Funciones que cuentan todos los cambios, con la pulsación prolongada a las tres exploraciones */
+static const digital_input_handlers_t LOG_HANDLERS = {
+    .activated = LogActivated,
+    .deactivated = LogDeactivated,
+    .hold = LogHold,
+    .holdScans = 3,
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void LogActivated(digital_input_t input, void * object) {
+    handler_log_t * log = object;
+    log->input = input;
+    log->activated++;
+}
+
+static void LogDeactivated(digital_input_t input, void * object) {
+    handler_log_t * log = object;
+    log->input = input;
+    log->deactivated++;
+}
+
+static void LogHold(digital_input_t input, void * object) {
+    handler_log_t * log = object;
+    log->input = input;
+    log->hold++;
+}
+
+static void TestOutputCreateStartsInactive(void) {
+    digital_output_t output = DigitalOutputCreate(OUTPUT_GPIO, 3);
+
+    UNIT_ASSERT_NOT_NULL(output);
+    UNIT_ASSERT_BITS(0, SimGpioGetOutputs(OUTPUT_GPIO));
+    UNIT_ASSERT_BITS(1u << 3, LPC_GPIO_PORT->DIR[OUTPUT_GPIO]);
+}
+
+static void TestOutputActivateDeactivateToggle(void) {
+    digital_output_t output = DigitalOutputCreate(OUTPUT_GPIO, 7);
+    digital_output_t other = DigitalOutputCreate(OUTPUT_GPIO, 8);
+
+    DigitalOutputActivate(other);
+    DigitalOutputActivate(output);
+    UNIT_ASSERT_BITS((1u << 7) | (1u << 8), SimGpioGetOutputs(OUTPUT_GPIO));
+    DigitalOutputDeactivate(output);
+    UNIT_ASSERT_BITS(1u << 8, SimGpioGetOutputs(OUTPUT_GPIO));
+    DigitalOutputToggle(output);
+    UNIT_ASSERT_BITS((1u << 7) | (1u << 8), SimGpioGetOutputs(OUTPUT_GPIO));
+    DigitalOutputToggle(output);
+    UNIT_ASSERT_BITS(1u << 8, SimGpioGetOutputs(OUTPUT_GPIO));
+}
+
+static void TestOutputPinAccessorsMatchFunctions(void) {
+    digital_output_t output = DigitalOutputCreate(OUTPUT_GPIO, 12);
+    const digital_pin_t * pin = DigitalOutputGetPin(output);
+
+    DigitalPinActivate(pin);
+    UNIT_ASSERT_BITS(1u << 12, SimGpioGetOutputs(OUTPUT_GPIO));
+    DigitalPinToggle(pin);
+    UNIT_ASSERT_BITS(0, SimGpioGetOutputs(OUTPUT_GPIO));
+    DigitalPinToggle(pin);
+    DigitalPinDeactivate(pin);
+    UNIT_ASSERT_BITS(0, SimGpioGetOutputs(OUTPUT_GPIO));
+}
+
+static void TestOutputPoolExhaustion(void) {
+    for (uint8_t index = 0; index < DIGITAL_OUTPUT_POOL_SIZE; index++) {
+        UNIT_ASSERT_NOT_NULL(DigitalOutputCreate(OUTPUT_GPIO, index));
+    }
+    UNIT_ASSERT_NULL(DigitalOutputCreate(OUTPUT_GPIO_ALT, 0));
+}
+
+static void TestOutputCreateManyAccessesEachPortOnce(void) {
+    static const digital_pin_location_t pins[] = {
+        {OUTPUT_GPIO, 1}, {OUTPUT_GPIO_ALT, 6}, {OUTPUT_GPIO, 4}, {OUTPUT_GPIO, 9}, {OUTPUT_GPIO_ALT, 0},
+    };
+    digital_output_t outputs[UNIT_COUNT(pins)];
+    sim_chip_stats_t before;
+    sim_chip_stats_t after;
+
+    /* Por cada puerto una escritura en CLR y una lectura y una escritura en DIR, sin importar cuántos pines tenga */
+    SimGetStats(&before);
+    UNIT_ASSERT(DigitalOutputCreateMany(pins, UNIT_COUNT(pins), outputs));
+    SimGetStats(&after);
+    UNIT_ASSERT_EQUAL(4, after.writes - before.writes);
+    UNIT_ASSERT_EQUAL(2, after.reads - before.reads);
+    UNIT_ASSERT_BITS((1u << 1) | (1u << 4) | (1u << 9), LPC_GPIO_PORT->DIR[OUTPUT_GPIO]);
+    UNIT_ASSERT_BITS((1u << 0) | (1u << 6), LPC_GPIO_PORT->DIR[OUTPUT_GPIO_ALT]);
+    UNIT_ASSERT_BITS(0, SimGpioGetOutputs(OUTPUT_GPIO));
+
+    /* Cada salida queda en la posición de su pin y se maneja como una creada por separado */
+    DigitalOutputActivate(outputs[3]);
+    DigitalOutputActivate(outputs[1]);
+    UNIT_ASSERT_BITS(1u << 9, SimGpioGetOutputs(OUTPUT_GPIO));
+    UNIT_ASSERT_BITS(1u << 6, SimGpioGetOutputs(OUTPUT_GPIO_ALT));
+}
+
+static void TestOutputCreateManyIsAllOrNothing(void) {
+    digital_pin_location_t pins[DIGITAL_OUTPUT_POOL_SIZE + 1];
+    digital_output_t outputs[DIGITAL_OUTPUT_POOL_SIZE + 1];
+
+    for (uint8_t index = 0; index < UNIT_COUNT(pins); index++) {
+        pins[index] = (digital_pin_location_t){OUTPUT_GPIO, index};
+    }
+    UNIT_ASSERT(!DigitalOutputCreateMany(pins, UNIT_COUNT(pins), outputs));
+    pins[0].gpio = 8;
+    UNIT_ASSERT(!DigitalOutputCreateMany(pins, 2, outputs));
+    UNIT_ASSERT_BITS(0, LPC_GPIO_PORT->DIR[OUTPUT_GPIO]);
+    UNIT_ASSERT(DigitalOutputCreateMany(&pins[1], DIGITAL_OUTPUT_POOL_SIZE, outputs));
+}
+
+static void TestOutputGetStateFollowsFunctions(void) {
+    digital_output_t output = DigitalOutputCreate(OUTPUT_GPIO, 6);
+
+    UNIT_ASSERT(!DigitalOutputGetState(output));
+    DigitalOutputActivate(output);
+    UNIT_ASSERT(DigitalOutputGetState(output));
+    DigitalOutputToggle(output);
+    UNIT_ASSERT(!DigitalOutputGetState(output));
+    DigitalOutputToggle(output);
+    UNIT_ASSERT(DigitalOutputGetState(output));
+    DigitalOutputDeactivate(output);
+    UNIT_ASSERT(!DigitalOutputGetState(output));
+}
+
+static void TestDeferredOutputWaitsForCommit(void) {
+    digital_output_t output = DigitalOutputCreate(OUTPUT_GPIO, 2);
+    digital_output_t other = DigitalOutputCreate(OUTPUT_GPIO_ALT, 5);
+
+    UNIT_ASSERT(DigitalOutputSetDeferred(output, true));
+    UNIT_ASSERT(DigitalOutputSetDeferred(other, true));
+    DigitalOutputActivate(output);
+    DigitalOutputToggle(other);
+    UNIT_ASSERT(DigitalOutputGetState(output));
+    UNIT_ASSERT(DigitalOutputGetState(other));
+    UNIT_ASSERT_BITS(0, SimGpioGetOutputs(OUTPUT_GPIO));
+    UNIT_ASSERT_BITS(0, SimGpioGetOutputs(OUTPUT_GPIO_ALT));
+    DigitalOutputCommit();
+    UNIT_ASSERT_BITS(1u << 2, SimGpioGetOutputs(OUTPUT_GPIO));
+    UNIT_ASSERT_BITS(1u << 5, SimGpioGetOutputs(OUTPUT_GPIO_ALT));
+
+    /* Al dejar de ser diferida, el cambio pendiente se escribe sin esperar a la confirmación */
+    DigitalOutputDeactivate(output);
+    UNIT_ASSERT(DigitalOutputSetDeferred(output, false));
+    UNIT_ASSERT_BITS(0, SimGpioGetOutputs(OUTPUT_GPIO));
+    DigitalOutputActivate(output);
+    UNIT_ASSERT_BITS(1u << 2, SimGpioGetOutputs(OUTPUT_GPIO));
+}
+
+static void TestCommitWritesOnlyChangedBits(void) {
+    digital_output_t outputs[] = {
+        DigitalOutputCreate(OUTPUT_GPIO, 0),
+        DigitalOutputCreate(OUTPUT_GPIO, 1),
+        DigitalOutputCreate(OUTPUT_GPIO, 2),
+    };
+    digital_output_t outsider = DigitalOutputCreate(OUTPUT_GPIO, 3);
+    sim_chip_stats_t before;
+    sim_chip_stats_t after;
+
+    for (uint8_t index = 0; index < UNIT_COUNT(outputs); index++) {
+        UNIT_ASSERT(DigitalOutputSetDeferred(outputs[index], true));
+    }
+    DigitalOutputActivate(outsider);
+    DigitalOutputActivate(outputs[0]);
+    DigitalOutputActivate(outputs[2]);
+    DigitalOutputCommit();
+
+    /* Los cambios que vuelven al estado confirmado o repiten el estado actual no acceden al puerto */
+    SimGetStats(&before);
+    DigitalOutputActivate(outputs[0]);
+    DigitalOutputToggle(outputs[1]);
+    DigitalOutputToggle(outputs[1]);
+    DigitalOutputCommit();
+    SimGetStats(&after);
+    UNIT_ASSERT_EQUAL(0, after.writes - before.writes);
+
+    /* Una escritura en SET y otra en CLR por puerto, sin importar cuántas salidas cambiaron */
+    SimGetStats(&before);
+    DigitalOutputDeactivate(outputs[0]);
+    DigitalOutputActivate(outputs[1]);
+    DigitalOutputDeactivate(outputs[2]);
+    DigitalOutputCommit();
+    SimGetStats(&after);
+    UNIT_ASSERT_EQUAL(2, after.writes - before.writes);
+    UNIT_ASSERT_BITS((1u << 1) | (1u << 3), SimGpioGetOutputs(OUTPUT_GPIO));
+}
+
+static void TestSetDeferredRejectsDirectOutputs(void) {
+    digital_output_t grouped[] = {DigitalOutputCreate(OUTPUT_GPIO, 0)};
+    digital_output_t pinned = DigitalOutputCreate(OUTPUT_GPIO, 1);
+    digital_output_t deferred = DigitalOutputCreate(OUTPUT_GPIO, 2);
+
+    UNIT_ASSERT_NOT_NULL(DigitalOutputGroupCreate(grouped, UNIT_COUNT(grouped)));
+    UNIT_ASSERT_NOT_NULL(DigitalOutputGetPin(pinned));
+    UNIT_ASSERT(!DigitalOutputSetDeferred(grouped[0], true));
+    UNIT_ASSERT(!DigitalOutputSetDeferred(pinned, true));
+    UNIT_ASSERT(DigitalOutputSetDeferred(deferred, true));
+    UNIT_ASSERT_NULL(DigitalOutputGetPin(deferred));
+    UNIT_ASSERT_NULL(DigitalOutputGroupCreate(&deferred, 1));
+}
+
+static void TestGroupWriteAcrossPorts(void) {
+    digital_output_t outputs[] = {
+        DigitalOutputCreate(OUTPUT_GPIO, 0),
+        DigitalOutputCreate(OUTPUT_GPIO_ALT, 4),
+        DigitalOutputCreate(OUTPUT_GPIO, 9),
+    };
+    digital_output_t outsider = DigitalOutputCreate(OUTPUT_GPIO, 1);
+    digital_output_group_t group = DigitalOutputGroupCreate(outputs, UNIT_COUNT(outputs));
+
+    sim_chip_stats_t before, after;
+
+    UNIT_ASSERT_NOT_NULL(group);
+    DigitalOutputActivate(outsider);
+
+    /* Una máscara dejada por otro contexto en el puerto no afecta la escritura, que no usa ni cambia MASK */
+    LPC_GPIO_PORT->MASK[OUTPUT_GPIO] = ~(1u << 1);
+    SimGetStats(&before);
+    DigitalOutputGroupWrite(group, 0x5);
+    SimGetStats(&after);
+    UNIT_ASSERT_EQUAL(2 * 2, after.writes - before.writes);
+    UNIT_ASSERT_EQUAL(0, after.reads - before.reads);
+    UNIT_ASSERT_BITS(~(1u << 1), LPC_GPIO_PORT->MASK[OUTPUT_GPIO]);
+    UNIT_ASSERT_BITS((1u << 0) | (1u << 1) | (1u << 9), SimGpioGetOutputs(OUTPUT_GPIO));
+    UNIT_ASSERT_BITS(0, SimGpioGetOutputs(OUTPUT_GPIO_ALT));
+    DigitalOutputGroupWrite(group, 0x2 | 0x80);
+    UNIT_ASSERT_BITS(1u << 1, SimGpioGetOutputs(OUTPUT_GPIO));
+    UNIT_ASSERT_BITS(1u << 4, SimGpioGetOutputs(OUTPUT_GPIO_ALT));
+    DigitalOutputGroupToggle(group);
+    UNIT_ASSERT_BITS((1u << 0) | (1u << 1) | (1u << 9), SimGpioGetOutputs(OUTPUT_GPIO));
+    UNIT_ASSERT_BITS(0, SimGpioGetOutputs(OUTPUT_GPIO_ALT));
+    DigitalOutputGroupActivate(group);
+    UNIT_ASSERT_BITS(1u << 4, SimGpioGetOutputs(OUTPUT_GPIO_ALT));
+    DigitalOutputGroupDeactivate(group);
+    UNIT_ASSERT_BITS(1u << 1, SimGpioGetOutputs(OUTPUT_GPIO));
+    UNIT_ASSERT_BITS(0, SimGpioGetOutputs(OUTPUT_GPIO_ALT));
+}
+
+static void TestGroupCreateRejectsInvalidParameters(void) {
+    digital_output_t outputs[DIGITAL_GROUP_MAX_PORTS + 1];
+
+    for (uint8_t index = 0; index < UNIT_COUNT(outputs); index++) {
+        outputs[index] = DigitalOutputCreate(index, 0);
+    }
+    UNIT_ASSERT_NULL(DigitalOutputGroupCreate(NULL, 1));
+    UNIT_ASSERT_NULL(DigitalOutputGroupCreate(outputs, 0));
+    UNIT_ASSERT_NULL(DigitalOutputGroupCreate(outputs, UNIT_COUNT(outputs)));
+    UNIT_ASSERT_NOT_NULL(DigitalOutputGroupCreate(outputs, DIGITAL_GROUP_MAX_PORTS));
+}
+
+static void TestInputCreateSeedsLastState(void) {
+    digital_input_t released;
+    digital_input_t pressed;
+
+    /* Una tecla con lógica invertida que está en reposo, y otra que ya está presionada al crear la entrada */
+    SimGpioSetInput(INPUT_GPIO, 4, true);
+    SimGpioSetInput(INPUT_GPIO, 8, false);
+    released = DigitalInputCreate(INPUT_GPIO, 4, true);
+    pressed = DigitalInputCreate(INPUT_GPIO, 8, true);
+
+    UNIT_ASSERT(!DigitalInputGetIsActive(released));
+    UNIT_ASSERT(DigitalInputGetIsActive(pressed));
+    UNIT_ASSERT_EQUAL(DIGITAL_INPUT_NO_CHANGE, DigitalInputWasChanged(released));
+    UNIT_ASSERT_EQUAL(DIGITAL_INPUT_NO_CHANGE, DigitalInputWasChanged(pressed));
+    UNIT_ASSERT_BITS(0, LPC_GPIO_PORT->DIR[INPUT_GPIO]);
+}
+
+static void TestInputCreateManyReadsEachPortOnce(void) {
+    static const digital_pin_location_t pins[] = {{INPUT_GPIO, 4}, {INPUT_GPIO_ALT, 9}, {INPUT_GPIO, 8}};
+    digital_input_t inputs[UNIT_COUNT(pins)];
+    sim_chip_stats_t before;
+    sim_chip_stats_t after;
+
+    LPC_GPIO_PORT->DIR[INPUT_GPIO] = (1u << 4) | (1u << 5);
+    SimGpioSetInput(INPUT_GPIO, 4, true);
+    SimGpioSetInput(INPUT_GPIO, 8, false);
+    SimGpioSetInput(INPUT_GPIO_ALT, 9, true);
+
+    /* Por cada puerto una lectura y una escritura en DIR y una lectura del nivel de los pines */
+    SimGetStats(&before);
+    UNIT_ASSERT(DigitalInputCreateMany(pins, UNIT_COUNT(pins), true, inputs));
+    SimGetStats(&after);
+    UNIT_ASSERT_EQUAL(2, after.writes - before.writes);
+    UNIT_ASSERT_EQUAL(4, after.reads - before.reads);
+    UNIT_ASSERT_BITS(1u << 5, LPC_GPIO_PORT->DIR[INPUT_GPIO]);
+
+    UNIT_ASSERT(!DigitalInputGetIsActive(inputs[0]));
+    UNIT_ASSERT(DigitalInputGetIsActive(inputs[2]));
+    UNIT_ASSERT_EQUAL(DIGITAL_INPUT_NO_CHANGE, DigitalInputWasChanged(inputs[2]));
+    SimGpioSetInput(INPUT_GPIO_ALT, 9, false);
+    UNIT_ASSERT_EQUAL(DIGITAL_INPUT_WAS_ACTIVATED, DigitalInputWasChanged(inputs[1]));
+}
+
+static void TestInputWasChangedReportsOneEdgePerTransition(void) {
+    digital_input_t input = DigitalInputCreate(INPUT_GPIO, 9, false);
+
+    SimGpioSetInput(INPUT_GPIO, 9, true);
+    UNIT_ASSERT_EQUAL(DIGITAL_INPUT_WAS_ACTIVATED, DigitalInputWasChanged(input));
+    UNIT_ASSERT_EQUAL(DIGITAL_INPUT_NO_CHANGE, DigitalInputWasChanged(input));
+    UNIT_ASSERT(DigitalInputGetIsActive(input));
+    SimGpioSetInput(INPUT_GPIO, 9, false);
+    UNIT_ASSERT_EQUAL(DIGITAL_INPUT_WAS_DEACTIVATED, DigitalInputWasChanged(input));
+    UNIT_ASSERT_EQUAL(DIGITAL_INPUT_NO_CHANGE, DigitalInputWasChanged(input));
+}
+
+static void TestInputWasActivatedAndDeactivatedWithInvertedLogic(void) {
+    digital_input_t input;
+
+    SimGpioSetInput(INPUT_GPIO, 10, true);
+    input = DigitalInputCreate(INPUT_GPIO, 10, true);
+    SimGpioSetInput(INPUT_GPIO, 10, false);
+    UNIT_ASSERT(DigitalInputWasActivated(input));
+    UNIT_ASSERT(!DigitalInputWasActivated(input));
+    SimGpioSetInput(INPUT_GPIO, 10, true);
+    UNIT_ASSERT(!DigitalInputWasActivated(input));
+    UNIT_ASSERT(!DigitalInputWasDeactivated(input));
+    UNIT_ASSERT(!DigitalPinGetIsActive(DigitalInputGetPin(input)));
+}
+
+static void TestInputPoolExhaustion(void) {
+    for (uint8_t index = 0; index < DIGITAL_INPUT_POOL_SIZE; index++) {
+        UNIT_ASSERT_NOT_NULL(DigitalInputCreate(INPUT_GPIO, index, false));
+    }
+    UNIT_ASSERT_NULL(DigitalInputCreate(INPUT_GPIO_ALT, 0, false));
+}
+
+static void TestBankScanReportsMasksPerPort(void) {
+    digital_input_t inputs[3];
+    digital_input_bank_t bank;
+
+    SimGpioSetInput(INPUT_GPIO, 4, true);
+    inputs[0] = DigitalInputCreate(INPUT_GPIO, 4, true);
+    inputs[1] = DigitalInputCreate(INPUT_GPIO, 8, false);
+    inputs[2] = DigitalInputCreate(INPUT_GPIO_ALT, 9, false);
+    bank = DigitalInputBankCreate(inputs, UNIT_COUNT(inputs));
+    UNIT_ASSERT_NOT_NULL(bank);
+
+    SimGpioSetInput(INPUT_GPIO, 4, false);
+    SimGpioSetInput(INPUT_GPIO_ALT, 9, true);
+    SimGpioSetInput(INPUT_GPIO, 5, true);
+    /* Hasta la próxima exploración las consultas responden con la captura anterior */
+    UNIT_ASSERT(!DigitalInputGetIsActive(inputs[0]));
+    DigitalInputBankScan(bank);
+    UNIT_ASSERT_BITS(1u << 4, DigitalInputBankGetState(bank, INPUT_GPIO));
+    UNIT_ASSERT_BITS(1u << 4, DigitalInputBankGetActivated(bank, INPUT_GPIO));
+    UNIT_ASSERT_BITS(1u << 9, DigitalInputBankGetActivated(bank, INPUT_GPIO_ALT));
+    UNIT_ASSERT_BITS(0, DigitalInputBankGetState(bank, OUTPUT_GPIO));
+    UNIT_ASSERT(DigitalInputGetIsActive(inputs[0]));
+
+    DigitalInputBankScan(bank);
+    UNIT_ASSERT_BITS(0, DigitalInputBankGetActivated(bank, INPUT_GPIO));
+    SimGpioSetInput(INPUT_GPIO_ALT, 9, false);
+    DigitalInputBankScan(bank);
+    UNIT_ASSERT_BITS(1u << 9, DigitalInputBankGetDeactivated(bank, INPUT_GPIO_ALT));
+    UNIT_ASSERT_BITS(0, DigitalInputBankGetDeactivated(bank, INPUT_GPIO));
+}
+
+static void TestBankWasChangedReportsEachEdgeOnce(void) {
+    digital_input_t input = DigitalInputCreate(INPUT_GPIO, 2, false);
+    digital_input_bank_t bank = DigitalInputBankCreate(&input, 1);
+
+    SimGpioSetInput(INPUT_GPIO, 2, true);
+    DigitalInputBankScan(bank);
+    DigitalInputBankScan(bank);
+    UNIT_ASSERT_EQUAL(DIGITAL_INPUT_WAS_ACTIVATED, DigitalInputWasChanged(input));
+    UNIT_ASSERT_EQUAL(DIGITAL_INPUT_NO_CHANGE, DigitalInputWasChanged(input));
+    SimGpioSetInput(INPUT_GPIO, 2, false);
+    DigitalInputBankScan(bank);
+    UNIT_ASSERT_EQUAL(DIGITAL_INPUT_WAS_DEACTIVATED, DigitalInputWasChanged(input));
+    UNIT_ASSERT_EQUAL(DIGITAL_INPUT_NO_CHANGE, DigitalInputWasChanged(input));
+}
+
+static void TestBankDebounceNeedsConsecutiveSamples(void) {
+    digital_input_t input = DigitalInputCreate(INPUT_GPIO, 6, false);
+    digital_input_bank_t bank = DigitalInputBankCreate(&input, 1);
+
+    UNIT_ASSERT(!DigitalInputBankSetDebounce(bank, 0));
+    UNIT_ASSERT(!DigitalInputBankSetDebounce(bank, 1u << DIGITAL_DEBOUNCE_BITS));
+    UNIT_ASSERT(DigitalInputBankSetDebounce(bank, 3));
+
+    /* Un rebote reinicia la cuenta de muestras estables */
+    SimGpioSetInput(INPUT_GPIO, 6, true);
+    DigitalInputBankScan(bank);
+    DigitalInputBankScan(bank);
+    SimGpioSetInput(INPUT_GPIO, 6, false);
+    DigitalInputBankScan(bank);
+    SimGpioSetInput(INPUT_GPIO, 6, true);
+    DigitalInputBankScan(bank);
+    DigitalInputBankScan(bank);
+    UNIT_ASSERT(!DigitalInputGetIsActive(input));
+    DigitalInputBankScan(bank);
+    UNIT_ASSERT(DigitalInputGetIsActive(input));
+    UNIT_ASSERT_BITS(1u << 6, DigitalInputBankGetActivated(bank, INPUT_GPIO));
+}
+
+static void TestBankCreateRejectsInvalidInputs(void) {
+    digital_input_t inputs[DIGITAL_BANK_MAX_PORTS + 1];
+
+    for (uint8_t index = 0; index < UNIT_COUNT(inputs); index++) {
+        inputs[index] = DigitalInputCreate(index, 1, false);
+    }
+    UNIT_ASSERT_NULL(DigitalInputBankCreate(NULL, 1));
+    UNIT_ASSERT_NULL(DigitalInputBankCreate(inputs, 0));
+    UNIT_ASSERT_NULL(DigitalInputBankCreate(inputs, UNIT_COUNT(inputs)));
+    UNIT_ASSERT_NOT_NULL(DigitalInputBankCreate(inputs, 1));
+    UNIT_ASSERT_NULL(DigitalInputBankCreate(inputs, 2));
+    UNIT_ASSERT(!DigitalInputAttachInterrupt(inputs[0], 0));
+}
+
+static void TestBankHandlersRunOncePerEdge(void) {
+    digital_input_t inputs[] = {
+        DigitalInputCreate(INPUT_GPIO, 4, true),
+        DigitalInputCreate(INPUT_GPIO_ALT, 20, false),
+    };
+    digital_input_bank_t bank;
+    handler_log_t first = {0};
+    handler_log_t second = {0};
+
+    SimGpioSetInput(INPUT_GPIO, 4, true);
+    bank = DigitalInputBankCreate(inputs, UNIT_COUNT(inputs));
+    UNIT_ASSERT(DigitalInputSetHandlers(inputs[0], &LOG_HANDLERS, &first));
+    UNIT_ASSERT(DigitalInputSetHandlers(inputs[1], &(digital_input_handlers_t){.activated = LogActivated}, &second));
+
+    /* Las dos entradas cambian en la misma exploración y cada una recibe su propio objeto */
+    SimGpioSetInput(INPUT_GPIO, 4, false);
+    SimGpioSetInput(INPUT_GPIO_ALT, 20, true);
+    DigitalInputBankScan(bank);
+    UNIT_ASSERT_EQUAL(1, first.activated);
+    UNIT_ASSERT(first.input == inputs[0]);
+    UNIT_ASSERT_EQUAL(1, second.activated);
+    UNIT_ASSERT(second.input == inputs[1]);
+    DigitalInputBankScan(bank);
+    UNIT_ASSERT_EQUAL(1, first.activated);
+    UNIT_ASSERT_EQUAL(1, second.activated);
+
+    /* Las funciones no consumen los cambios que informa DigitalInputWasChanged() */
+    UNIT_ASSERT_EQUAL(DIGITAL_INPUT_WAS_ACTIVATED, DigitalInputWasChanged(inputs[0]));
+
+    SimGpioSetInput(INPUT_GPIO, 4, true);
+    SimGpioSetInput(INPUT_GPIO_ALT, 20, false);
+    DigitalInputBankScan(bank);
+    UNIT_ASSERT_EQUAL(1, first.deactivated);
+    UNIT_ASSERT_EQUAL(0, second.deactivated);
+}
+
+static void TestBankHoldHandlerRunsOncePerPress(void) {
+    digital_input_t input = DigitalInputCreate(INPUT_GPIO, 7, false);
+    digital_input_bank_t bank = DigitalInputBankCreate(&input, 1);
+    handler_log_t log = {0};
+
+    UNIT_ASSERT(DigitalInputSetHandlers(input, &LOG_HANDLERS, &log));
+
+    /* Una pulsación breve no llega a la pulsación prolongada */
+    SimGpioSetInput(INPUT_GPIO, 7, true);
+    DigitalInputBankScan(bank);
+    DigitalInputBankScan(bank);
+    SimGpioSetInput(INPUT_GPIO, 7, false);
+    DigitalInputBankScan(bank);
+    DigitalInputBankScan(bank);
+    DigitalInputBankScan(bank);
+    UNIT_ASSERT_EQUAL(0, log.hold);
+
+    SimGpioSetInput(INPUT_GPIO, 7, true);
+    for (uint8_t scan = 0; scan < 3; scan++) {
+        DigitalInputBankScan(bank);
+        UNIT_ASSERT_EQUAL(0, log.hold);
+    }
+    DigitalInputBankScan(bank);
+    UNIT_ASSERT_EQUAL(1, log.hold);
+    for (uint8_t scan = 0; scan < 10; scan++) {
+        DigitalInputBankScan(bank);
+    }
+    UNIT_ASSERT_EQUAL(1, log.hold);
+    UNIT_ASSERT_EQUAL(2, log.activated);
+    UNIT_ASSERT_EQUAL(1, log.deactivated);
+}
+
+static void TestSetHandlersRejectsInvalidInputs(void) {
+    digital_input_t direct = DigitalInputCreate(INPUT_GPIO, 1, false);
+    digital_input_t member = DigitalInputCreate(INPUT_GPIO, 2, false);
+    digital_input_bank_t bank = DigitalInputBankCreate(&member, 1);
+    handler_log_t log = {0};
+
+    UNIT_ASSERT(!DigitalInputSetHandlers(direct, &LOG_HANDLERS, &log));
+    UNIT_ASSERT(!DigitalInputSetHandlers(member, &(digital_input_handlers_t){.hold = LogHold}, &log));
+
+    /* Sin funciones registradas los cambios ya no se informan al registro */
+    UNIT_ASSERT(DigitalInputSetHandlers(member, &LOG_HANDLERS, &log));
+    UNIT_ASSERT(DigitalInputSetHandlers(member, NULL, NULL));
+    SimGpioSetInput(INPUT_GPIO, 2, true);
+    DigitalInputBankScan(bank);
+    UNIT_ASSERT_EQUAL(0, log.activated);
+}
+
+static void TestInterruptKeepsPulsesShorterThanPolling(void) {
+    digital_input_t input = DigitalInputCreate(INPUT_GPIO, 3, false);
+    digital_event_t event;
+
+    UNIT_ASSERT(DigitalInputAttachInterrupt(input, 2));
+    /* Una pulsación completa entre dos consultas */
+    SimGpioSetInput(INPUT_GPIO, 3, true);
+    SimGpioSetInput(INPUT_GPIO, 3, false);
+    UNIT_ASSERT_EQUAL(DIGITAL_INPUT_WAS_ACTIVATED, DigitalInputWasChanged(input));
+    UNIT_ASSERT_EQUAL(DIGITAL_INPUT_WAS_DEACTIVATED, DigitalInputWasChanged(input));
+    UNIT_ASSERT_EQUAL(DIGITAL_INPUT_NO_CHANGE, DigitalInputWasChanged(input));
+
+    UNIT_ASSERT(DigitalInputGetEvent(&event));
+    UNIT_ASSERT(event.input == input);
+    UNIT_ASSERT_EQUAL(DIGITAL_INPUT_WAS_ACTIVATED, event.edge);
+    UNIT_ASSERT(DigitalInputGetEvent(&event));
+    UNIT_ASSERT_EQUAL(DIGITAL_INPUT_WAS_DEACTIVATED, event.edge);
+    UNIT_ASSERT(!DigitalInputGetEvent(&event));
+}
+
+static void TestInterruptQueueCountsLostEvents(void) {
+    digital_input_t input = DigitalInputCreate(INPUT_GPIO, 11, false);
+    digital_event_t event;
+
+    UNIT_ASSERT(DigitalInputAttachInterrupt(input, 0));
+    for (uint32_t index = 0; index < DIGITAL_EVENT_QUEUE_SIZE + 3; index++) {
+        SimGpioSetInput(INPUT_GPIO, 11, (index & 1) == 0);
+    }
+    UNIT_ASSERT_EQUAL(3, DigitalInputGetLostEvents());
+    for (uint32_t index = 0; index < DIGITAL_EVENT_QUEUE_SIZE; index++) {
+        UNIT_ASSERT(DigitalInputGetEvent(&event));
+    }
+    UNIT_ASSERT(!DigitalInputGetEvent(&event));
+}
+
+static void TestAttachInterruptRejectsInvalidChannels(void) {
+    digital_input_t first = DigitalInputCreate(INPUT_GPIO, 12, false);
+    digital_input_t second = DigitalInputCreate(INPUT_GPIO, 13, false);
+
+    UNIT_ASSERT(!DigitalInputAttachInterrupt(first, 8));
+    UNIT_ASSERT(!DigitalInputAttachInterrupt(first, UINT8_MAX));
+    UNIT_ASSERT(DigitalInputAttachInterrupt(first, 5));
+    UNIT_ASSERT(!DigitalInputAttachInterrupt(second, 5));
+    UNIT_ASSERT(!DigitalInputAttachInterrupt(first, 6));
+    UNIT_ASSERT_NULL(DigitalInputBankCreate(&first, 1));
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    static const unit_case_t cases[] = {
+        UNIT_CASE(TestOutputCreateStartsInactive, "una salida nueva queda configurada e inactiva"),
+        UNIT_CASE(TestOutputActivateDeactivateToggle, "activar, desactivar y conmutar cambian solo su bit"),
+        UNIT_CASE(TestOutputPinAccessorsMatchFunctions, "los accesos directos al pin equivalen a las funciones"),
+        UNIT_CASE(TestOutputPoolExhaustion, "la reserva de salidas se agota en DIGITAL_OUTPUT_POOL_SIZE"),
+        UNIT_CASE(TestOutputCreateManyAccessesEachPortOnce, "la creación en bloque accede una vez a cada puerto"),
+        UNIT_CASE(TestOutputCreateManyIsAllOrNothing, "la creación en bloque crea todas las salidas o ninguna"),
+        UNIT_CASE(TestOutputGetStateFollowsFunctions, "el estado de una salida se consulta sin leer el puerto"),
+        UNIT_CASE(TestDeferredOutputWaitsForCommit, "una salida diferida cambia el pin recién al confirmar"),
+        UNIT_CASE(TestCommitWritesOnlyChangedBits, "la confirmación escribe solo los bits que cambiaron"),
+        UNIT_CASE(TestSetDeferredRejectsDirectOutputs, "una salida con acceso directo al pin no puede ser diferida"),
+        UNIT_CASE(TestGroupWriteAcrossPorts, "un grupo escribe patrones en varios puertos sin tocar otros bits"),
+        UNIT_CASE(TestGroupCreateRejectsInvalidParameters, "un grupo rechaza parámetros inválidos"),
+        UNIT_CASE(TestInputCreateSeedsLastState, "una entrada nueva toma como último estado el nivel actual"),
+        UNIT_CASE(TestInputCreateManyReadsEachPortOnce, "la creación en bloque de entradas lee una vez cada puerto"),
+        UNIT_CASE(TestInputWasChangedReportsOneEdgePerTransition, "cada transición se informa una única vez"),
+        UNIT_CASE(TestInputWasActivatedAndDeactivatedWithInvertedLogic, "la lógica invertida se aplica a los flancos"),
+        UNIT_CASE(TestInputPoolExhaustion, "la reserva de entradas se agota en DIGITAL_INPUT_POOL_SIZE"),
+        UNIT_CASE(TestBankScanReportsMasksPerPort, "un banco informa estado y flancos por puerto"),
+        UNIT_CASE(TestBankWasChangedReportsEachEdgeOnce, "las entradas de un banco informan cada flanco una vez"),
+        UNIT_CASE(TestBankDebounceNeedsConsecutiveSamples, "el antirrebote exige muestras consecutivas estables"),
+        UNIT_CASE(TestBankCreateRejectsInvalidInputs, "un banco rechaza entradas inválidas o ya asignadas"),
+        UNIT_CASE(TestBankHandlersRunOncePerEdge, "las funciones de un banco se ejecutan una vez por flanco"),
+        UNIT_CASE(TestBankHoldHandlerRunsOncePerPress, "la pulsación prolongada se informa una vez por pulsación"),
+        UNIT_CASE(TestSetHandlersRejectsInvalidInputs, "las funciones solo se registran en entradas de un banco"),
+        UNIT_CASE(TestInterruptKeepsPulsesShorterThanPolling, "la interrupción conserva pulsos entre consultas"),
+        UNIT_CASE(TestInterruptQueueCountsLostEvents, "la cola de eventos llena cuenta los descartados"),
+        UNIT_CASE(TestAttachInterruptRejectsInvalidChannels, "la asociación rechaza canales inválidos u ocupados"),
+    };
+
+    return UnitRun("digital", cases, UNIT_COUNT(cases));
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,277 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_display.c
+ ** @brief Pruebas unitarias de la pantalla multiplexada sobre el chip simulado
+ **
+ ** La interrupción del temporizador 0 refresca la pantalla mientras el tiempo virtual avanza. Un observador de los
+ ** puertos toma el patrón presente en los segmentos cada vez que se enciende un dígito, como lo vería el ojo, y
+ ** verifica que los segmentos nunca cambien con un dígito encendido.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include "display.h"
+#include "chip.h"
+#include "unit.h"
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief Puerto GPIO de las salidas que encienden los dígitos */
+#define DIGIT_GPIO 0
+
+/** @brief Puerto GPIO de las salidas de los segmentos, en los bits 0 a 7 */
+#define SEGMENT_GPIO 5
+
+/** @brief Dígitos de la pantalla de las pruebas */
+#define DIGITS 4
+
+/** @brief Dígitos que se encienden por segundo */
+#define REFRESH_HZ 1000
+
+/** @brief Ciclos entre dos refrescos */
+#define REFRESH_CYCLES (SystemCoreClock / REFRESH_HZ)
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Registra lo que muestra cada dígito al encenderse y verifica que no se vean patrones de otros dígitos.
+ *
+ * @param object  No se usa.
+ * @param port    Puerto que cambió.
+ * @param level   Nivel de todos los pines del puerto.
+ */
+static void DisplayObserver(void * object, uint8_t port, uint32_t level);
+
+/**
+ * @brief Crea la pantalla de las pruebas e instala el observador.
+ *
+ * @return Instancia de la pantalla.
+ */
+static display_t CreateDisplay(void);
+
+/**
+ * @brief Avanza el tiempo virtual hasta que la interrupción encienda una cantidad de dígitos.
+ *
+ * Falla si los dígitos no se encienden en el tiempo de dos refrescos por cada uno.
+ *
+ * @param count  Cantidad de refrescos.
+ */
+static void Refresh(uint16_t count);
+
+/* === Private variable definitions ================================================================================ */
+
+/** @brief Patrón que mostró cada dígito la última vez que se encendió */
+static uint8_t shown[DIGITS];
+
+/** @brief Dígito encendido en cada refresco, en orden */
+static uint8_t lit[4 * DIGITS];
+
+/** @brief Cantidad de refrescos observados */
+static uint16_t refreshes;
+
+/** @brief Indica que se encendieron dos dígitos a la vez o que los segmentos cambiaron con un dígito encendido */
+static bool ghosting;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void DisplayObserver(void * object, uint8_t port, uint32_t level) {
+    static uint32_t previous;
+    uint32_t digits = SimGpioGetOutputs(DIGIT_GPIO) & ((1u << DIGITS) - 1);
+    uint32_t rise = digits & ~previous;
+
+    (void)object;
+    (void)level;
+    if ((port == SEGMENT_GPIO) && (digits != 0)) {
+        ghosting = true;
+    }
+    if (port != DIGIT_GPIO) {
+        return;
+    }
+    previous = digits;
+    if (digits & (digits - 1)) {
+        ghosting = true;
+    }
+    for (uint8_t digit = 0; digit < DIGITS; digit++) {
+        if (rise & (1u << digit)) {
+            shown[digit] = SimGpioGetOutputs(SEGMENT_GPIO) & 0xFF;
+            if (refreshes < UNIT_COUNT(lit)) {
+                lit[refreshes] = digit;
+            }
+            refreshes++;
+        }
+    }
+}
+
+static display_t CreateDisplay(void) {
+    digital_output_t digits[DIGITS];
+    digital_output_t segments[8];
+    display_t display;
+
+    for (uint8_t index = 0; index < DIGITS; index++) {
+        digits[index] = DigitalOutputCreate(DIGIT_GPIO, index);
+    }
+    for (uint8_t index = 0; index < 8; index++) {
+        segments[index] = DigitalOutputCreate(SEGMENT_GPIO, index);
+    }
+    display = DisplayCreate(digits, DIGITS, segments);
+    UNIT_ASSERT_NOT_NULL(display);
+    SimSetPortObserver(DisplayObserver, NULL);
+    return display;
+}
+
+static void Refresh(uint16_t count) {
+    uint16_t target = refreshes + count;
+
+    /* Los pasos son menores que un período para no pasarse al refresco siguiente, y si un dígito deja de encenderse
+     * la espera termina con una falla en lugar de no terminar */
+    for (uint32_t step = 0; (refreshes < target) && (step < 16u * count); step++) {
+        SimAddCycles(REFRESH_CYCLES / 8);
+    }
+    UNIT_ASSERT_EQUAL(target, refreshes);
+}
+
+static void TestCreateRejectsInvalidParameters(void) {
+    digital_output_t outputs[DISPLAY_MAX_DIGITS + 1];
+
+    for (uint8_t index = 0; index < UNIT_COUNT(outputs); index++) {
+        outputs[index] = DigitalOutputCreate(DIGIT_GPIO, index);
+    }
+    UNIT_ASSERT_NULL(DisplayCreate(outputs, 0, outputs));
+    UNIT_ASSERT_NULL(DisplayCreate(outputs, DISPLAY_MAX_DIGITS + 1, outputs));
+
+    /* Una pantalla nueva deja apagados los dígitos y los segmentos */
+    UNIT_ASSERT_NOT_NULL(CreateDisplay());
+    UNIT_ASSERT_BITS(0, SimGpioGetOutputs(DIGIT_GPIO) & ((1u << DIGITS) - 1));
+    UNIT_ASSERT_BITS(0, SimGpioGetOutputs(SEGMENT_GPIO) & 0xFF);
+    UNIT_ASSERT_NULL(DisplayCreate(outputs, DIGITS, outputs));
+}
+
+static void TestFailedCreateKeepsGroupsAvailable(void) {
+    digital_output_t digits[DIGITS];
+    digital_output_t segments[8];
+
+    for (uint8_t index = 0; index < DIGITS; index++) {
+        digits[index] = DigitalOutputCreate(DIGIT_GPIO, index);
+    }
+    for (uint8_t index = 0; index < 8; index++) {
+        segments[index] = DigitalOutputCreate(SEGMENT_GPIO, index);
+    }
+
+    /* Con un segmento inválido no se toma ningún grupo de la reserva, aunque los dígitos sean válidos */
+    segments[7] = NULL;
+    for (uint8_t retry = 0; retry < DIGITAL_GROUP_POOL_SIZE; retry++) {
+        UNIT_ASSERT_NULL(DisplayCreate(digits, DIGITS, segments));
+    }
+    segments[7] = DigitalOutputCreate(SEGMENT_GPIO, 7);
+    UNIT_ASSERT_NOT_NULL(DisplayCreate(digits, DIGITS, segments));
+}
+
+static void TestTimerScansDigitsInOrder(void) {
+    static const uint8_t number[] = {1, 2, 3, 4};
+    display_t display = CreateDisplay();
+
+    DisplayWriteBcd(display, number, sizeof(number));
+    DisplaySetDot(display, 1, true);
+    UNIT_ASSERT(!DisplayStart(display, 0));
+    UNIT_ASSERT(DisplayStart(display, REFRESH_HZ));
+    Refresh(2 * DIGITS);
+
+    for (uint8_t index = 0; index < 2 * DIGITS; index++) {
+        UNIT_ASSERT_EQUAL(index % DIGITS, lit[index]);
+    }
+    UNIT_ASSERT_BITS(SEGMENT_B | SEGMENT_C, shown[0]);
+    UNIT_ASSERT_BITS(SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G | SEGMENT_P, shown[1]);
+    UNIT_ASSERT_BITS(SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G, shown[2]);
+    UNIT_ASSERT_BITS(SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G, shown[3]);
+    UNIT_ASSERT(!ghosting);
+    UNIT_ASSERT(DisplayGetRefreshCycles(display) > 0);
+}
+
+static void TestFrameSwapsAtScanStart(void) {
+    static const uint8_t first[] = {1, 1, 1, 1};
+    static const uint8_t second[] = {7, 7, 7, 7};
+    display_t display = CreateDisplay();
+
+    DisplayWriteBcd(display, first, sizeof(first));
+    DisplayStart(display, REFRESH_HZ);
+    Refresh(DIGITS + 2);
+
+    /* El cuadro nuevo no se toma a mitad de un barrido: los dígitos que faltan muestran el anterior */
+    DisplayWriteBcd(display, second, sizeof(second));
+    DisplaySetDot(display, 3, true);
+    Refresh(DIGITS - 2);
+    UNIT_ASSERT_BITS(SEGMENT_B | SEGMENT_C, shown[2]);
+    UNIT_ASSERT_BITS(SEGMENT_B | SEGMENT_C, shown[3]);
+
+    /* Las dos escrituras se publican juntas al comenzar el barrido siguiente */
+    Refresh(DIGITS);
+    for (uint8_t digit = 0; digit < DIGITS; digit++) {
+        UNIT_ASSERT_BITS(SEGMENT_A | SEGMENT_B | SEGMENT_C | ((digit == 3) ? SEGMENT_P : 0), shown[digit]);
+    }
+    UNIT_ASSERT(!ghosting);
+}
+
+static void TestBlinkPeriodCountsScans(void) {
+    static const uint8_t number[] = {8, 8, 8, 8};
+    static const bool visible[] = {true, false, false, true, true, false, false, true};
+    display_t display = CreateDisplay();
+
+    DisplayWriteBcd(display, number, sizeof(number));
+    DisplaySetBlink(display, 0x0A, 2);
+    DisplayStart(display, REFRESH_HZ);
+
+    /* Cada mitad del parpadeo dura dos barridos completos, no dos refrescos */
+    for (uint8_t scan = 0; scan < UNIT_COUNT(visible); scan++) {
+        Refresh(DIGITS);
+        UNIT_ASSERT_BITS(SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G, shown[0]);
+        UNIT_ASSERT_BITS(visible[scan] ? shown[0] : 0, shown[1]);
+        UNIT_ASSERT_BITS(shown[0], shown[2]);
+        UNIT_ASSERT_BITS(visible[scan] ? shown[0] : 0, shown[3]);
+    }
+
+    /* Sin parpadeo los dígitos vuelven a encenderse desde el barrido siguiente */
+    DisplaySetBlink(display, 0x0A, 0);
+    Refresh(DIGITS);
+    UNIT_ASSERT_BITS(shown[0], shown[1]);
+    UNIT_ASSERT_BITS(shown[0], shown[3]);
+    UNIT_ASSERT(!ghosting);
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    static const unit_case_t cases[] = {
+        UNIT_CASE(TestCreateRejectsInvalidParameters, "una pantalla rechaza parámetros inválidos y empieza apagada"),
+        UNIT_CASE(TestFailedCreateKeepsGroupsAvailable, "una creación fallida no consume grupos de salidas"),
+        UNIT_CASE(TestTimerScansDigitsInOrder, "el temporizador enciende los dígitos en orden sin fantasmas"),
+        UNIT_CASE(TestFrameSwapsAtScanStart, "un cuadro nuevo se muestra desde el comienzo de un barrido"),
+        UNIT_CASE(TestBlinkPeriodCountsScans, "el período de parpadeo se cuenta en barridos completos"),
+    };
+
+    return UnitRun("display", cases, UNIT_COUNT(cases));
+}
+
+/* === End of documentation ======================================================================================== */
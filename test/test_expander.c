@@ -0,0 +1,308 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_expander.c
+ ** @brief Pruebas unitarias del expansor de salidas con registros 74HC595 sobre el chip simulado
+ **
+ ** La cadena de registros se modela con un observador del puerto del pin de carga: cada flanco ascendente desplaza en
+ ** la cadena los bytes que el SSP terminó de transmitir y copia el registro de desplazamiento en las salidas, igual
+ ** que los 74HC595. Los bytes que todavía no salieron por la línea no llegan a la cadena.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include "expander.h"
+#include "digital.h"
+#include "chip.h"
+#include "unit.h"
+#include <string.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief Puerto GPIO del pin de carga */
+#define LATCH_GPIO 5
+
+/** @brief Bit del pin de carga en su puerto */
+#define LATCH_BIT 4
+
+/** @brief Registros encadenados en las pruebas */
+#define CHIPS 3
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Modelo de una cadena de registros 74HC595.
+ */
+typedef struct chain_s {
+    uint8_t shift[EXPANDER_MAX_CHIPS];   /**< Registro de desplazamiento de cada registro de la cadena. */
+    uint8_t outputs[EXPANDER_MAX_CHIPS]; /**< Salidas de cada registro de la cadena. */
+    uint16_t latched;                    /**< Cantidad de pulsos de carga recibidos. */
+    uint16_t shifted;                    /**< Bytes que llegaron a la cadena antes del último pulso de carga. */
+    bool level;                          /**< Último nivel del pin de carga. */
+} chain_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Desplaza en la cadena los bytes transmitidos y los carga en las salidas en el flanco ascendente del pin.
+ *
+ * @param object  Modelo de la cadena.
+ * @param port    Puerto que cambió.
+ * @param level   Nivel de todos los pines del puerto.
+ */
+static void ChainObserver(void * object, uint8_t port, uint32_t level);
+
+/**
+ * @brief Crea el expansor de las pruebas y conecta el modelo de la cadena.
+ *
+ * @return Instancia del expansor.
+ */
+static expander_t CreateExpander(void);
+
+/**
+ * @brief Espera que termine la transferencia en curso del expansor.
+ *
+ * @param expander  Instancia del expansor.
+ */
+static void WaitIdle(expander_t expander);
+
+/* === Private variable definitions ================================================================================ */
+
+/** @brief Cadena de registros conectada al expansor */
+static chain_t chain;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void ChainObserver(void * object, uint8_t port, uint32_t level) {
+    chain_t * self = object;
+    bool latch = (level & (1u << LATCH_BIT)) != 0;
+    uint8_t data[16];
+    size_t count;
+
+    if (port != LATCH_GPIO) {
+        return;
+    }
+    if (latch && !self->level) {
+        /* Cada byte entra por el registro 0 y empuja a los demás hacia el final de la cadena */
+        self->shifted = 0;
+        while ((count = SimSspRead(LPC_SSP1, data, sizeof(data))) > 0) {
+            for (size_t index = 0; index < count; index++) {
+                memmove(&self->shift[1], &self->shift[0], CHIPS - 1);
+                self->shift[0] = data[index];
+            }
+            self->shifted += count;
+        }
+        memcpy(self->outputs, self->shift, CHIPS);
+        self->latched++;
+    }
+    self->level = latch;
+}
+
+static expander_t CreateExpander(void) {
+    expander_t expander;
+
+    memset(&chain, 0xA5, sizeof(chain));
+    chain.latched = 0;
+    chain.level = false;
+    SimSetPortObserver(ChainObserver, &chain);
+    expander = ExpanderCreate(CHIPS, LATCH_GPIO, LATCH_BIT);
+    UNIT_ASSERT_NOT_NULL(expander);
+    return expander;
+}
+
+static void WaitIdle(expander_t expander) {
+    for (uint16_t wait = 0; ExpanderIsBusy(expander) && (wait < 1000); wait++) {
+        SimAddCycles(100);
+    }
+    UNIT_ASSERT(!ExpanderIsBusy(expander));
+}
+
+static void TestCreateRejectsInvalidParameters(void) {
+    UNIT_ASSERT_NULL(ExpanderCreate(0, LATCH_GPIO, LATCH_BIT));
+    UNIT_ASSERT_NULL(ExpanderCreate(EXPANDER_MAX_CHIPS + 1, LATCH_GPIO, LATCH_BIT));
+    UNIT_ASSERT_NOT_NULL(ExpanderCreate(EXPANDER_MAX_CHIPS, LATCH_GPIO, LATCH_BIT));
+    UNIT_ASSERT_NULL(ExpanderCreate(1, LATCH_GPIO, LATCH_BIT));
+}
+
+static void TestFirstRefreshClearsChain(void) {
+    expander_t expander = CreateExpander();
+
+    UNIT_ASSERT(ExpanderRefresh(expander));
+    WaitIdle(expander);
+    UNIT_ASSERT_EQUAL(1, chain.latched);
+    UNIT_ASSERT_EQUAL(CHIPS, chain.shifted);
+    for (uint8_t chip = 0; chip < CHIPS; chip++) {
+        UNIT_ASSERT_BITS(0, chain.outputs[chip]);
+    }
+    UNIT_ASSERT(!SimGpioGetOutputs(LATCH_GPIO));
+}
+
+static void TestOutputsReachTheirChip(void) {
+    expander_t expander = CreateExpander();
+    digital_output_t first = DigitalOutputCreateOnExpander(expander, 0);
+    digital_output_t middle = DigitalOutputCreateOnExpander(expander, 8 + 5);
+    digital_output_t last = DigitalOutputCreateOnExpander(expander, 8 * (CHIPS - 1) + 7);
+
+    DigitalOutputActivate(first);
+    DigitalOutputToggle(middle);
+    DigitalOutputActivate(last);
+    UNIT_ASSERT(ExpanderRefresh(expander));
+    WaitIdle(expander);
+    UNIT_ASSERT_BITS(0x01, chain.outputs[0]);
+    UNIT_ASSERT_BITS(0x20, chain.outputs[1]);
+    UNIT_ASSERT_BITS(0x80, chain.outputs[CHIPS - 1]);
+
+    DigitalOutputDeactivate(first);
+    DigitalOutputToggle(middle);
+    UNIT_ASSERT_BITS(0x00, ExpanderRead(expander, 1));
+    UNIT_ASSERT(ExpanderRefresh(expander));
+    WaitIdle(expander);
+    UNIT_ASSERT_BITS(0x00, chain.outputs[0]);
+    UNIT_ASSERT_BITS(0x00, chain.outputs[1]);
+    UNIT_ASSERT_BITS(0x80, chain.outputs[CHIPS - 1]);
+}
+
+static void TestChangesAreCoalesced(void) {
+    expander_t expander = CreateExpander();
+
+    UNIT_ASSERT(ExpanderRefresh(expander));
+    WaitIdle(expander);
+
+    /* Sin cambios no hay transferencia, y muchos cambios entre dos refrescos viajan en una sola */
+    UNIT_ASSERT(!ExpanderRefresh(expander));
+    for (uint8_t step = 0; step < 10; step++) {
+        ExpanderToggle(expander, step % CHIPS, 1u << step % 8);
+    }
+    ExpanderWrite(expander, 2, 0xF0, 0xA0);
+    UNIT_ASSERT(ExpanderRefresh(expander));
+    WaitIdle(expander);
+    UNIT_ASSERT_EQUAL(2, ExpanderGetTransfers(expander));
+    UNIT_ASSERT_EQUAL(2, chain.latched);
+    UNIT_ASSERT_EQUAL(CHIPS, chain.shifted);
+    for (uint8_t chip = 0; chip < CHIPS; chip++) {
+        UNIT_ASSERT_BITS(ExpanderRead(expander, chip), chain.outputs[chip]);
+    }
+}
+
+static void TestRefreshWhileBusyKeepsChanges(void) {
+    expander_t expander = CreateExpander();
+
+    UNIT_ASSERT(ExpanderRefresh(expander));
+    ExpanderWrite(expander, 0, 0xFF, 0x3C);
+    UNIT_ASSERT(ExpanderIsBusy(expander));
+    UNIT_ASSERT(!ExpanderRefresh(expander));
+    WaitIdle(expander);
+    UNIT_ASSERT_BITS(0x00, chain.outputs[0]);
+
+    UNIT_ASSERT(ExpanderRefresh(expander));
+    WaitIdle(expander);
+    UNIT_ASSERT_BITS(0x3C, chain.outputs[0]);
+}
+
+static void TestRefreshCostDoesNotDependOnChanges(void) {
+    expander_t expander = CreateExpander();
+    sim_chip_stats_t before;
+    sim_chip_stats_t after;
+    uint32_t writes;
+
+    /* Una transferencia de DMA por refresco: las escrituras no dependen de cuántas salidas cambiaron */
+    ExpanderWrite(expander, 0, 0x01, 0x01);
+    SimGetStats(&before);
+    ExpanderRefresh(expander);
+    SimGetStats(&after);
+    writes = after.writes - before.writes;
+    WaitIdle(expander);
+
+    for (uint8_t chip = 0; chip < CHIPS; chip++) {
+        ExpanderWrite(expander, chip, 0xFF, 0x5A + chip);
+    }
+    SimGetStats(&before);
+    ExpanderRefresh(expander);
+    SimGetStats(&after);
+    UNIT_ASSERT_EQUAL(writes, after.writes - before.writes);
+    WaitIdle(expander);
+    UNIT_ASSERT_BITS(0x5A + CHIPS - 1, chain.outputs[CHIPS - 1]);
+}
+
+static void TestExpanderOutputsHaveNoPin(void) {
+    expander_t expander = CreateExpander();
+    digital_output_t outputs[] = {
+        DigitalOutputCreate(LATCH_GPIO, 0),
+        DigitalOutputCreateOnExpander(expander, 1),
+    };
+
+    UNIT_ASSERT_NULL(DigitalOutputCreateOnExpander(NULL, 0));
+    UNIT_ASSERT_NULL(DigitalOutputGetPin(outputs[1]));
+    UNIT_ASSERT_NULL(DigitalOutputGroupCreate(outputs, UNIT_COUNT(outputs)));
+    UNIT_ASSERT(!DigitalOutputSetDeferred(outputs[1], true));
+}
+
+static void TestForeignChannelInterruptIsAcknowledged(void) {
+    expander_t expander = CreateExpander();
+    static const uint8_t data[] = {'h', 'o', 'l', 'a'};
+    static DMA_TransferDescriptor_t list;
+    uint8_t channel;
+
+    UNIT_ASSERT(ExpanderRefresh(expander));
+    WaitIdle(expander);
+
+    /* Otro módulo transmite por un UART con la interrupción de fin de transferencia y sin registrar una función */
+    Chip_UART_Init(LPC_USART3);
+    Chip_UART_SetBaud(LPC_USART3, 115200);
+    Chip_UART_ConfigData(LPC_USART3, UART_LCR_WLEN8 | UART_LCR_SBS_1BIT | UART_LCR_PARITY_DIS);
+    Chip_UART_SetupFIFOS(LPC_USART3, UART_FCR_FIFO_EN | UART_FCR_DMAMODE_SEL);
+    Chip_UART_TXEnable(LPC_USART3);
+    channel = Chip_GPDMA_GetFreeChannel(LPC_GPDMA, GPDMA_CONN_UART3_Tx);
+    UNIT_ASSERT(channel < GPDMA_NUMBER_CHANNELS);
+    UNIT_ASSERT_EQUAL(SUCCESS, Chip_GPDMA_InitDescriptor(LPC_GPDMA, &list, (uintptr_t)data, GPDMA_CONN_UART3_Tx,
+                                                         sizeof(data), GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA, NULL));
+    UNIT_ASSERT_EQUAL(SUCCESS,
+                      Chip_GPDMA_SGTransfer(LPC_GPDMA, channel, &list, GPDMA_TRANSFERTYPE_M2P_CONTROLLER_DMA));
+    SimAddCycles(SystemCoreClock / 1000);
+    UNIT_ASSERT_BITS(0, CHIP_REG_READ(&LPC_GPDMA->RAWINTTCSTAT));
+
+    ExpanderWrite(expander, 1, 0xFF, 0x42);
+    UNIT_ASSERT(ExpanderRefresh(expander));
+    WaitIdle(expander);
+    UNIT_ASSERT_BITS(0x42, chain.outputs[1]);
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    static const unit_case_t cases[] = {
+        UNIT_CASE(TestCreateRejectsInvalidParameters, "un expansor rechaza parámetros inválidos"),
+        UNIT_CASE(TestFirstRefreshClearsChain, "el primer refresco pone en cero toda la cadena"),
+        UNIT_CASE(TestOutputsReachTheirChip, "cada salida digital llega a su registro y a su bit"),
+        UNIT_CASE(TestChangesAreCoalesced, "los cambios entre dos refrescos viajan en una transferencia"),
+        UNIT_CASE(TestRefreshWhileBusyKeepsChanges, "un refresco durante una transferencia conserva los cambios"),
+        UNIT_CASE(TestRefreshCostDoesNotDependOnChanges, "el costo de un refresco no depende de los cambios"),
+        UNIT_CASE(TestExpanderOutputsHaveNoPin, "las salidas de un expansor no tienen acceso directo a un pin"),
+        UNIT_CASE(TestForeignChannelInterruptIsAcknowledged, "la interrupción de un canal ajeno no queda pendiente"),
+    };
+
+    return UnitRun("expander", cases, UNIT_COUNT(cases));
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,293 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_keypad.c
+ ** @brief Pruebas unitarias del controlador de teclado matricial sobre el chip simulado
+ **
+ ** Las filas y las columnas se conectan con un modelo eléctrico de una matriz sin diodos: la fila seleccionada pone en
+ ** nivel bajo las columnas de sus teclas presionadas y, a través de ellas, las de otras filas, de modo que las teclas
+ ** fantasma aparecen igual que en el hardware.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include "keypad.h"
+#include "chip.h"
+#include "unit.h"
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief Puerto GPIO de las filas, que se seleccionan en nivel bajo */
+#define ROW_GPIO 5
+
+/** @brief Primer bit de las filas en su puerto */
+#define ROW_BIT 0
+
+/** @brief Puerto GPIO de las columnas, con resistencias de polarización a nivel alto */
+#define COLUMN_GPIO 0
+
+/** @brief Primer bit de las columnas en su puerto */
+#define COLUMN_BIT 8
+
+/** @brief Filas y columnas del teclado de las pruebas */
+#define KEYPAD_SIZE 4
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Actualiza el nivel de las columnas cuando cambia la selección de las filas.
+ *
+ * @param object  No se usa.
+ * @param port    Puerto que cambió.
+ * @param level   Nivel de todos los pines del puerto.
+ */
+static void MatrixObserver(void * object, uint8_t port, uint32_t level);
+
+/**
+ * @brief Crea el teclado de las pruebas y conecta el modelo de la matriz.
+ *
+ * @return Instancia del teclado.
+ */
+static keypad_t CreateKeypad(void);
+
+/**
+ * @brief Cambia las teclas presionadas y actualiza las columnas.
+ *
+ * @param keys  Palabra con las teclas presionadas, con los bits de KEYPAD_KEY().
+ */
+static void PressKeys(uint64_t keys);
+
+/**
+ * @brief Ejecuta barridos completos del teclado.
+ *
+ * @param keypad  Instancia del teclado.
+ * @param scans   Cantidad de barridos.
+ */
+static void Scan(keypad_t keypad, uint8_t scans);
+
+/* === Private variable definitions ================================================================================ */
+
+/** @brief Teclas presionadas en el modelo de la matriz */
+static uint64_t matrixKeys;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void MatrixObserver(void * object, uint8_t port, uint32_t level) {
+    uint8_t rows;
+    uint8_t columns = 0;
+    uint8_t reached;
+
+    (void)object;
+    if (port != ROW_GPIO) {
+        return;
+    }
+
+    /* Las columnas de las teclas de las filas seleccionadas bajan, y con ellas las filas de sus otras teclas */
+    rows = ~(level >> ROW_BIT) & ((1u << KEYPAD_SIZE) - 1);
+    do {
+        reached = rows;
+        for (uint8_t row = 0; row < KEYPAD_SIZE; row++) {
+            if (rows & (1u << row)) {
+                columns |= (uint8_t)(matrixKeys >> (8 * row));
+            }
+        }
+        for (uint8_t row = 0; row < KEYPAD_SIZE; row++) {
+            if ((uint8_t)(matrixKeys >> (8 * row)) & columns) {
+                rows |= 1u << row;
+            }
+        }
+    } while (rows != reached);
+
+    for (uint8_t column = 0; column < KEYPAD_SIZE; column++) {
+        SimGpioSetInput(COLUMN_GPIO, COLUMN_BIT + column, (columns & (1u << column)) == 0);
+    }
+}
+
+static keypad_t CreateKeypad(void) {
+    digital_output_t rows[KEYPAD_SIZE];
+    digital_input_t columns[KEYPAD_SIZE];
+    keypad_t keypad;
+
+    for (uint8_t index = 0; index < KEYPAD_SIZE; index++) {
+        SimGpioSetInput(COLUMN_GPIO, COLUMN_BIT + index, true);
+        rows[index] = DigitalOutputCreate(ROW_GPIO, ROW_BIT + index);
+        columns[index] = DigitalInputCreate(COLUMN_GPIO, COLUMN_BIT + index, true);
+    }
+    SimSetPortObserver(MatrixObserver, NULL);
+    keypad = KeypadCreate(rows, KEYPAD_SIZE, columns, KEYPAD_SIZE, true);
+    UNIT_ASSERT_NOT_NULL(keypad);
+    return keypad;
+}
+
+static void PressKeys(uint64_t keys) {
+    matrixKeys = keys;
+    MatrixObserver(NULL, ROW_GPIO, SimGpioGetOutputs(ROW_GPIO));
+}
+
+static void Scan(keypad_t keypad, uint8_t scans) {
+    for (uint16_t call = 0; call < scans * KEYPAD_SIZE; call++) {
+        KeypadScanRow(keypad);
+    }
+}
+
+static void TestCreateRejectsInvalidParameters(void) {
+    digital_output_t rows[KEYPAD_MAX_ROWS + 1];
+    digital_input_t columns[] = {
+        DigitalInputCreate(COLUMN_GPIO, 1, true),
+        DigitalInputCreate(COLUMN_GPIO + 1, 2, true),
+    };
+
+    for (uint8_t index = 0; index < UNIT_COUNT(rows); index++) {
+        rows[index] = DigitalOutputCreate(ROW_GPIO, index);
+    }
+    UNIT_ASSERT_NULL(KeypadCreate(NULL, 1, columns, 1, true));
+    UNIT_ASSERT_NULL(KeypadCreate(rows, 0, columns, 1, true));
+    UNIT_ASSERT_NULL(KeypadCreate(rows, UNIT_COUNT(rows), columns, 1, true));
+    UNIT_ASSERT_NULL(KeypadCreate(rows, 1, columns, UNIT_COUNT(columns), true));
+    UNIT_ASSERT_NOT_NULL(KeypadCreate(rows, KEYPAD_MAX_ROWS, columns, 1, true));
+}
+
+static void TestCreateSelectsFirstRow(void) {
+    CreateKeypad();
+
+    UNIT_ASSERT_BITS(0xE << ROW_BIT, SimGpioGetOutputs(ROW_GPIO));
+}
+
+static void TestScanReportsKeysInWord(void) {
+    keypad_t keypad = CreateKeypad();
+
+    PressKeys(KEYPAD_KEY(1, 2) | KEYPAD_KEY(3, 0));
+    Scan(keypad, 1);
+    UNIT_ASSERT(KeypadGetState(keypad) == (KEYPAD_KEY(1, 2) | KEYPAD_KEY(3, 0)));
+    UNIT_ASSERT(KeypadGetPressed(keypad) == (KEYPAD_KEY(1, 2) | KEYPAD_KEY(3, 0)));
+    UNIT_ASSERT(KeypadGetPressed(keypad) == 0);
+
+    PressKeys(KEYPAD_KEY(3, 0));
+    Scan(keypad, 1);
+    UNIT_ASSERT(KeypadGetState(keypad) == KEYPAD_KEY(3, 0));
+    UNIT_ASSERT(KeypadGetReleased(keypad) == KEYPAD_KEY(1, 2));
+    UNIT_ASSERT(KeypadGetReleased(keypad) == 0);
+    UNIT_ASSERT(KeypadGetGhosts(keypad) == 0);
+}
+
+static void TestScanReadsOnePortPerRow(void) {
+    keypad_t keypad = CreateKeypad();
+    sim_chip_stats_t before;
+    sim_chip_stats_t after;
+
+    /* El costo de un barrido no depende de cuántas teclas estén presionadas */
+    SimGetStats(&before);
+    Scan(keypad, 1);
+    SimGetStats(&after);
+    UNIT_ASSERT_EQUAL(KEYPAD_SIZE, after.reads - before.reads);
+    UNIT_ASSERT_EQUAL(2 * KEYPAD_SIZE, after.writes - before.writes);
+
+    PressKeys(KEYPAD_KEY(0, 0) | KEYPAD_KEY(1, 1) | KEYPAD_KEY(2, 2) | KEYPAD_KEY(3, 3));
+    SimGetStats(&before);
+    Scan(keypad, 1);
+    SimGetStats(&after);
+    UNIT_ASSERT_EQUAL(KEYPAD_SIZE, after.reads - before.reads);
+    UNIT_ASSERT_EQUAL(2 * KEYPAD_SIZE, after.writes - before.writes);
+    UNIT_ASSERT(KeypadGetState(keypad) == (KEYPAD_KEY(0, 0) | KEYPAD_KEY(1, 1) | KEYPAD_KEY(2, 2) | KEYPAD_KEY(3, 3)));
+}
+
+static void TestGhostKeysKeepTheirState(void) {
+    keypad_t keypad = CreateKeypad();
+    uint64_t corners = KEYPAD_KEY(0, 1) | KEYPAD_KEY(0, 3) | KEYPAD_KEY(2, 1) | KEYPAD_KEY(2, 3);
+
+    PressKeys(KEYPAD_KEY(0, 1) | KEYPAD_KEY(0, 3));
+    Scan(keypad, 1);
+    KeypadGetPressed(keypad);
+
+    /* La tercera esquina hace aparecer la cuarta, y ninguna de las dos se acepta mientras la lectura sea ambigua */
+    PressKeys(KEYPAD_KEY(0, 1) | KEYPAD_KEY(0, 3) | KEYPAD_KEY(2, 1));
+    Scan(keypad, 2);
+    UNIT_ASSERT(KeypadGetGhosts(keypad) == corners);
+    UNIT_ASSERT(KeypadGetState(keypad) == (KEYPAD_KEY(0, 1) | KEYPAD_KEY(0, 3)));
+    UNIT_ASSERT(KeypadGetPressed(keypad) == 0);
+
+    PressKeys(KEYPAD_KEY(0, 1) | KEYPAD_KEY(2, 1));
+    Scan(keypad, 1);
+    UNIT_ASSERT(KeypadGetGhosts(keypad) == 0);
+    UNIT_ASSERT(KeypadGetState(keypad) == (KEYPAD_KEY(0, 1) | KEYPAD_KEY(2, 1)));
+    UNIT_ASSERT(KeypadGetPressed(keypad) == KEYPAD_KEY(2, 1));
+    UNIT_ASSERT(KeypadGetReleased(keypad) == KEYPAD_KEY(0, 3));
+}
+
+static void TestDebounceNeedsConsecutiveScans(void) {
+    keypad_t keypad = CreateKeypad();
+
+    UNIT_ASSERT(!KeypadSetDebounce(keypad, 0));
+    UNIT_ASSERT(!KeypadSetDebounce(keypad, 1u << DIGITAL_DEBOUNCE_BITS));
+    UNIT_ASSERT(KeypadSetDebounce(keypad, 3));
+
+    PressKeys(KEYPAD_KEY(2, 2));
+    Scan(keypad, 2);
+    PressKeys(0);
+    Scan(keypad, 1);
+    PressKeys(KEYPAD_KEY(2, 2));
+    Scan(keypad, 2);
+    UNIT_ASSERT(KeypadGetState(keypad) == 0);
+    Scan(keypad, 1);
+    UNIT_ASSERT(KeypadGetState(keypad) == KEYPAD_KEY(2, 2));
+}
+
+static void TestStartScansFromTimer(void) {
+    keypad_t keypad = CreateKeypad();
+    uint32_t period = SystemCoreClock / 1000;
+    uint32_t cycles;
+
+    PressKeys(KEYPAD_KEY(3, 3));
+    UNIT_ASSERT(!KeypadStart(keypad, 0));
+    UNIT_ASSERT(KeypadStart(keypad, 1000));
+    SimAddCycles(period * (2 * KEYPAD_SIZE + 1));
+    UNIT_ASSERT(KeypadGetState(keypad) == KEYPAD_KEY(3, 3));
+
+    /* El costo medido de un barrido es acotado y no cambia con las teclas presionadas */
+    cycles = KeypadGetScanCycles(keypad);
+    UNIT_ASSERT(cycles > 0);
+    PressKeys(KEYPAD_KEY(0, 0) | KEYPAD_KEY(1, 1) | KEYPAD_KEY(2, 2) | KEYPAD_KEY(3, 3));
+    SimAddCycles(period * 2 * KEYPAD_SIZE);
+    UNIT_ASSERT_EQUAL(cycles, KeypadGetScanCycles(keypad));
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    static const unit_case_t cases[] = {
+        UNIT_CASE(TestCreateRejectsInvalidParameters, "un teclado rechaza parámetros inválidos"),
+        UNIT_CASE(TestCreateSelectsFirstRow, "un teclado nuevo selecciona solo la primera fila"),
+        UNIT_CASE(TestScanReportsKeysInWord, "un barrido informa estado, teclas presionadas y soltadas"),
+        UNIT_CASE(TestScanReadsOnePortPerRow, "cada fila se lee con un único acceso al puerto"),
+        UNIT_CASE(TestGhostKeysKeepTheirState, "las teclas fantasma conservan su estado"),
+        UNIT_CASE(TestDebounceNeedsConsecutiveScans, "el antirrebote exige barridos consecutivos estables"),
+        UNIT_CASE(TestStartScansFromTimer, "el temporizador explora el teclado con costo acotado"),
+    };
+
+    return UnitRun("keypad", cases, UNIT_COUNT(cases));
+}
+
+/* === End of documentation ======================================================================================== */
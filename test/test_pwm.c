@@ -0,0 +1,317 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_pwm.c
+ ** @brief Pruebas unitarias de la modulación por ancho de pulso sobre el chip simulado
+ **
+ ** La interrupción del temporizador 1 genera los flancos mientras el tiempo virtual avanza, y un observador del puerto
+ ** de los canales registra el ciclo y el estado de cada cambio. Los instantes se comparan en pasos de modulación, con
+ ** un margen para la latencia de la interrupción.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include "pwm.h"
+#include "chip.h"
+#include "unit.h"
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief Puerto GPIO de las salidas moduladas, desde el bit 0 */
+#define PWM_GPIO 5
+
+/** @brief Períodos de modulación por segundo */
+#define FREQUENCY 200
+
+/** @brief Ciclos por paso de modulación */
+#define STEP_CYCLES (SystemCoreClock / FREQUENCY / PWM_STEPS)
+
+/** @brief Ciclos por período de modulación */
+#define PERIOD_CYCLES (STEP_CYCLES * PWM_STEPS)
+
+/** @brief Cambios del puerto que se registran */
+#define LOG_SIZE 64
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Cambio observado en las salidas moduladas.
+ */
+typedef struct pwm_edge_s {
+    uint64_t cycle;   /**< Ciclo virtual del cambio */
+    uint32_t pattern; /**< Estado de los canales a partir del cambio */
+} pwm_edge_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Registra los cambios de las salidas moduladas.
+ *
+ * @param object  No se usa.
+ * @param port    Puerto que cambió.
+ * @param level   Nivel de todos los pines del puerto.
+ */
+static void PwmObserver(void * object, uint8_t port, uint32_t level);
+
+/**
+ * @brief Crea una modulación con salidas consecutivas del puerto de las pruebas e instala el observador.
+ *
+ * @param count  Cantidad de canales.
+ * @return Instancia de la modulación.
+ */
+static pwm_t CreatePwm(uint8_t count);
+
+/**
+ * @brief Descarta los cambios registrados y avanza el tiempo virtual.
+ *
+ * @param periods  Períodos de modulación a avanzar.
+ */
+static void Run(uint8_t periods);
+
+/**
+ * @brief Busca el primer cambio registrado que deja los canales en un estado.
+ *
+ * @param pattern  Estado de los canales.
+ * @return Posición del cambio en el registro, o `LOG_SIZE` si no hay ninguno.
+ */
+static uint8_t Find(uint32_t pattern);
+
+/**
+ * @brief Convierte la separación entre dos ciclos a pasos de modulación, redondeando.
+ *
+ * @param from  Ciclo inicial.
+ * @param to    Ciclo final.
+ * @return Pasos de modulación.
+ */
+static uint32_t Steps(uint64_t from, uint64_t to);
+
+/**
+ * @brief Mide el pulso de un canal único con el último nivel fijado.
+ *
+ * @return Duración del pulso en pasos de modulación.
+ */
+static uint32_t PulseSteps(void);
+
+/* === Private variable definitions ================================================================================ */
+
+/** @brief Cambios registrados */
+static pwm_edge_t edges[LOG_SIZE];
+
+/** @brief Cantidad de cambios registrados */
+static uint8_t edgeCount;
+
+/** @brief Máscara de los canales en el puerto */
+static uint32_t channels;
+
+/** @brief Último estado observado de los canales */
+static uint32_t current;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void PwmObserver(void * object, uint8_t port, uint32_t level) {
+    (void)object;
+    if ((port != PWM_GPIO) || ((level & channels) == current)) {
+        return;
+    }
+    current = level & channels;
+    if (edgeCount < LOG_SIZE) {
+        edges[edgeCount].cycle = SimGetCycles();
+        edges[edgeCount].pattern = current;
+        edgeCount++;
+    }
+}
+
+static pwm_t CreatePwm(uint8_t count) {
+    digital_output_t outputs[PWM_MAX_CHANNELS];
+    pwm_t pwm;
+
+    for (uint8_t index = 0; index < count; index++) {
+        outputs[index] = DigitalOutputCreate(PWM_GPIO, index);
+    }
+    pwm = PwmCreate(outputs, count);
+    UNIT_ASSERT_NOT_NULL(pwm);
+    channels = (1u << count) - 1;
+    SimSetPortObserver(PwmObserver, NULL);
+    return pwm;
+}
+
+static void Run(uint8_t periods) {
+    edgeCount = 0;
+    for (uint8_t period = 0; period < periods; period++) {
+        SimAddCycles(PERIOD_CYCLES);
+    }
+}
+
+static uint8_t Find(uint32_t pattern) {
+    for (uint8_t index = 0; index < edgeCount; index++) {
+        if (edges[index].pattern == pattern) {
+            return index;
+        }
+    }
+    return LOG_SIZE;
+}
+
+static uint32_t Steps(uint64_t from, uint64_t to) {
+    return (uint32_t)((to - from + STEP_CYCLES / 2) / STEP_CYCLES);
+}
+
+static uint32_t PulseSteps(void) {
+    uint8_t start;
+
+    /* El nivel nuevo se aplica desde el período siguiente; en los dos que siguen hay al menos un pulso completo */
+    Run(2);
+    Run(2);
+    if (edgeCount == 0) {
+        return current ? PWM_STEPS : 0;
+    }
+    start = Find(1);
+    UNIT_ASSERT(start + 1 < edgeCount);
+    return Steps(edges[start].cycle, edges[start + 1].cycle);
+}
+
+static void TestCreateRejectsInvalidParameters(void) {
+    digital_output_t outputs[PWM_MAX_CHANNELS + 1];
+    pwm_t pwm;
+
+    for (uint8_t index = 0; index < UNIT_COUNT(outputs); index++) {
+        outputs[index] = DigitalOutputCreate(PWM_GPIO, index);
+    }
+    UNIT_ASSERT_NULL(PwmCreate(outputs, 0));
+    UNIT_ASSERT_NULL(PwmCreate(outputs, PWM_MAX_CHANNELS + 1));
+
+    /* Los canales empiezan apagados y los que no existen no tienen nivel */
+    pwm = PwmCreate(outputs, 2);
+    UNIT_ASSERT_NOT_NULL(pwm);
+    UNIT_ASSERT_BITS(0, SimGpioGetOutputs(PWM_GPIO) & 0x03);
+    PwmSetLevel(pwm, 2, 100);
+    UNIT_ASSERT_EQUAL(0, PwmGetLevel(pwm, 2));
+    UNIT_ASSERT_NULL(PwmCreate(outputs, 1));
+
+    /* La frecuencia tiene que dejar al menos una cuenta del temporizador por paso */
+    UNIT_ASSERT(!PwmStart(pwm, 0));
+    UNIT_ASSERT(!PwmStart(pwm, SystemCoreClock / PWM_STEPS + 1));
+    UNIT_ASSERT(PwmStart(pwm, SystemCoreClock / PWM_STEPS));
+}
+
+static void TestGammaTable(void) {
+    /* Pasos esperados: 1024 * (nivel / 255) ^ 2,2 redondeado */
+    static const uint16_t expected[][2] = {
+        {0, 0},     {1, 0},     {3, 0},     {16, 2},     {32, 11},    {50, 28},
+        {64, 49},   {128, 225}, {192, 548}, {200, 600}, {254, 1015}, {255, PWM_STEPS},
+    };
+    pwm_t pwm = CreatePwm(1);
+    uint32_t previous = 0;
+
+    PwmStart(pwm, FREQUENCY);
+    for (uint8_t index = 0; index < UNIT_COUNT(expected); index++) {
+        PwmSetLevel(pwm, 0, expected[index][0]);
+        UNIT_ASSERT_EQUAL(expected[index][0], PwmGetLevel(pwm, 0));
+        UNIT_ASSERT_EQUAL(expected[index][1], PulseSteps());
+    }
+
+    /* El brillo nunca disminuye al aumentar el nivel */
+    for (uint16_t level = 0; level <= UINT8_MAX; level++) {
+        uint32_t steps;
+
+        PwmSetLevel(pwm, 0, level);
+        steps = PulseSteps();
+        UNIT_ASSERT(steps >= previous);
+        previous = steps;
+    }
+}
+
+static void TestEdgesFollowSortedLevels(void) {
+    static const uint8_t levels[] = {200, 50, 255, 0, 50};
+    pwm_t pwm = CreatePwm(UNIT_COUNT(levels));
+    uint8_t start;
+
+    for (uint8_t channel = 0; channel < UNIT_COUNT(levels); channel++) {
+        PwmSetLevel(pwm, channel, levels[channel]);
+    }
+    PwmStart(pwm, FREQUENCY);
+    Run(2);
+    Run(2);
+    start = Find(0x17);
+    UNIT_ASSERT(start + 3 < edgeCount);
+
+    /* Un período son tres cambios: todos encienden, los dos de nivel 50 se apagan juntos y después el de 200 */
+    UNIT_ASSERT_BITS(0x05, edges[start + 1].pattern);
+    UNIT_ASSERT_BITS(0x04, edges[start + 2].pattern);
+    UNIT_ASSERT_BITS(0x17, edges[start + 3].pattern);
+    UNIT_ASSERT_EQUAL(28, Steps(edges[start].cycle, edges[start + 1].cycle));
+    UNIT_ASSERT_EQUAL(600, Steps(edges[start].cycle, edges[start + 2].cycle));
+    UNIT_ASSERT_EQUAL(PWM_STEPS, Steps(edges[start].cycle, edges[start + 3].cycle));
+}
+
+static void TestLevelChangeWaitsForNextPeriod(void) {
+    pwm_t pwm = CreatePwm(2);
+    uint64_t begin;
+
+    PwmSetLevel(pwm, 0, 128);
+    PwmSetLevel(pwm, 1, 200);
+    PwmStart(pwm, FREQUENCY);
+    Run(2);
+
+    /* Se avanza de a un paso hasta el comienzo de un período */
+    edgeCount = 0;
+    for (uint16_t step = 0; (step <= PWM_STEPS) && (Find(0x03) == LOG_SIZE); step++) {
+        SimAddCycles(STEP_CYCLES);
+    }
+    UNIT_ASSERT(Find(0x03) < edgeCount);
+    begin = edges[Find(0x03)].cycle;
+
+    /* A los 100 pasos se acorta el pulso de 600 pasos del canal 1 a 49, que pasa a terminar antes que el del canal 0;
+     * el período en curso termina con la lista anterior, sin truncar ningún pulso */
+    SimAddCycles((uint32_t)(begin + 100 * STEP_CYCLES - SimGetCycles()));
+    edgeCount = 0;
+    PwmSetLevel(pwm, 1, 64);
+    SimAddCycles(2 * PERIOD_CYCLES);
+    UNIT_ASSERT(edgeCount >= 5);
+    UNIT_ASSERT_BITS(0x02, edges[0].pattern);
+    UNIT_ASSERT_EQUAL(225, Steps(begin, edges[0].cycle));
+    UNIT_ASSERT_BITS(0x00, edges[1].pattern);
+    UNIT_ASSERT_EQUAL(600, Steps(begin, edges[1].cycle));
+
+    /* Desde el período siguiente rige el orden nuevo */
+    UNIT_ASSERT_BITS(0x03, edges[2].pattern);
+    UNIT_ASSERT_EQUAL(PWM_STEPS, Steps(begin, edges[2].cycle));
+    UNIT_ASSERT_BITS(0x01, edges[3].pattern);
+    UNIT_ASSERT_EQUAL(49, Steps(edges[2].cycle, edges[3].cycle));
+    UNIT_ASSERT_BITS(0x00, edges[4].pattern);
+    UNIT_ASSERT_EQUAL(225, Steps(edges[2].cycle, edges[4].cycle));
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    static const unit_case_t cases[] = {
+        UNIT_CASE(TestCreateRejectsInvalidParameters, "una modulación rechaza parámetros inválidos y empieza apagada"),
+        UNIT_CASE(TestGammaTable, "el ancho del pulso sigue la corrección de gamma"),
+        UNIT_CASE(TestEdgesFollowSortedLevels, "los flancos de un período siguen los niveles ordenados"),
+        UNIT_CASE(TestLevelChangeWaitsForNextPeriod, "un nivel nuevo se aplica desde el período siguiente"),
+    };
+
+    return UnitRun("pwm", cases, UNIT_COUNT(cases));
+}
+
+/* === End of documentation ======================================================================================== */
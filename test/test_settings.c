@@ -0,0 +1,298 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_settings.c
+ ** @brief Pruebas unitarias del almacenamiento de ajustes sobre la EEPROM simulada
+ **
+ ** Los reinicios de la placa se modelan con un proceso hijo que graba los ajustes en una EEPROM respaldada por un
+ ** archivo. El proceso de la prueba carga después ese archivo y crea su propio almacenamiento, como lo haría el
+ ** programa al volver a arrancar.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include "settings.h"
+#include "chip.h"
+#include "unit.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief Primera página de la EEPROM de los almacenamientos de las pruebas */
+#define FIRST_PAGE 10
+
+/** @brief Páginas asignadas a los almacenamientos de las pruebas, con ocho registros cada una */
+#define PAGES 4
+
+/** @brief Versión del formato de los datos de las pruebas */
+#define VERSION 3
+
+/** @brief Cantidad máxima de llamadas al servicio que espera una grabación */
+#define SERVICE_LIMIT 1000
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Crea el almacenamiento de las pruebas, con datos de 32 bits.
+ *
+ * @param version  Versión del formato de los datos.
+ * @return Instancia del almacenamiento.
+ */
+static settings_t CreateSettings(uint8_t version);
+
+/**
+ * @brief Atiende el almacenamiento cada milisegundo virtual hasta que termina de grabar.
+ *
+ * @param settings  Instancia del almacenamiento.
+ * @return Cantidad de llamadas al servicio.
+ */
+static uint32_t WaitWritten(settings_t settings);
+
+/**
+ * @brief Graba una serie de valores consecutivos en un proceso hijo con la EEPROM respaldada por un archivo.
+ *
+ * @param path     Archivo de respaldo de la EEPROM.
+ * @param version  Versión del formato de los datos.
+ * @param first    Primer valor.
+ * @param count    Cantidad de valores, cada uno en su propio registro.
+ */
+static void WriteInChild(const char * path, uint8_t version, uint32_t first, uint32_t count);
+
+/**
+ * @brief Crea un archivo temporal vacío para respaldar la EEPROM.
+ *
+ * @param path  Arreglo de al menos 32 caracteres donde se guarda la ruta del archivo.
+ */
+static void CreateFile(char * path);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static settings_t CreateSettings(uint8_t version) {
+    settings_t settings = SettingsCreate(FIRST_PAGE, PAGES, version, sizeof(uint32_t));
+
+    UNIT_ASSERT_NOT_NULL(settings);
+    return settings;
+}
+
+static uint32_t WaitWritten(settings_t settings) {
+    uint32_t calls = 0;
+
+    while (SettingsIsPending(settings) && (calls < SERVICE_LIMIT)) {
+        SettingsService(settings);
+        SimAddCycles(SystemCoreClock / 1000);
+        calls++;
+    }
+    return calls;
+}
+
+static void WriteInChild(const char * path, uint8_t version, uint32_t first, uint32_t count) {
+    pid_t child = fork();
+    int status;
+
+    if (child == 0) {
+        settings_t settings;
+
+        SimEepromOpen(path);
+        settings = SettingsCreate(FIRST_PAGE, PAGES, version, sizeof(uint32_t));
+        for (uint32_t value = first; value < first + count; value++) {
+            SettingsSave(settings, &value);
+            WaitWritten(settings);
+        }
+        _exit(SettingsIsPending(settings) ? EXIT_FAILURE : EXIT_SUCCESS);
+    }
+    UNIT_ASSERT(waitpid(child, &status, 0) == child);
+    UNIT_ASSERT(WIFEXITED(status) && (WEXITSTATUS(status) == EXIT_SUCCESS));
+}
+
+static void CreateFile(char * path) {
+    int file;
+
+    snprintf(path, 32, "/tmp/test_settings_XXXXXX");
+    file = mkstemp(path);
+    UNIT_ASSERT(file >= 0);
+    close(file);
+}
+
+static void TestCreateRejectsInvalidParameters(void) {
+    UNIT_ASSERT_NULL(SettingsCreate(0, 0, VERSION, 4));
+    UNIT_ASSERT_NULL(SettingsCreate(EEPROM_PAGE_NUM - 1, 2, VERSION, 4));
+    UNIT_ASSERT_NULL(SettingsCreate(0, 1, VERSION, 0));
+    UNIT_ASSERT_NULL(SettingsCreate(0, 1, VERSION, SETTINGS_MAX_SIZE + 1));
+    for (uint8_t index = 0; index < SETTINGS_POOL_SIZE; index++) {
+        UNIT_ASSERT_NOT_NULL(SettingsCreate(index, 1, VERSION, SETTINGS_MAX_SIZE));
+    }
+    UNIT_ASSERT_NULL(SettingsCreate(SETTINGS_POOL_SIZE, 1, VERSION, 4));
+}
+
+static void TestEmptyEepromHasNoData(void) {
+    settings_t settings = CreateSettings(VERSION);
+    uint32_t value = 0x1234;
+
+    UNIT_ASSERT(!SettingsLoad(settings, &value));
+    UNIT_ASSERT_EQUAL(0x1234, value);
+    UNIT_ASSERT(!SettingsIsPending(settings));
+}
+
+static void TestBurstOfChangesCostsOneProgram(void) {
+    settings_t settings = CreateSettings(VERSION);
+    sim_eeprom_stats_t stats;
+    uint32_t value;
+
+    /* Cada cambio reinicia la espera, así que la ráfaga se graba una sola vez al terminar */
+    for (value = 1; value <= 50; value++) {
+        SettingsSave(settings, &value);
+        SettingsService(settings);
+    }
+    for (uint8_t call = 2; call < SETTINGS_WRITE_DELAY; call++) {
+        SettingsService(settings);
+    }
+    SimEepromGetStats(&stats);
+    UNIT_ASSERT_EQUAL(0, stats.programs);
+    SettingsService(settings);
+    SimEepromGetStats(&stats);
+    UNIT_ASSERT_EQUAL(1, stats.programs);
+
+    WaitWritten(settings);
+    SimEepromGetStats(&stats);
+    UNIT_ASSERT_EQUAL(1, stats.programs);
+    UNIT_ASSERT_EQUAL(4, stats.words);
+    UNIT_ASSERT(SettingsLoad(settings, &value));
+    UNIT_ASSERT_EQUAL(50, value);
+}
+
+static void TestSaveWithoutChangesDoesNotProgram(void) {
+    settings_t settings = CreateSettings(VERSION);
+    sim_eeprom_stats_t stats;
+    uint32_t value = 7;
+
+    SettingsSave(settings, &value);
+    WaitWritten(settings);
+    SettingsSave(settings, &value);
+    UNIT_ASSERT(!SettingsIsPending(settings));
+    UNIT_ASSERT_EQUAL(0, WaitWritten(settings));
+    SimEepromGetStats(&stats);
+    UNIT_ASSERT_EQUAL(1, stats.programs);
+}
+
+static void TestServiceDoesNotWaitForProgramming(void) {
+    settings_t settings = CreateSettings(VERSION);
+    uint32_t value = 9;
+    uint64_t start;
+
+    SettingsSave(settings, &value);
+    for (uint8_t call = 0; call < SETTINGS_WRITE_DELAY; call++) {
+        SettingsService(settings);
+    }
+    /* La programación dura milisegundos, pero cada llamada al servicio vuelve con unos pocos accesos */
+    start = SimGetCycles();
+    SettingsService(settings);
+    UNIT_ASSERT(SimGetCycles() - start < 100);
+    UNIT_ASSERT(SettingsIsPending(settings));
+    SimAddCycles((uint64_t)SystemCoreClock * SIM_EEPROM_PROGRAM_US / 1000000);
+    SettingsService(settings);
+    UNIT_ASSERT(!SettingsIsPending(settings));
+}
+
+static void TestRecordsRotateAcrossPages(void) {
+    settings_t settings = CreateSettings(VERSION);
+
+    /* Dos vueltas completas a las posiciones: cada página se programa la misma cantidad de veces */
+    for (uint32_t value = 1; value <= 2 * PAGES * 8; value++) {
+        SettingsSave(settings, &value);
+        WaitWritten(settings);
+    }
+    for (uint16_t page = 0; page < EEPROM_PAGE_NUM; page++) {
+        bool assigned = (page >= FIRST_PAGE) && (page < FIRST_PAGE + PAGES);
+        UNIT_ASSERT_EQUAL(assigned ? 2 * 8 : 0, SimEepromGetPageCycles(page));
+    }
+}
+
+static void TestRestartRestoresNewestRecord(void) {
+    char path[32];
+    uint32_t value = 0;
+
+    /* Más grabaciones que posiciones, para que el registro más reciente no esté en la última posición */
+    CreateFile(path);
+    WriteInChild(path, VERSION, 100, PAGES * 8 + 5);
+    UNIT_ASSERT(SimEepromOpen(path));
+    UNIT_ASSERT(SettingsLoad(CreateSettings(VERSION), &value));
+    UNIT_ASSERT_EQUAL(100 + PAGES * 8 + 4, value);
+    unlink(path);
+}
+
+static void TestRestartSkipsTornRecord(void) {
+    char path[32];
+    settings_t settings;
+    uint32_t value = 0;
+
+    CreateFile(path);
+    WriteInChild(path, VERSION, 1, 3);
+    UNIT_ASSERT(SimEepromOpen(path));
+
+    /* El tercer registro quedó en la posición 2, la primera palabra de datos de la tercera página asignada */
+    sim_eeprom_memory[((FIRST_PAGE + 2) * EEPROM_PAGE_SIZE) / sizeof(uint32_t) + 1] ^= 0x10;
+    settings = CreateSettings(VERSION);
+    UNIT_ASSERT(SettingsLoad(settings, &value));
+    UNIT_ASSERT_EQUAL(2, value);
+    unlink(path);
+}
+
+static void TestRestartIgnoresOtherVersions(void) {
+    char path[32];
+    uint32_t value = 0;
+
+    CreateFile(path);
+    WriteInChild(path, VERSION + 1, 1, 3);
+    UNIT_ASSERT(SimEepromOpen(path));
+    UNIT_ASSERT(!SettingsLoad(CreateSettings(VERSION), &value));
+    UNIT_ASSERT_EQUAL(0, value);
+    unlink(path);
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    static const unit_case_t cases[] = {
+        UNIT_CASE(TestCreateRejectsInvalidParameters, "un almacenamiento rechaza parámetros inválidos"),
+        UNIT_CASE(TestEmptyEepromHasNoData, "una EEPROM sin registros no entrega datos"),
+        UNIT_CASE(TestBurstOfChangesCostsOneProgram, "una ráfaga de cambios se graba con una programación"),
+        UNIT_CASE(TestSaveWithoutChangesDoesNotProgram, "guardar los mismos datos no programa la EEPROM"),
+        UNIT_CASE(TestServiceDoesNotWaitForProgramming, "el servicio no espera el fin de la programación"),
+        UNIT_CASE(TestRecordsRotateAcrossPages, "los registros reparten el desgaste entre las páginas"),
+        UNIT_CASE(TestRestartRestoresNewestRecord, "al reiniciar se restaura el registro más reciente"),
+        UNIT_CASE(TestRestartSkipsTornRecord, "al reiniciar se descarta un registro con CRC incorrecto"),
+        UNIT_CASE(TestRestartIgnoresOtherVersions, "al reiniciar se ignoran los registros de otra versión"),
+    };
+
+    return UnitRun("settings", cases, UNIT_COUNT(cases));
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,308 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_softtimer.c
+ ** @brief Pruebas unitarias del servicio de temporizadores de software, que avanza en tiempo virtual
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "config.h"
+#include "softtimer.h"
+#include "unit.h"
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief Ticks de la comparación con el modelo de referencia, suficientes para varias vueltas de la tercera rueda */
+#define RANDOM_TICKS 600000
+
+/** @brief Mayor demora de los temporizadores de la comparación con el modelo de referencia */
+#define RANDOM_MAX_DELAY 300000
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Registro de los vencimientos de un temporizador.
+ */
+typedef struct timer_log_s {
+    uint32_t count;    /**< Cantidad de vencimientos. */
+    uint32_t last;     /**< Tick del último vencimiento. */
+    soft_timer_t stop; /**< Temporizador que detiene la función al vencer, o `NULL`. */
+    uint8_t rearm;     /**< Veces que la función vuelve a armar su temporizador con demora de un tick. */
+} timer_log_t;
+
+/**
+ * @brief Estado esperado de un temporizador en la comparación con el modelo de referencia.
+ */
+typedef struct timer_model_s {
+    bool running;    /**< Indica si el temporizador está armado. */
+    uint32_t due;    /**< Tick del próximo vencimiento. */
+    uint32_t period; /**< Ticks entre vencimientos, o cero si es de un disparo. */
+} timer_model_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Registra un vencimiento y ejecuta las acciones configuradas en el registro.
+ *
+ * @param timer   Temporizador que venció.
+ * @param object  Registro de vencimientos.
+ */
+static void LogExpired(soft_timer_t timer, void * object);
+
+/**
+ * @brief Crea un temporizador que registra sus vencimientos.
+ *
+ * @param log  Registro de vencimientos, que se inicializa vacío.
+ * @return Instancia del temporizador.
+ */
+static soft_timer_t CreateLogged(timer_log_t * log);
+
+/**
+ * @brief Avanza el servicio una cantidad de ticks.
+ *
+ * @param count  Cantidad de ticks.
+ */
+static void Advance(uint32_t count);
+
+/**
+ * @brief Genera un número pseudoaleatorio reproducible.
+ *
+ * @param limit  Cota superior, excluida.
+ * @return Número entre cero y `limit - 1`.
+ */
+static uint32_t Random(uint32_t limit);
+
+/* === Private variable definitions ================================================================================ */
+
+/** @brief Ticks avanzados desde el comienzo de la prueba */
+static uint32_t ticks;
+
+/** @brief Estado del generador pseudoaleatorio */
+static uint32_t seed = 12345;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void LogExpired(soft_timer_t timer, void * object) {
+    timer_log_t * log = object;
+
+    log->count++;
+    log->last = ticks;
+    if (log->stop != NULL) {
+        SoftTimerStop(log->stop);
+    }
+    if (log->rearm != 0) {
+        log->rearm--;
+        SoftTimerStart(timer, 1, 0);
+    }
+}
+
+static soft_timer_t CreateLogged(timer_log_t * log) {
+    soft_timer_t timer;
+
+    *log = (timer_log_t){0};
+    timer = SoftTimerCreate(LogExpired, log);
+    UNIT_ASSERT_NOT_NULL(timer);
+    return timer;
+}
+
+static void Advance(uint32_t count) {
+    for (uint32_t index = 0; index < count; index++) {
+        ticks++;
+        SoftTimerTick();
+    }
+}
+
+static uint32_t Random(uint32_t limit) {
+    seed = seed * 1103515245u + 12345u;
+    return (seed >> 8) % limit;
+}
+
+static void TestCreateRejectsInvalidParameters(void) {
+    timer_log_t log;
+    soft_timer_t timer;
+
+    UNIT_ASSERT_NULL(SoftTimerCreate(NULL, NULL));
+    timer = CreateLogged(&log);
+    UNIT_ASSERT(!SoftTimerStart(timer, 0, 10));
+    UNIT_ASSERT(!SoftTimerIsRunning(timer));
+    for (uint8_t index = 1; index < SOFT_TIMER_POOL_SIZE; index++) {
+        UNIT_ASSERT_NOT_NULL(SoftTimerCreate(LogExpired, &log));
+    }
+    UNIT_ASSERT_NULL(SoftTimerCreate(LogExpired, &log));
+}
+
+static void TestOneShotFiresOnceAfterDelay(void) {
+    timer_log_t log;
+    soft_timer_t timer = CreateLogged(&log);
+
+    UNIT_ASSERT(SoftTimerStart(timer, 3, 0));
+    UNIT_ASSERT(SoftTimerIsRunning(timer));
+    UNIT_ASSERT_EQUAL(3, SoftTimerGetRemaining(timer));
+    Advance(2);
+    UNIT_ASSERT_EQUAL(0, log.count);
+    UNIT_ASSERT_EQUAL(1, SoftTimerGetRemaining(timer));
+    Advance(1);
+    UNIT_ASSERT_EQUAL(1, log.count);
+    UNIT_ASSERT_EQUAL(3, log.last);
+    UNIT_ASSERT(!SoftTimerIsRunning(timer));
+    UNIT_ASSERT_EQUAL(0, SoftTimerGetRemaining(timer));
+    Advance(200);
+    UNIT_ASSERT_EQUAL(1, log.count);
+}
+
+static void TestPeriodicFiresEveryPeriod(void) {
+    timer_log_t log;
+    soft_timer_t timer = CreateLogged(&log);
+
+    UNIT_ASSERT(SoftTimerStart(timer, 5, 3));
+    Advance(20);
+    UNIT_ASSERT_EQUAL(6, log.count);
+    UNIT_ASSERT_EQUAL(20, log.last);
+    UNIT_ASSERT(SoftTimerIsRunning(timer));
+    UNIT_ASSERT_EQUAL(3, SoftTimerGetRemaining(timer));
+}
+
+static void TestStopAndRestart(void) {
+    timer_log_t log;
+    soft_timer_t timer = CreateLogged(&log);
+
+    SoftTimerStart(timer, 100, 0);
+    Advance(50);
+    SoftTimerStop(timer);
+    SoftTimerStop(timer);
+    Advance(100);
+    UNIT_ASSERT_EQUAL(0, log.count);
+
+    /* Volver a armar un temporizador armado descarta el vencimiento anterior */
+    SoftTimerStart(timer, 10, 0);
+    Advance(5);
+    SoftTimerStart(timer, 10, 0);
+    Advance(9);
+    UNIT_ASSERT_EQUAL(0, log.count);
+    Advance(1);
+    UNIT_ASSERT_EQUAL(1, log.count);
+    UNIT_ASSERT_EQUAL(165, log.last);
+}
+
+static void TestLongDelaysFireOnTime(void) {
+    static const uint32_t delays[] = {63, 64, 65, 4095, 4096, 262151, 16777216 + 5};
+    timer_log_t logs[UNIT_COUNT(delays)];
+    soft_timer_t timers[UNIT_COUNT(delays)];
+
+    /* Se arrancan desplazados para que los vencimientos no queden alineados con las vueltas de las ruedas */
+    Advance(37);
+    for (uint8_t index = 0; index < UNIT_COUNT(delays); index++) {
+        timers[index] = CreateLogged(&logs[index]);
+        SoftTimerStart(timers[index], delays[index], 0);
+    }
+    Advance(delays[UNIT_COUNT(delays) - 1] + 10);
+    for (uint8_t index = 0; index < UNIT_COUNT(delays); index++) {
+        UNIT_ASSERT_EQUAL(1, logs[index].count);
+        UNIT_ASSERT_EQUAL(37 + delays[index], logs[index].last);
+    }
+}
+
+static void TestCallbacksMayStopAndRearm(void) {
+    timer_log_t first;
+    timer_log_t second;
+    timer_log_t repeated;
+    soft_timer_t stopper = CreateLogged(&first);
+    soft_timer_t stopped = CreateLogged(&second);
+    soft_timer_t rearmed = CreateLogged(&repeated);
+
+    /* Los dos vencen en el mismo tick y el que corre primero detiene al otro antes de que corra su función */
+    SoftTimerStart(stopped, 7, 0);
+    SoftTimerStart(stopper, 7, 0);
+    first.stop = stopped;
+    repeated.rearm = 2;
+    SoftTimerStart(rearmed, 4, 0);
+    Advance(10);
+    UNIT_ASSERT_EQUAL(1, first.count);
+    UNIT_ASSERT_EQUAL(0, second.count);
+    UNIT_ASSERT(!SoftTimerIsRunning(stopper));
+    UNIT_ASSERT(!SoftTimerIsRunning(stopped));
+    UNIT_ASSERT_EQUAL(3, repeated.count);
+    UNIT_ASSERT_EQUAL(6, repeated.last);
+}
+
+static void TestRandomScheduleMatchesReference(void) {
+    timer_log_t logs[SOFT_TIMER_POOL_SIZE];
+    soft_timer_t timers[SOFT_TIMER_POOL_SIZE];
+    timer_model_t model[SOFT_TIMER_POOL_SIZE] = {0};
+    uint32_t expected[SOFT_TIMER_POOL_SIZE] = {0};
+
+    for (uint8_t index = 0; index < SOFT_TIMER_POOL_SIZE; index++) {
+        timers[index] = CreateLogged(&logs[index]);
+    }
+
+    while (ticks < RANDOM_TICKS) {
+        /* De vez en cuando se arma o se detiene un temporizador elegido al azar */
+        if (Random(64) == 0) {
+            uint8_t index = Random(SOFT_TIMER_POOL_SIZE);
+
+            if (Random(4) == 0) {
+                SoftTimerStop(timers[index]);
+                model[index].running = false;
+            } else {
+                uint32_t delay = 1 + Random((Random(2) == 0) ? 200 : RANDOM_MAX_DELAY);
+                uint32_t period = (Random(2) == 0) ? 0 : 1 + Random(5000);
+
+                SoftTimerStart(timers[index], delay, period);
+                model[index] = (timer_model_t){.running = true, .due = ticks + delay, .period = period};
+            }
+        }
+
+        Advance(1);
+        for (uint8_t index = 0; index < SOFT_TIMER_POOL_SIZE; index++) {
+            if (model[index].running && (model[index].due == ticks)) {
+                expected[index]++;
+                model[index].due += model[index].period;
+                model[index].running = (model[index].period != 0);
+            }
+            UNIT_ASSERT_EQUAL(expected[index], logs[index].count);
+            UNIT_ASSERT_EQUAL(model[index].running, SoftTimerIsRunning(timers[index]));
+            if (model[index].running) {
+                UNIT_ASSERT_EQUAL(model[index].due - ticks, SoftTimerGetRemaining(timers[index]));
+            }
+        }
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    static const unit_case_t cases[] = {
+        UNIT_CASE(TestCreateRejectsInvalidParameters, "la creación y el armado rechazan parámetros inválidos"),
+        UNIT_CASE(TestOneShotFiresOnceAfterDelay, "un temporizador de un disparo vence una vez al cumplir la demora"),
+        UNIT_CASE(TestPeriodicFiresEveryPeriod, "un temporizador periódico vence en cada período"),
+        UNIT_CASE(TestStopAndRestart, "detener y volver a armar descarta el vencimiento anterior"),
+        UNIT_CASE(TestLongDelaysFireOnTime, "las demoras que abarcan varias ruedas vencen en el tick exacto"),
+        UNIT_CASE(TestCallbacksMayStopAndRearm, "las funciones pueden detener y armar temporizadores"),
+        UNIT_CASE(TestRandomScheduleMatchesReference, "una secuencia al azar coincide con el modelo de referencia"),
+    };
+
+    return UnitRun("softtimer", cases, UNIT_COUNT(cases));
+}
+
+/* === End of documentation ======================================================================================== */
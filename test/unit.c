@@ -0,0 +1,117 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file unit.c
+ ** @brief Código fuente del soporte mínimo para las pruebas unitarias del proyecto en Linux
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "unit.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/* === Macros definitions ========================================================================================== */
+
+/** @brief Código de salida del proceso de una prueba que falló en una verificación */
+#define UNIT_FAILED 3
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Ejecuta un caso de prueba en un proceso hijo y espera su resultado.
+ *
+ * @param test  Caso de prueba.
+ * @return `true` si la prueba pasó; `false` si falló en una verificación o terminó de forma anormal.
+ */
+static bool RunCase(const unit_case_t * test);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static bool RunCase(const unit_case_t * test) {
+    int status;
+    pid_t child;
+
+    fflush(stdout);
+    child = fork();
+    if (child < 0) {
+        perror("fork");
+        return false;
+    }
+    if (child == 0) {
+        test->test();
+        fflush(stdout);
+        _exit(EXIT_SUCCESS);
+    }
+
+    if (waitpid(child, &status, 0) < 0) {
+        perror("waitpid");
+        return false;
+    }
+    if (WIFSIGNALED(status)) {
+        fprintf(stderr, "  %s terminó con la señal %d\n", test->name, WTERMSIG(status));
+        return false;
+    }
+    return WIFEXITED(status) && (WEXITSTATUS(status) == EXIT_SUCCESS);
+}
+
+/* === Public function implementation ============================================================================== */
+
+void UnitCheck(bool condition, const char * file, int line, const char * format, ...) {
+    va_list args;
+
+    if (condition) {
+        return;
+    }
+    fprintf(stderr, "  %s:%d: ", file, line);
+    va_start(args, format);
+    vfprintf(stderr, format, args);
+    va_end(args);
+    fputc('\n', stderr);
+    fflush(stdout);
+    _exit(UNIT_FAILED);
+}
+
+int UnitRun(const char * suite, const unit_case_t cases[], size_t count) {
+    size_t failed = 0;
+
+    for (size_t index = 0; index < count; index++) {
+        bool passed = RunCase(&cases[index]);
+
+        printf("%s %s: %s\n", passed ? "ok   " : "FALLA", suite, cases[index].description);
+        if (!passed) {
+            failed++;
+        }
+    }
+    printf("%s: %zu pruebas, %zu fallas\n", suite, count, failed);
+    return (failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,124 @@
+/*********************************************************************************************************************
+Copyright (c) 2025, Natalia Carolina Borbón <nataliacborbon@gmail.com>
+Copyright (c) 2025, Laboratorio de Microprocesadores, Universidad Nacional de Tucumán, Argentina
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+#ifndef UNIT_H_
+#define UNIT_H_
+
+/** @file unit.h
+ ** @brief Soporte mínimo para las pruebas unitarias del proyecto en Linux
+ **
+ ** Cada prueba se ejecuta en un proceso hijo propio, de modo que empieza con las reservas estáticas de los módulos y el
+ ** chip simulado en su estado inicial, sin necesidad de funciones para liberarlos.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/** @brief Arma una entrada de la tabla de pruebas a partir de la función y su descripción */
+#define UNIT_CASE(test, description) {(test), #test, (description)}
+
+/** @brief Termina la prueba en curso con una falla si la condición es falsa */
+#define UNIT_ASSERT(condition) UnitCheck((condition), __FILE__, __LINE__, "%s", #condition)
+
+/** @brief Termina la prueba en curso con una falla si los dos valores enteros son distintos */
+#define UNIT_ASSERT_EQUAL(expected, actual)                                                                            \
+    do {                                                                                                               \
+        long long unitExpected = (long long)(expected);                                                                \
+        long long unitActual = (long long)(actual);                                                                    \
+        UnitCheck(unitExpected == unitActual, __FILE__, __LINE__, "%s: se esperaba %lld y se obtuvo %lld", #actual,    \
+                  unitExpected, unitActual);                                                                           \
+    } while (0)
+
+/** @brief Termina la prueba en curso con una falla si los dos valores difieren en algún bit */
+#define UNIT_ASSERT_BITS(expected, actual)                                                                             \
+    do {                                                                                                               \
+        uint32_t unitExpected = (uint32_t)(expected);                                                                  \
+        uint32_t unitActual = (uint32_t)(actual);                                                                      \
+        UnitCheck(unitExpected == unitActual, __FILE__, __LINE__, "%s: se esperaba 0x%08X y se obtuvo 0x%08X",         \
+                  #actual, unitExpected, unitActual);                                                                  \
+    } while (0)
+
+/** @brief Termina la prueba en curso con una falla si el puntero es nulo */
+#define UNIT_ASSERT_NOT_NULL(pointer) UNIT_ASSERT((pointer) != NULL)
+
+/** @brief Termina la prueba en curso con una falla si el puntero no es nulo */
+#define UNIT_ASSERT_NULL(pointer) UNIT_ASSERT((pointer) == NULL)
+
+/** @brief Cantidad de elementos de un arreglo */
+#define UNIT_COUNT(array) (sizeof(array) / sizeof((array)[0]))
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Caso de prueba.
+ */
+typedef struct unit_case_s {
+    void (*test)(void);       /**< Función que implementa la prueba. */
+    const char * name;        /**< Nombre de la función, para identificar la prueba en el informe. */
+    const char * description; /**< Comportamiento que verifica la prueba. */
+} unit_case_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Verifica una condición dentro de una prueba.
+ *
+ * Si la condición es falsa informa el archivo, la línea y el mensaje por la salida de errores y termina el proceso de
+ * la prueba con una falla. Se usa a través de las macros UNIT_ASSERT().
+ *
+ * @param condition  Resultado de la verificación.
+ * @param file       Archivo fuente de la verificación.
+ * @param line       Línea de la verificación.
+ * @param format     Formato del mensaje de falla, con los argumentos que siguen, como en printf().
+ */
+void UnitCheck(bool condition, const char * file, int line, const char * format, ...)
+    __attribute__((format(printf, 4, 5)));
+
+/**
+ * @brief Ejecuta una tabla de pruebas, cada una en un proceso propio, e informa el resultado.
+ *
+ * @param suite  Nombre del conjunto de pruebas.
+ * @param cases  Tabla de casos de prueba.
+ * @param count  Cantidad de casos en la tabla.
+ * @return Cero si todas las pruebas pasaron, uno en caso contrario, para usarlo como resultado de main().
+ */
+int UnitRun(const char * suite, const unit_case_t cases[], size_t count);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UNIT_H_ */